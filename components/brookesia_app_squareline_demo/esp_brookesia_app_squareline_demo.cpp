@@ -3,7 +3,12 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
 #include "lvgl.h"
+#include "esp_timer.h"
 #include "esp_brookesia.hpp"
 #ifdef ESP_UTILS_LOG_TAG
 #   undef ESP_UTILS_LOG_TAG
@@ -18,6 +23,25 @@ extern "C" i2c_master_bus_handle_t bsp_i2c_get_handle(void);
 
 #define APP_NAME "Squareline"
 
+#define CLOCK_UPDATE_PERIOD_MS          (1000)
+// The hour hand moves every minute, by half a degree
+#define CLOCK_HOUR_HAND_ANGLE_NUM       (720)
+#define CLOCK_MIN_HAND_ANGLE_NUM        (60)
+#define CLOCK_SEC_HAND_ANGLE_NUM        (60)
+// Half a degree per step, the tip of the seconds hand moves by less than a pixel
+#define CLOCK_SEC_HAND_SWEEP_ANGLE_NUM  (720)
+#define CLOCK_SWEEP_FRAME_PERIOD_MS     (33)
+// A third of the frame period, the rest is left to the other tasks
+#define CLOCK_SWEEP_FRAME_BUDGET_US     (11000)
+#define CLOCK_SWEEP_OVERRUN_NUM_MAX     (3)
+// Fire slightly after the minute boundary, so the RTC has already rolled over
+#define AMBIENT_UPDATE_MARGIN_MS        (50)
+#define AMBIENT_TEXT_COLOR              (0x808080)
+#define AMBIENT_DATE_COLOR              (0x505050)
+// Same as `ui_screen_clock.c`
+#define NORMAL_TEXT_COLOR               (0x293062)
+#define NORMAL_DATE_COLOR               (0x9C9CD9)
+
 using namespace std;
 using namespace esp_brookesia::gui;
 using namespace esp_brookesia::systems;
@@ -40,8 +64,20 @@ SquarelineDemo::SquarelineDemo(bool use_status_bar, bool use_navigation_bar):
     App(APP_NAME, &esp_brookesia_app_icon_launcher_squareline_112_112, false, use_status_bar, use_navigation_bar),
     clock_update_timer(nullptr),
     rtc_initialized(false),
-    button_gpio(GPIO_NUM_0),
-    display_sleeping(false)
+    foreground(false),
+    ambient_mode(false),
+    hour_hand_sprites(ui_img_clock_hour_png, CLOCK_HOUR_HAND_ANGLE_NUM),
+    min_hand_sprites(ui_img_clock_min_png, CLOCK_MIN_HAND_ANGLE_NUM),
+    sec_hand_sprites(ui_img_clock_sec_png, CLOCK_SEC_HAND_ANGLE_NUM),
+    sec_sweep_hand_sprites(ui_img_clock_sec_png, CLOCK_SEC_HAND_SWEEP_ANGLE_NUM),
+    sweep_timer(nullptr),
+    sweep_mode(false),
+    is_sweeping(false),
+    is_sweep_over_budget(false),
+    sweep_overrun_count(0),
+    sweep_time_base_us(0),
+    sweep_time_base_ms(0),
+    sweep_stats{}
 {
 }
 
@@ -50,6 +86,9 @@ SquarelineDemo::~SquarelineDemo()
    if (clock_update_timer) {
         lv_timer_del(clock_update_timer);
     }
+    if (sweep_timer) {
+        lv_timer_del(sweep_timer);
+    }
 }
 
 bool SquarelineDemo::run(void)
@@ -74,21 +113,62 @@ bool SquarelineDemo::run(void)
     
     // Create all UI resources here
     phone_app_squareline_ui_init();
+    if (!beginClockHandSprites()) {
+        ESP_UTILS_LOGW("Begin clock hand sprites failed, rotate the hands instead");
+    }
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+    if (watchface.isLoaded() && !beginWatchface()) {
+        ESP_UTILS_LOGW("Begin watchface(%s) failed, show the SquareLine one instead", watchface_path.c_str());
+    }
+#endif
     
     // Create timer to update clock
     if (rtc_initialized) {
         clock_update_timer = lv_timer_create(update_clock_callback, 1000, this);
+        // Only running in the sweep mode
+        sweep_timer = lv_timer_create(sweep_frame_callback, CLOCK_SWEEP_FRAME_PERIOD_MS, this);
+        lv_timer_pause(sweep_timer);
         updateClockHands(); // Update immediately
     }
-    // Setup button for sleep/wake
-    gpio_config_t io_conf = {};
-    io_conf.intr_type = GPIO_INTR_NEGEDGE;
-    io_conf.pin_bit_mask = (1ULL << button_gpio);
-    io_conf.mode = GPIO_MODE_INPUT;
-    io_conf.pull_up_en = GPIO_PULLUP_ENABLE;
-    gpio_config(&io_conf);
-//    gpio_install_isr_service(0);
-    gpio_isr_handler_add(button_gpio, button_isr_handler, (void*)this);
+    // The button sleep/wake is handled by the power service in `main`
+
+    // Report the render time and the flushed area of every ambient update, and of the clock ticks every minute
+    refresh_monitor = std::make_unique<LvRefreshMonitor>(lv_obj_get_display(ui_screen_clock));
+    refresh_monitor->setFrameCallback([this](const LvRefreshMonitor::Frame &frame) {
+        if (ambient_mode) {
+            ESP_UTILS_LOGI(
+                "Ambient update: render(%dus), flushed(%dpx in %d areas)", static_cast<int>(frame.render_us),
+                static_cast<int>(frame.flushed_px), static_cast<int>(frame.flush_count)
+            );
+        }
+        if (is_sweeping) {
+            sweep_overrun_count = (frame.render_us > CLOCK_SWEEP_FRAME_BUDGET_US) ? (sweep_overrun_count + 1) : 0;
+            if (sweep_overrun_count >= CLOCK_SWEEP_OVERRUN_NUM_MAX) {
+                ESP_UTILS_LOGW(
+                    "Sweep frames over budget(%dus > %dus), tick every second until the next minute",
+                    static_cast<int>(frame.render_us), CLOCK_SWEEP_FRAME_BUDGET_US
+                );
+                is_sweep_over_budget = true;
+                sweep_stats.fallback_count++;
+                updateSweepState();
+            }
+        }
+    });
+
+#if ESP_BROOKESIA_SERVICES_ENABLE_POWER
+    // Dimming turns the watchface into the ambient mode instead of switching the display off
+    power_state_connection = services::Power::requestInstance().connectStateChangedSignal(
+    [this](services::Power::State from, services::Power::State to) {
+        LvLockGuard gui_guard;
+        if (to == services::Power::State::Dim) {
+            ESP_UTILS_CHECK_FALSE_EXIT(setAmbientMode(foreground), "Set ambient mode failed");
+        } else if (to == services::Power::State::Active) {
+            ESP_UTILS_CHECK_FALSE_EXIT(setAmbientMode(false), "Set ambient mode failed");
+        }
+    });
+#endif
+    setForeground(true);
+
     return true;
 }
 
@@ -106,6 +186,457 @@ bool SquarelineDemo::back(void)
     return true;
 }
 
+bool SquarelineDemo::close(void)
+{
+    ESP_UTILS_LOGD("Close");
+
+    setForeground(false);
+    power_state_connection.disconnect();
+    refresh_monitor.reset();
+    // The timers are recorded by the core and cleaned up after closing
+    clock_update_timer = nullptr;
+    sweep_timer = nullptr;
+    is_sweeping = false;
+    // So are the hand images
+    ClockHandSprites *hand_sprites[] = {
+        &hour_hand_sprites, &min_hand_sprites, &sec_hand_sprites, &sec_sweep_hand_sprites
+    };
+    for (auto sprites : hand_sprites) {
+        sprites->detach();
+    }
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+    // The face stays loaded for the next run
+    ESP_UTILS_CHECK_FALSE_RETURN(watchface.del(), false, "Delete watchface failed");
+#endif
+
+    return true;
+}
+
+bool SquarelineDemo::pause(void)
+{
+    ESP_UTILS_LOGD("Pause");
+
+    setForeground(false);
+
+    return true;
+}
+
+bool SquarelineDemo::resume(void)
+{
+    ESP_UTILS_LOGD("Resume");
+
+    setForeground(true);
+
+    return true;
+}
+
+bool SquarelineDemo::setAmbientMode(bool enable)
+{
+    ESP_UTILS_LOGD("Param: enable(%d)", enable);
+
+    if (enable == ambient_mode) {
+        return true;
+    }
+
+    ambient_mode = enable;
+    if (enable) {
+        // Black background is free on AMOLED, drop the tiled pattern and everything that changes every second
+        lv_obj_set_style_bg_image_src(ui_screen_clock, nullptr, LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_set_style_bg_color(ui_screen_clock, lv_color_black(), LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_set_style_bg_opa(ui_screen_clock, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_set_style_text_color(
+            ui_clock_label_clock_number, lv_color_hex(AMBIENT_TEXT_COLOR), LV_PART_MAIN | LV_STATE_DEFAULT
+        );
+        lv_obj_set_style_text_color(
+            ui_clock_small_label_date, lv_color_hex(AMBIENT_DATE_COLOR), LV_PART_MAIN | LV_STATE_DEFAULT
+        );
+        lv_obj_add_flag(ui_clock_image_sec, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_flag(ui_clock_scrolldots_scrolldots, LV_OBJ_FLAG_HIDDEN);
+        if (refresh_monitor) {
+            refresh_monitor->reset();
+        }
+    } else {
+        lv_obj_set_style_bg_image_src(ui_screen_clock, &ui_img_pattern_png, LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_remove_local_style_prop(ui_screen_clock, LV_STYLE_BG_COLOR, LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_remove_local_style_prop(ui_screen_clock, LV_STYLE_BG_OPA, LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_set_style_text_color(
+            ui_clock_label_clock_number, lv_color_hex(NORMAL_TEXT_COLOR), LV_PART_MAIN | LV_STATE_DEFAULT
+        );
+        lv_obj_set_style_text_color(
+            ui_clock_small_label_date, lv_color_hex(NORMAL_DATE_COLOR), LV_PART_MAIN | LV_STATE_DEFAULT
+        );
+        lv_obj_remove_flag(ui_clock_image_sec, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_remove_flag(ui_clock_scrolldots_scrolldots, LV_OBJ_FLAG_HIDDEN);
+        if (refresh_monitor) {
+            refresh_monitor->dump("ambient");
+        }
+    }
+
+    updateSweepState();
+    if (rtc_initialized) {
+        updateClockHands();
+    }
+
+    return true;
+}
+
+void SquarelineDemo::setForeground(bool foreground)
+{
+    this->foreground = foreground;
+    if (!foreground) {
+        ESP_UTILS_CHECK_FALSE_EXIT(setAmbientMode(false), "Set ambient mode failed");
+    }
+#if ESP_BROOKESIA_SERVICES_ENABLE_POWER
+    // Only keep the display on while the watchface is visible
+    ESP_UTILS_CHECK_FALSE_EXIT(
+        services::Power::requestInstance().setAlwaysOn(foreground), "Set power always on failed"
+    );
+#endif
+    updateSweepState();
+}
+
+static void clock_label_set_text(lv_obj_t *label, const char *text)
+{
+    // Setting the same text still invalidates the label, which changes only once a minute
+    if (strcmp(lv_label_get_text(label), text) != 0) {
+        lv_label_set_text(label, text);
+    }
+}
+
+bool SquarelineDemo::setClockHandAngle(lv_obj_t *hand, int32_t angle)
+{
+    ClockHandSprites *hand_sprites[] = {
+        &hour_hand_sprites, &min_hand_sprites, &sec_hand_sprites, &sec_sweep_hand_sprites
+    };
+    for (auto sprites : hand_sprites) {
+        if (sprites->isAttached(hand)) {
+            return sprites->setAngle(angle);
+        }
+    }
+    lv_image_set_rotation(hand, angle);
+
+    return true;
+}
+
+bool SquarelineDemo::beginClockHandSprites()
+{
+    ESP_UTILS_LOGD("Begin clock hand sprites");
+
+    std::pair<ClockHandSprites *, lv_obj_t *> hands[] = {
+        {&hour_hand_sprites, ui_clock_image_hour},
+        {&min_hand_sprites, ui_clock_image_min},
+        {&sec_hand_sprites, ui_clock_image_sec},
+    };
+
+    // The sprites don't depend on the UI objects, so they are only rotated once and kept across the runs
+    if (!hour_hand_sprites.isValid()) {
+        int64_t start_us = esp_timer_get_time();
+        size_t memory_size = 0;
+        for (auto &[sprites, image] : hands) {
+            ESP_UTILS_CHECK_FALSE_RETURN(sprites->begin(), false, "Begin sprites failed");
+            memory_size += sprites->getMemorySize();
+        }
+        ESP_UTILS_LOGI(
+            "Clock hand sprites rotated in %dms, using %dKB",
+            static_cast<int>((esp_timer_get_time() - start_us) / 1000), static_cast<int>(memory_size / 1024)
+        );
+    }
+    for (auto &[sprites, image] : hands) {
+        ESP_UTILS_CHECK_FALSE_RETURN(sprites->attach(image), false, "Attach sprites failed");
+    }
+    if (sweep_mode) {
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            sec_sweep_hand_sprites.takeOver(sec_hand_sprites), false, "Take over seconds hand failed"
+        );
+    }
+
+    return true;
+}
+
+bool SquarelineDemo::setSweepMode(bool enable)
+{
+    ESP_UTILS_LOGD("Param: enable(%d)", enable);
+
+    if (enable == sweep_mode) {
+        return true;
+    }
+
+    // The sweep uses more angles, only rotated once the mode is used
+    if (enable && !sec_sweep_hand_sprites.isValid()) {
+        int64_t start_us = esp_timer_get_time();
+        ESP_UTILS_CHECK_FALSE_RETURN(sec_sweep_hand_sprites.begin(), false, "Begin sweep sprites failed");
+        ESP_UTILS_LOGI(
+            "Sweep hand sprites rotated in %dms, using %dKB",
+            static_cast<int>((esp_timer_get_time() - start_us) / 1000),
+            static_cast<int>(sec_sweep_hand_sprites.getMemorySize() / 1024)
+        );
+    }
+    if (enable && sec_hand_sprites.isAttached(ui_clock_image_sec)) {
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            sec_sweep_hand_sprites.takeOver(sec_hand_sprites), false, "Take over seconds hand failed"
+        );
+    } else if (!enable && sec_sweep_hand_sprites.isAttached(ui_clock_image_sec)) {
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            sec_hand_sprites.takeOver(sec_sweep_hand_sprites), false, "Take over seconds hand failed"
+        );
+    }
+
+    sweep_mode = enable;
+    is_sweep_over_budget = false;
+    resetSweepStats();
+    updateSweepState();
+
+    return true;
+}
+
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+bool SquarelineDemo::setWatchface(const char *path)
+{
+    ESP_UTILS_LOGD("Param: path(%s)", (path != nullptr) ? path : "null");
+
+    if ((path == nullptr) || (path[0] == '\0')) {
+        delWatchface();
+        watchface.unload();
+        watchface_path.clear();
+        return true;
+    }
+
+    int64_t start_us = esp_timer_get_time();
+    bool is_loaded = false;
+    if (path[0] == '/') {
+        is_loaded = watchface.loadFromFile(path);
+    } else {
+        // Mapped with the images, the face is used in place
+        size_t size = 0;
+        const uint8_t *data = beginAssets() ? LvAssets::getInstance().getFile(path, &size) : nullptr;
+        if (data != nullptr) {
+            is_loaded = watchface.loadFromMemory(data, size);
+        } else {
+            ESP_UTILS_LOGE("Watchface(%s) not found in the assets partition", path);
+        }
+    }
+    if (!is_loaded) {
+        ESP_UTILS_LOGE("Load watchface(%s) failed, show the SquareLine one instead", path);
+        delWatchface();
+        watchface_path.clear();
+        return false;
+    }
+    ESP_UTILS_LOGI(
+        "Watchface(%s) loaded in %dms", path, static_cast<int>((esp_timer_get_time() - start_us) / 1000)
+    );
+    watchface_path = path;
+
+    // The refresh monitor only exists while the app runs, otherwise the face is shown by the next run
+    if (refresh_monitor && !watchface.isBegun()) {
+        ESP_UTILS_CHECK_FALSE_RETURN(beginWatchface(), false, "Begin watchface failed");
+    }
+    if (watchface.isBegun() && rtc_initialized) {
+        updateWatchface(rtc.getDateTime());
+    }
+    updateSweepState();
+
+    return true;
+}
+
+void SquarelineDemo::setWatchfaceComplication(uint8_t id, uint8_t value)
+{
+    ESP_UTILS_LOGD("Param: id(%d), value(%d)", id, value);
+
+    watchface.setComplicationValue(id, value);
+    if (watchface.isBegun() && rtc_initialized) {
+        updateWatchface(rtc.getDateTime());
+    }
+}
+
+bool SquarelineDemo::beginWatchface()
+{
+    ESP_UTILS_LOGD("Begin watchface");
+
+    LvObject screen(ui_screen_clock, false);
+    ESP_UTILS_CHECK_FALSE_RETURN(watchface.begin(&screen), false, "Begin watchface failed");
+    // Keep the page dots above the face
+    lv_obj_move_to_index(watchface.getCanvas()->getNativeHandle(), 0);
+
+    lv_obj_t *widgets[] = {ui_clock_panel_clock_panel, ui_clock_label_clock_number, ui_clock_small_label_date};
+    for (auto widget : widgets) {
+        lv_obj_add_flag(widget, LV_OBJ_FLAG_HIDDEN);
+    }
+
+    return true;
+}
+
+void SquarelineDemo::delWatchface()
+{
+    if (!watchface.isBegun()) {
+        return;
+    }
+
+    ESP_UTILS_CHECK_FALSE_EXIT(watchface.del(), "Delete watchface failed");
+
+    lv_obj_t *widgets[] = {ui_clock_panel_clock_panel, ui_clock_label_clock_number, ui_clock_small_label_date};
+    for (auto widget : widgets) {
+        lv_obj_remove_flag(widget, LV_OBJ_FLAG_HIDDEN);
+    }
+    updateSweepState();
+    if (rtc_initialized) {
+        updateClockHands();
+    }
+}
+
+void SquarelineDemo::updateWatchface(const RTC_DateTime &dt)
+{
+    struct tm time = {};
+    time.tm_year = dt.getYear() - 1900;
+    time.tm_mon = dt.getMonth() - 1;
+    time.tm_mday = dt.getDay();
+    time.tm_wday = dt.getWeek();
+    time.tm_hour = dt.getHour();
+    time.tm_min = dt.getMinute();
+    // Only updated every minute in the ambient mode, keep the seconds layers on the minute
+    time.tm_sec = ambient_mode ? 0 : dt.getSecond();
+    ESP_UTILS_CHECK_FALSE_EXIT(watchface.update(time), "Update watchface failed");
+}
+#endif // ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+
+void SquarelineDemo::updateSweepState()
+{
+    bool sweeping = (sweep_timer != nullptr) && sweep_mode && foreground && !ambient_mode && !is_sweep_over_budget;
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+    sweeping = sweeping && !watchface.isBegun();
+#endif
+    if (sweeping == is_sweeping) {
+        return;
+    }
+
+    is_sweeping = sweeping;
+    if (sweeping) {
+        sweep_overrun_count = 0;
+        sweep_stats.last_frame_us = 0;
+        lv_timer_resume(sweep_timer);
+        return;
+    }
+
+    if (sweep_timer != nullptr) {
+        lv_timer_pause(sweep_timer);
+    }
+    // Back to the whole second, as shown by the ticks
+    if (!ambient_mode) {
+        setClockHandAngle(ui_clock_image_sec, getSweepTimeMs(esp_timer_get_time()) / 1000 * 60);
+    }
+}
+
+void SquarelineDemo::updateSweepFrame()
+{
+    int64_t now_us = esp_timer_get_time();
+    if (sweep_stats.last_frame_us > 0) {
+        auto interval_us = now_us - sweep_stats.last_frame_us;
+        auto jitter_us = static_cast<uint32_t>(std::abs(interval_us - CLOCK_SWEEP_FRAME_PERIOD_MS * 1000));
+        sweep_stats.frame_count++;
+        sweep_stats.interval_us_total += interval_us;
+        sweep_stats.jitter_us_total += jitter_us;
+        sweep_stats.jitter_us_max = std::max(sweep_stats.jitter_us_max, jitter_us);
+    }
+    sweep_stats.last_frame_us = now_us;
+
+    // One turn per minute, in 0.1 degree
+    setClockHandAngle(ui_clock_image_sec, getSweepTimeMs(now_us) * 3600 / 60000);
+}
+
+void SquarelineDemo::syncSweepTime(int second)
+{
+    // The RTC only counts whole seconds: the time interpolated with `esp_timer` is kept within the second read, and
+    // only moved to its nearest bound once it drifts out of it
+    int64_t now_us = esp_timer_get_time();
+    int32_t offset_ms = getSweepTimeMs(now_us) - second * 1000;
+    if (offset_ms < -30000) {
+        offset_ms += 60000;
+    } else if (offset_ms >= 30000) {
+        offset_ms -= 60000;
+    }
+    if ((offset_ms >= 0) && (offset_ms < 1000)) {
+        return;
+    }
+
+    sweep_time_base_us = now_us;
+    sweep_time_base_ms = second * 1000 + ((offset_ms < 0) ? 0 : 999);
+}
+
+int32_t SquarelineDemo::getSweepTimeMs(int64_t now_us) const
+{
+    return static_cast<int32_t>((sweep_time_base_ms + (now_us - sweep_time_base_us) / 1000) % 60000);
+}
+
+void SquarelineDemo::resetSweepStats()
+{
+    sweep_stats = {};
+    sweep_stats.start_us = esp_timer_get_time();
+    if (LvScheduler::getInstance().isRunning()) {
+        sweep_stats.handler_us_start = LvScheduler::getInstance().getStats().handler_us;
+    }
+}
+
+void SquarelineDemo::dumpClockTickStats()
+{
+    refresh_monitor->dump("clock ticks");
+
+    // The bounding boxes are what the hands would invalidate without the bands, as a baseline
+    uint32_t invalidated_px = 0;
+    uint32_t bbox_px = 0;
+    ClockHandSprites *hand_sprites[] = {
+        &hour_hand_sprites, &min_hand_sprites, &sec_hand_sprites, &sec_sweep_hand_sprites
+    };
+    for (auto sprites : hand_sprites) {
+        invalidated_px += sprites->getStats().invalidated_px;
+        bbox_px += sprites->getStats().bbox_px;
+        sprites->resetStats();
+    }
+    ESP_UTILS_LOGI(
+        "Clock ticks: flushed(%dpx/s), hands invalidated(%dpx) instead of bounding boxes(%dpx)",
+        static_cast<int>(refresh_monitor->getFlushedPixelsPerSecond()), static_cast<int>(invalidated_px),
+        static_cast<int>(bbox_px)
+    );
+    refresh_monitor->reset();
+
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+    if (watchface.isBegun()) {
+        watchface.dump();
+        watchface.resetStats();
+    }
+#endif
+    if (sweep_mode) {
+        // The LVGL load is the time spent by the scheduler in `lv_timer_handler()`, including the flushing
+        auto elapsed_us = std::max<int64_t>(esp_timer_get_time() - sweep_stats.start_us, 1);
+        uint64_t handler_us = 0;
+        if (LvScheduler::getInstance().isRunning()) {
+            auto total_us = LvScheduler::getInstance().getStats().handler_us;
+            handler_us = (total_us >= sweep_stats.handler_us_start) ? (total_us - sweep_stats.handler_us_start) :
+                         total_us;
+        }
+        auto frame_count = std::max<uint32_t>(sweep_stats.frame_count, 1);
+        ESP_UTILS_LOGI(
+            "Sweep: frames(%d), interval avg(%dus), jitter avg(%dus) max(%dus), LVGL load(%d%%), fallbacks(%d)",
+            static_cast<int>(sweep_stats.frame_count), static_cast<int>(sweep_stats.interval_us_total / frame_count),
+            static_cast<int>(sweep_stats.jitter_us_total / frame_count), static_cast<int>(sweep_stats.jitter_us_max),
+            static_cast<int>(handler_us * 100 / elapsed_us), static_cast<int>(sweep_stats.fallback_count)
+        );
+        resetSweepStats();
+    }
+}
+
+void SquarelineDemo::updateClockTimerPeriod(int second)
+{
+    if (clock_update_timer == nullptr) {
+        return;
+    }
+
+    uint32_t period_ms = CLOCK_UPDATE_PERIOD_MS;
+    if (ambient_mode) {
+        // Sleep until the next minute, there is nothing else to redraw
+        period_ms = (60 - second) * 1000 + AMBIENT_UPDATE_MARGIN_MS;
+    }
+    lv_timer_set_period(clock_update_timer, period_ms);
+}
+
 void SquarelineDemo::update_clock_callback(lv_timer_t *timer)
 {
     SquarelineDemo *app = (SquarelineDemo *)timer->user_data;
@@ -114,6 +645,14 @@ void SquarelineDemo::update_clock_callback(lv_timer_t *timer)
     }
 }
 
+void SquarelineDemo::sweep_frame_callback(lv_timer_t *timer)
+{
+    SquarelineDemo *app = (SquarelineDemo *)timer->user_data;
+    if (app && app->is_sweeping) {
+        app->updateSweepFrame();
+    }
+}
+
 void SquarelineDemo::updateClockHands()
 {
     RTC_DateTime dt = rtc.getDateTime();
@@ -122,14 +661,30 @@ void SquarelineDemo::updateClockHands()
     int s = dt.getSecond();
     
     // Update analog hands (LVGL uses tenths of degrees)
-    lv_img_set_angle(ui_clock_image_hour, ((h % 12) * 300) + (m * 5));
-    lv_img_set_angle(ui_clock_image_min, m * 60);
-    lv_img_set_angle(ui_clock_image_sec, s * 60);
+    setClockHandAngle(ui_clock_image_hour, ((h % 12) * 300) + (m * 5));
+    setClockHandAngle(ui_clock_image_min, m * 60);
+    syncSweepTime(s);
+    if (!ambient_mode) {
+        if (!is_sweeping) {
+            setClockHandAngle(ui_clock_image_sec, s * 60);
+        }
+        if (s == 0) {
+            // Sweep again after falling back to the ticks
+            if (is_sweep_over_budget) {
+                is_sweep_over_budget = false;
+                updateSweepState();
+            }
+            if (refresh_monitor) {
+                dumpClockTickStats();
+            }
+        }
+    }
+    updateClockTimerPeriod(s);
     
     // Update digital time
     char buf[6];
     snprintf(buf, sizeof(buf), "%02d:%02d", h, m);
-    lv_label_set_text(ui_clock_label_clock_number, buf);
+    clock_label_set_text(ui_clock_label_clock_number, buf);
     // Update date label
     const char* days[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
     const char* months[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", 
@@ -137,31 +692,14 @@ void SquarelineDemo::updateClockHands()
     char date_buf[20];
     snprintf(date_buf, sizeof(date_buf), "%s %02d %s", 
              days[dt.getWeek()], dt.getDay(), months[dt.getMonth() - 1]);
-    lv_label_set_text(ui_clock_small_label_date, date_buf);
-}
+    clock_label_set_text(ui_clock_small_label_date, date_buf);
 
-void IRAM_ATTR SquarelineDemo::button_isr_handler(void* arg)
-{
-    SquarelineDemo* app = (SquarelineDemo*)arg;
-    // Toggle display sleep state
-    app->display_sleeping = !app->display_sleeping;
-    
-    if (app->display_sleeping) {
-        // Turn off display backlight
-        lv_display_set_default(NULL);
-    } else {
-        // Wake up display
-        lv_display_set_default(lv_display_get_next(NULL));
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+    if (watchface.isBegun()) {
+        updateWatchface(dt);
     }
+#endif
 }
-// bool SquarelineDemo::close(void)
-// {
-//     ESP_UTILS_LOGD("Close");
-
-//     /* Do some operations here if needed */
-
-//     return true;
-// }
 
 // bool SquarelineDemo::init()
 // {
@@ -181,32 +719,40 @@ void IRAM_ATTR SquarelineDemo::button_isr_handler(void* arg)
 //     return true;
 // }
 
-// bool SquarelineDemo::pause()
+// bool SquarelineDemo::cleanResource()
 // {
-//     ESP_UTILS_LOGD("Pause");
+//     ESP_UTILS_LOGD("Clean resource");
 
-//     /* Do some operations here if needed */
+//     /* Do some cleanup here if needed */
 
 //     return true;
 // }
 
-// bool SquarelineDemo::resume()
-// {
-//     ESP_UTILS_LOGD("Resume");
-
-//     /* Do some operations here if needed */
-
-//     return true;
-// }
+static void clock_hand_anim_callback_set_angle(lv_anim_t *a, int32_t v)
+{
+    ui_anim_user_data_t *usr = (ui_anim_user_data_t *)a->user_data;
+    SquarelineDemo::requestInstance()->setClockHandAngle(usr->target, v);
+}
 
-// bool SquarelineDemo::cleanResource()
-// {
-//     ESP_UTILS_LOGD("Clean resource");
+bool SquarelineDemo::beginAssets()
+{
+#if CONFIG_ESP_BROOKESIA_APP_SQUARELINE_DEMO_ENABLE_ASSETS_PARTITION
+    // May be called by a boot task and the GUI task at the same time, `LvAssets` only maps the partition once
+    static std::atomic<bool> is_begun(false);
 
-//     /* Do some cleanup here if needed */
+    if (!is_begun) {
+        is_begun = LvAssets::getInstance().addPartition({
+            .partition_label = CONFIG_ESP_BROOKESIA_APP_SQUARELINE_DEMO_ASSETS_PARTITION_LABEL,
+            .max_files = SQUARELINE_ASSETS_FILE_NUM,
+            .checksum = 0,
+        });
+    }
 
-//     return true;
-// }
+    return is_begun;
+#else
+    return true;
+#endif
+}
 
 extern "C" {
 
@@ -281,7 +827,7 @@ extern "C" {
         lv_anim_init(&PropertyAnimation_0);
         lv_anim_set_time(&PropertyAnimation_0, 1000);
         lv_anim_set_user_data(&PropertyAnimation_0, PropertyAnimation_0_user_data);
-        lv_anim_set_custom_exec_cb(&PropertyAnimation_0, _ui_anim_callback_set_image_angle);
+        lv_anim_set_custom_exec_cb(&PropertyAnimation_0, clock_hand_anim_callback_set_angle);
         lv_anim_set_values(&PropertyAnimation_0, 0, 2800);
         lv_anim_set_path_cb(&PropertyAnimation_0, lv_anim_path_ease_out);
         lv_anim_set_delay(&PropertyAnimation_0, delay + 0);
@@ -336,7 +882,7 @@ extern "C" {
         lv_anim_init(&PropertyAnimation_0);
         lv_anim_set_time(&PropertyAnimation_0, 1000);
         lv_anim_set_user_data(&PropertyAnimation_0, PropertyAnimation_0_user_data);
-        lv_anim_set_custom_exec_cb(&PropertyAnimation_0, _ui_anim_callback_set_image_angle);
+        lv_anim_set_custom_exec_cb(&PropertyAnimation_0, clock_hand_anim_callback_set_angle);
         lv_anim_set_values(&PropertyAnimation_0, 0, 2100);
         lv_anim_set_path_cb(&PropertyAnimation_0, lv_anim_path_ease_out);
         lv_anim_set_delay(&PropertyAnimation_0, delay + 0);
@@ -391,7 +937,7 @@ extern "C" {
         lv_anim_init(&PropertyAnimation_0);
         lv_anim_set_time(&PropertyAnimation_0, 60000);
         lv_anim_set_user_data(&PropertyAnimation_0, PropertyAnimation_0_user_data);
-        lv_anim_set_custom_exec_cb(&PropertyAnimation_0, _ui_anim_callback_set_image_angle);
+        lv_anim_set_custom_exec_cb(&PropertyAnimation_0, clock_hand_anim_callback_set_angle);
         lv_anim_set_values(&PropertyAnimation_0, 0, 3600);
         lv_anim_set_path_cb(&PropertyAnimation_0, lv_anim_path_linear);
         lv_anim_set_delay(&PropertyAnimation_0, delay + 0);
@@ -466,6 +1012,41 @@ extern "C" {
         );
     }
 
+#if CONFIG_ESP_BROOKESIA_APP_SQUARELINE_DEMO_ENABLE_ASSETS_PARTITION
+    /**
+     * The images and fonts of `ui.h` are resolved here, the assets partition is mapped on the first request unless
+     * `SquarelineDemo::beginAssets()` did it before. A missing asset is logged and replaced by an empty image or the
+     * default font, so the screens can still be created.
+     *
+     */
+    const lv_image_dsc_t *phone_app_squareline_get_image(const char *name)
+    {
+        static const lv_image_dsc_t empty_image = {
+            .header = {
+                .magic = LV_IMAGE_HEADER_MAGIC,
+                .cf = LV_COLOR_FORMAT_ARGB8888,
+            },
+        };
+
+        ESP_UTILS_CHECK_FALSE_RETURN(SquarelineDemo::beginAssets(), &empty_image, "Begin assets failed");
+
+        auto image = LvAssets::getInstance().getImage(name);
+        ESP_UTILS_CHECK_NULL_RETURN(image, &empty_image, "Image(%s) not found", name);
+
+        return image;
+    }
+
+    const lv_font_t *phone_app_squareline_get_font(const char *name)
+    {
+        ESP_UTILS_CHECK_FALSE_RETURN(SquarelineDemo::beginAssets(), LV_FONT_DEFAULT, "Begin assets failed");
+
+        auto font = LvAssets::getInstance().getFont(name);
+        ESP_UTILS_CHECK_NULL_RETURN(font, LV_FONT_DEFAULT, "Font(%s) not found", name);
+
+        return font;
+    }
+#endif // CONFIG_ESP_BROOKESIA_APP_SQUARELINE_DEMO_ENABLE_ASSETS_PARTITION
+
 } // extern "C"
 
 ESP_UTILS_REGISTER_PLUGIN_WITH_CONSTRUCTOR(systems::base::App, SquarelineDemo, APP_NAME, []()
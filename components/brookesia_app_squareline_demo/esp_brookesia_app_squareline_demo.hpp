@@ -5,8 +5,15 @@
  */
 #pragma once
 
+#include <string>
+#include "boost/signals2.hpp"
 #include "systems/phone/esp_brookesia_phone_app.hpp"
+#include "gui/lvgl/esp_brookesia_lv_refresh_monitor.hpp"
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+#   include "gui/watchface/esp_brookesia_watchface.hpp"
+#endif
 #include "SensorPCF85063.hpp"
+#include "esp_brookesia_app_squareline_hand_sprites.hpp"
 
 namespace esp_brookesia::apps {
 
@@ -21,11 +28,66 @@ public:
     using systems::phone::App::startRecordResource;
     using systems::phone::App::endRecordResource;
 
+    /**
+     * @brief Map the assets partition of the images and fonts, otherwise done by the first image or font requested.
+     *        It doesn't need LVGL, so it can be called early from any task. Always true if the partition is disabled
+     */
+    static bool beginAssets();
+
+    /**
+     * @brief Switch the watchface to the ambient mode: black background, reduced palette, no seconds hand and only
+     *        one update per minute
+     */
+    bool setAmbientMode(bool enable);
+    bool isAmbientMode() const
+    {
+        return ambient_mode;
+    }
+    /**
+     * @brief Point a clock hand to an angle, also used by the intro animations of the hands
+     *
+     * @param[in] hand Image object of the hand
+     * @param[in] angle Angle in 0.1 degree
+     */
+    bool setClockHandAngle(lv_obj_t *hand, int32_t angle);
+    /**
+     * @brief Switch the seconds hand to a smooth sweep at 30 fps. It falls back to a tick per second while the
+     *        frames are over budget or the watchface is in the ambient mode
+     */
+    bool setSweepMode(bool enable);
+    bool isSweepMode() const
+    {
+        return sweep_mode;
+    }
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+    /**
+     * @brief Replace the SquareLine watchface with a binary face, shown instead of the clock widgets. The face is
+     *        kept across the runs of the app
+     *
+     * @param[in] path Name of a face packed into the assets partition (e.g. `analog` for `watchfaces/analog.json`),
+     *                 or absolute path of a face file on a mounted filesystem. `nullptr` to go back to the SquareLine
+     *                 watchface
+     */
+    bool setWatchface(const char *path);
+    const std::string &getWatchfacePath() const
+    {
+        return watchface_path;
+    }
+    /**
+     * @brief Set the value shown by the complications of the binary faces with this ID, from 0 to 100, e.g. a battery
+     *        level. It's kept when the face is switched
+     */
+    void setWatchfaceComplication(uint8_t id, uint8_t value);
+#endif
+
 protected:
     SquarelineDemo(bool use_status_bar, bool use_navigation_bar);
     
     bool run(void) override;
     bool back(void) override;
+    bool close(void) override;
+    bool pause(void) override;
+    bool resume(void) override;
 
 private:
     static SquarelineDemo *_instance;
@@ -34,11 +96,52 @@ private:
     bool rtc_initialized;
     
     static void update_clock_callback(lv_timer_t *timer);
+    static void sweep_frame_callback(lv_timer_t *timer);
     void updateClockHands();
-    static void IRAM_ATTR button_isr_handler(void* arg);
-    static void button_task(void* arg);
-    gpio_num_t button_gpio;
-    bool display_sleeping;
+    void updateClockTimerPeriod(int second);
+    void setForeground(bool foreground);
+    bool beginClockHandSprites();
+    void dumpClockTickStats();
+    void updateSweepState();
+    void updateSweepFrame();
+    void syncSweepTime(int second);
+    int32_t getSweepTimeMs(int64_t now_us) const;
+    void resetSweepStats();
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+    bool beginWatchface();
+    void delWatchface();
+    void updateWatchface(const RTC_DateTime &dt);
+#endif
+
+    bool foreground;
+    bool ambient_mode;
+    gui::LvRefreshMonitorUniquePtr refresh_monitor;
+    boost::signals2::scoped_connection power_state_connection;
+    ClockHandSprites hour_hand_sprites;
+    ClockHandSprites min_hand_sprites;
+    ClockHandSprites sec_hand_sprites;
+    ClockHandSprites sec_sweep_hand_sprites;
+    lv_timer_t *sweep_timer;
+    bool sweep_mode;
+    bool is_sweeping;
+    bool is_sweep_over_budget;
+    uint32_t sweep_overrun_count;       /*!< Consecutive frames over budget */
+    int64_t sweep_time_base_us;         /*!< Time of the last synchronization with the RTC */
+    int32_t sweep_time_base_ms;         /*!< Milliseconds of the minute at `sweep_time_base_us` */
+    struct {
+        uint32_t frame_count;
+        uint32_t fallback_count;
+        int64_t last_frame_us;
+        uint64_t interval_us_total;
+        uint64_t jitter_us_total;       /*!< Deviation of the frame intervals from the frame period */
+        uint32_t jitter_us_max;
+        uint64_t handler_us_start;      /*!< Time spent by the LVGL scheduler at the start */
+        int64_t start_us;
+    } sweep_stats;
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+    std::string watchface_path;
+    gui::Watchface watchface;
+#endif
 };
 
 } // namespace esp_brookesia::apps
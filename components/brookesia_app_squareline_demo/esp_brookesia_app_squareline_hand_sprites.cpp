@@ -0,0 +1,297 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include <cmath>
+#include "esp_heap_caps.h"
+#ifdef ESP_UTILS_LOG_TAG
+#   undef ESP_UTILS_LOG_TAG
+#endif
+#define ESP_UTILS_LOG_TAG "BS:Squareline"
+#include "esp_lib_utils.h"
+#include "esp_brookesia_app_squareline_hand_sprites.hpp"
+
+namespace esp_brookesia::apps {
+
+ClockHandSprites::ClockHandSprites(const lv_image_dsc_t &hand, uint16_t angle_num):
+    _hand(hand),
+    _angle_num(angle_num)
+{
+}
+
+ClockHandSprites::~ClockHandSprites()
+{
+    if (_data != nullptr) {
+        heap_caps_free(_data);
+    }
+}
+
+bool ClockHandSprites::begin()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isValid(), false, "Already begun");
+    ESP_UTILS_CHECK_FALSE_RETURN(_angle_num > 0, false, "Invalid angle number");
+
+    auto &header = _hand.header;
+    int32_t w = header.w;
+    int32_t h = header.h;
+    ESP_UTILS_CHECK_FALSE_RETURN(header.cf == LV_COLOR_FORMAT_RGB565A8, false, "Only RGB565A8 hands are supported");
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (header.stride == 0) || (header.stride == w * 2), false, "Padded hands are not supported"
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(_hand.data_size >= static_cast<uint32_t>(w * h * 3), false, "Invalid hand data");
+
+    // The alpha plane follows the RGB565 plane, the hand color is the one of its first opaque pixel
+    auto colors = reinterpret_cast<const uint16_t *>(_hand.data);
+    auto alpha = _hand.data + w * h * 2;
+    _opaque_area = {w, h, -1, -1};
+    for (int32_t y = 0; y < h; y++) {
+        for (int32_t x = 0; x < w; x++) {
+            if (alpha[y * w + x] == 0) {
+                continue;
+            }
+            if (_opaque_area.x2 < 0) {
+                uint16_t color = colors[y * w + x];
+                _color = lv_color_make(((color >> 11) & 0x1F) << 3, ((color >> 5) & 0x3F) << 2, (color & 0x1F) << 3);
+            }
+            _opaque_area.x1 = std::min(_opaque_area.x1, x);
+            _opaque_area.y1 = std::min(_opaque_area.y1, y);
+            _opaque_area.x2 = std::max(_opaque_area.x2, x);
+            _opaque_area.y2 = std::max(_opaque_area.y2, y);
+        }
+    }
+    ESP_UTILS_CHECK_FALSE_RETURN(_opaque_area.x2 >= 0, false, "Hand is transparent");
+
+    // Pack all the sprites in one block, their sizes are known before rotating them
+    ESP_UTILS_CHECK_EXCEPTION_RETURN(_sprites.resize(_angle_num), false, "Allocate sprites failed");
+    size_t data_size = 0;
+    for (int32_t i = 0; i < _angle_num; i++) {
+        lv_area_t area = {};
+        rotate(i, area, nullptr);
+        ESP_UTILS_CHECK_FALSE_RETURN(lv_area_get_width(&area) <= UINT8_MAX, false, "Hand is too long");
+        data_size += lv_area_get_size(&area);
+    }
+    auto data = static_cast<uint8_t *>(heap_caps_malloc(data_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    if (data == nullptr) {
+        _sprites.clear();
+        ESP_UTILS_CHECK_NULL_RETURN(data, false, "Allocate sprite data(%d) failed", static_cast<int>(data_size));
+    }
+
+    auto buf = data;
+    for (int32_t i = 0; i < _angle_num; i++) {
+        lv_area_t area = {};
+        rotate(i, area, buf);
+
+        auto &sprite = _sprites[i];
+        uint32_t sprite_w = lv_area_get_width(&area);
+        uint32_t sprite_h = lv_area_get_height(&area);
+        sprite.image = {};
+        sprite.image.header.magic = LV_IMAGE_HEADER_MAGIC;
+        sprite.image.header.cf = LV_COLOR_FORMAT_A8;
+        sprite.image.header.w = sprite_w;
+        sprite.image.header.h = sprite_h;
+        sprite.image.header.stride = sprite_w;
+        sprite.image.data_size = sprite_w * sprite_h;
+        sprite.image.data = buf;
+        sprite.x = area.x1;
+        sprite.y = area.y1;
+        updateBands(sprite);
+        buf += sprite.image.data_size;
+    }
+    _data = data;
+    _data_size = data_size;
+
+    return true;
+}
+
+bool ClockHandSprites::attach(lv_obj_t *image)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isValid(), false, "Not begun");
+    ESP_UTILS_CHECK_NULL_RETURN(image, false, "Invalid image");
+
+    // The hand image is rotated around its center, which stays at the same place in the parent
+    lv_obj_update_layout(image);
+    _pivot.x = lv_obj_get_x(image) + _hand.header.w / 2;
+    _pivot.y = lv_obj_get_y(image) + _hand.header.h / 2;
+    _image = image;
+    _sprite = nullptr;
+
+    // A8 images are drawn with the recolor
+    int32_t angle = lv_image_get_rotation(image);
+    lv_image_set_rotation(image, 0);
+    lv_obj_set_align(image, LV_ALIGN_TOP_LEFT);
+    lv_obj_set_style_image_recolor(image, _color, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_image_recolor_opa(image, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    return setAngle(angle);
+}
+
+bool ClockHandSprites::takeOver(ClockHandSprites &other)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isValid(), false, "Not begun");
+    ESP_UTILS_CHECK_NULL_RETURN(other._image, false, "Other sprites are not attached");
+    ESP_UTILS_CHECK_FALSE_RETURN(&other._hand == &_hand, false, "Other sprites are of another hand");
+
+    _image = other._image;
+    _pivot = other._pivot;
+    _sprite = nullptr;
+    other.detach();
+
+    return true;
+}
+
+void ClockHandSprites::detach()
+{
+    _image = nullptr;
+    _sprite = nullptr;
+}
+
+bool ClockHandSprites::setAngle(int32_t angle)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(_image, false, "Not attached");
+
+    angle %= 3600;
+    if (angle < 0) {
+        angle += 3600;
+    }
+    auto &sprite = _sprites[((angle * _angle_num + 1800) / 3600) % _angle_num];
+    if (_sprite == &sprite) {
+        return true;
+    }
+
+    // What the image showed before the first sprite (e.g. the rotated hand) is unknown, leave it to LVGL
+    if (_sprite == nullptr) {
+        lv_image_set_src(_image, &sprite.image);
+        lv_obj_set_pos(_image, _pivot.x + sprite.x, _pivot.y + sprite.y);
+        _sprite = &sprite;
+        return true;
+    }
+
+    // Apply the pending layout changes of the other objects first, they must invalidate their areas as usual
+    auto display = lv_obj_get_display(_image);
+    lv_obj_update_layout(_image);
+    lv_area_t old_coords = {};
+    lv_obj_get_coords(_image, &old_coords);
+
+    lv_display_enable_invalidation(display, false);
+    lv_image_set_src(_image, &sprite.image);
+    lv_obj_set_pos(_image, _pivot.x + sprite.x, _pivot.y + sprite.y);
+    lv_obj_update_layout(_image);
+    lv_display_enable_invalidation(display, true);
+
+    lv_area_t new_coords = {};
+    lv_obj_get_coords(_image, &new_coords);
+    if (!lv_obj_has_flag(_image, LV_OBJ_FLAG_HIDDEN)) {
+        invalidate(*_sprite, old_coords);
+        invalidate(sprite, new_coords);
+        _stats.bbox_px += lv_area_get_size(&old_coords) + lv_area_get_size(&new_coords);
+    }
+    _sprite = &sprite;
+
+    return true;
+}
+
+void ClockHandSprites::updateBands(Sprite &sprite) const
+{
+    int32_t w = sprite.image.header.w;
+    int32_t h = sprite.image.header.h;
+    for (int32_t i = 0; i < BAND_NUM; i++) {
+        int32_t x1 = UINT8_MAX;
+        int32_t x2 = 0;
+        for (int32_t y = h * i / BAND_NUM; y < h * (i + 1) / BAND_NUM; y++) {
+            auto row = sprite.image.data + y * w;
+            for (int32_t x = 0; x < w; x++) {
+                if (row[x] != 0) {
+                    x1 = std::min(x1, x);
+                    x2 = std::max(x2, x);
+                }
+            }
+        }
+        sprite.band_x1[i] = x1;
+        sprite.band_x2[i] = x2;
+    }
+}
+
+void ClockHandSprites::invalidate(const Sprite &sprite, const lv_area_t &coords)
+{
+    // The parent clips the areas, as the image object may have moved away from them
+    auto parent = lv_obj_get_parent(_image);
+    int32_t h = sprite.image.header.h;
+    for (int32_t i = 0; i < BAND_NUM; i++) {
+        if (sprite.band_x1[i] > sprite.band_x2[i]) {
+            continue;
+        }
+        lv_area_t area = {
+            coords.x1 + sprite.band_x1[i], coords.y1 + h * i / BAND_NUM,
+            coords.x1 + sprite.band_x2[i], coords.y1 + h * (i + 1) / BAND_NUM - 1,
+        };
+        lv_obj_invalidate_area(parent, &area);
+        _stats.invalidated_px += lv_area_get_size(&area);
+    }
+}
+
+void ClockHandSprites::rotate(int32_t index, lv_area_t &area, uint8_t *buf) const
+{
+    int32_t w = _hand.header.w;
+    int32_t h = _hand.header.h;
+    int32_t pivot_x = w / 2;
+    int32_t pivot_y = h / 2;
+    float radian = 2 * static_cast<float>(M_PI) * index / _angle_num;
+    float cos_value = std::cos(radian);
+    float sin_value = std::sin(radian);
+
+    // Bounding box of the rotated opaque area, with one more pixel around for the interpolation
+    float x_min = INFINITY;
+    float y_min = INFINITY;
+    float x_max = -INFINITY;
+    float y_max = -INFINITY;
+    const int32_t corners_x[] = {_opaque_area.x1, _opaque_area.x2};
+    const int32_t corners_y[] = {_opaque_area.y1, _opaque_area.y2};
+    for (auto x : corners_x) {
+        for (auto y : corners_y) {
+            float rel_x = x - pivot_x;
+            float rel_y = y - pivot_y;
+            float rot_x = rel_x * cos_value - rel_y * sin_value;
+            float rot_y = rel_x * sin_value + rel_y * cos_value;
+            x_min = std::min(x_min, rot_x);
+            y_min = std::min(y_min, rot_y);
+            x_max = std::max(x_max, rot_x);
+            y_max = std::max(y_max, rot_y);
+        }
+    }
+    area.x1 = static_cast<int32_t>(std::floor(x_min)) - 1;
+    area.y1 = static_cast<int32_t>(std::floor(y_min)) - 1;
+    area.x2 = static_cast<int32_t>(std::ceil(x_max)) + 1;
+    area.y2 = static_cast<int32_t>(std::ceil(y_max)) + 1;
+    if (buf == nullptr) {
+        return;
+    }
+
+    // Bilinear sampling of the alpha plane at the position rotated back
+    auto alpha = _hand.data + w * h * 2;
+    auto get_alpha = [&](int32_t x, int32_t y) -> int32_t {
+        return ((x < 0) || (x >= w) || (y < 0) || (y >= h)) ? 0 : alpha[y * w + x];
+    };
+    for (int32_t y = area.y1; y <= area.y2; y++) {
+        for (int32_t x = area.x1; x <= area.x2; x++) {
+            float src_x = x * cos_value + y * sin_value + pivot_x;
+            float src_y = -x * sin_value + y * cos_value + pivot_y;
+            int32_t x0 = static_cast<int32_t>(std::floor(src_x));
+            int32_t y0 = static_cast<int32_t>(std::floor(src_y));
+            float fx = src_x - x0;
+            float fy = src_y - y0;
+            float top = get_alpha(x0, y0) * (1 - fx) + get_alpha(x0 + 1, y0) * fx;
+            float bottom = get_alpha(x0, y0 + 1) * (1 - fx) + get_alpha(x0 + 1, y0 + 1) * fx;
+            *buf++ = static_cast<uint8_t>(top * (1 - fy) + bottom * fy + 0.5f);
+        }
+    }
+}
+
+} // namespace esp_brookesia::apps
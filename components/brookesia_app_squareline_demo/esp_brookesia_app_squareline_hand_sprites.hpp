@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <vector>
+#include "lvgl.h"
+
+namespace esp_brookesia::apps {
+
+/**
+ * @brief Clock hand pre-rotated to every angle it can show, as A8 masks in PSRAM drawn with the hand color. Showing
+ *        an angle only swaps the image source, instead of rotating the hand on every refresh of its area
+ *
+ * @note  The hand image should be a single color `RGB565A8` image, rotated around its center
+ */
+class ClockHandSprites {
+public:
+    struct Stats {
+        uint32_t invalidated_px;    /*!< Area invalidated by the angle changes */
+        uint32_t bbox_px;           /*!< Area of the old and new sprites, as invalidated by the image object */
+    };
+
+    /**
+     * @param[in] hand Image of the hand pointing to 12 o'clock
+     * @param[in] angle_num Number of angles over a turn, e.g. 60 for the minute hand, 720 for the hour hand
+     */
+    ClockHandSprites(const lv_image_dsc_t &hand, uint16_t angle_num);
+    ~ClockHandSprites();
+
+    ClockHandSprites(const ClockHandSprites &) = delete;
+    ClockHandSprites &operator=(const ClockHandSprites &) = delete;
+
+    /**
+     * @brief Rotate the hand to every angle
+     */
+    bool begin();
+    /**
+     * @brief Make an image object created with the hand image show the sprites. It should be called again once the
+     *        object is recreated
+     */
+    bool attach(lv_obj_t *image);
+    /**
+     * @brief Take over the image attached to other sprites of the same hand, e.g. with more angles
+     */
+    bool takeOver(ClockHandSprites &other);
+    void detach();
+    /**
+     * @brief Show the sprite of the nearest angle. Only the bands of rows covered by the old and new hands are
+     *        invalidated, instead of their whole bounding boxes
+     *
+     * @param[in] angle Angle in 0.1 degree, clockwise from 12 o'clock
+     */
+    bool setAngle(int32_t angle);
+
+    bool isValid() const
+    {
+        return (_data != nullptr);
+    }
+    bool isAttached(const lv_obj_t *image) const
+    {
+        return (image != nullptr) && (image == _image);
+    }
+    size_t getMemorySize() const
+    {
+        return _data_size + _sprites.size() * sizeof(Sprite);
+    }
+    const Stats &getStats() const
+    {
+        return _stats;
+    }
+    void resetStats()
+    {
+        _stats = {};
+    }
+
+private:
+    static constexpr int32_t BAND_NUM = 4;
+
+    struct Sprite {
+        lv_image_dsc_t image;
+        int16_t x;      /*!< Position of the top left pixel relative to the pivot */
+        int16_t y;
+        uint8_t band_x1[BAND_NUM];  /*!< Columns of the opaque pixels in every band of rows, empty if `x1 > x2` */
+        uint8_t band_x2[BAND_NUM];
+    };
+
+    void rotate(int32_t index, lv_area_t &area, uint8_t *buf) const;
+    void updateBands(Sprite &sprite) const;
+    void invalidate(const Sprite &sprite, const lv_area_t &coords);
+
+    const lv_image_dsc_t &_hand;
+    uint16_t _angle_num;
+    lv_area_t _opaque_area = {};    /*!< Opaque part of the hand image */
+    lv_color_t _color = {};
+    uint8_t *_data = nullptr;
+    size_t _data_size = 0;
+    std::vector<Sprite> _sprites;
+    lv_obj_t *_image = nullptr;
+    const Sprite *_sprite = nullptr;    /*!< Sprite shown by the attached image */
+    lv_point_t _pivot = {};         /*!< Pivot of the attached image in its parent */
+    Stats _stats = {};
+};
+
+} // namespace esp_brookesia::apps
@@ -7,6 +7,7 @@
  * Size: 66 px
  * Bpp: 4
  * Opts: --bpp 4 --size 66 --font C:/!SVN/SquareLine/trunk/code/editor/examples/Smart_Gadget_240x320/assets/fonts/FuturaStdCondensedLightObl.otf -o C:/!SVN/SquareLine/trunk/code/editor/examples/Smart_Gadget_240x320/assets/fonts\ui_font_Number.c --format lvgl -r 0x20-0x7f --symbols 1234567890:° --no-compress --no-prefilter
+ * Subset by lv_font_subset.py:  -0123456789:°
  ******************************************************************************/
 
 #include "../ui.h"
@@ -25,6883 +26,907 @@
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
-    /* U+0021 "!" */
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x33, 0x31, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+002D "-" */
+    0x1, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xd, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+
+    /* U+0030 "0" */
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x24, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b,
+    0xff, 0xff, 0xfc, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfc, 0x41, 0x4,
+    0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xfa, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xf4, 0x0, 0x0,
+    0x3, 0xef, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xf4, 0x0, 0x6,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xff, 0xff, 0xfe, 0xdf, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf7,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xa2, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x41, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x57, 0x30,
-    0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x67, 0x64, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 
-    /* U+0022 "\"" */
-    0x0, 0x8f, 0xff, 0xf6, 0x0, 0x6f, 0xff, 0xf8,
-    0x0, 0xaf, 0xff, 0xf3, 0x0, 0x8f, 0xff, 0xf5,
-    0x0, 0xbf, 0xff, 0xf0, 0x0, 0x9f, 0xff, 0xf2,
-    0x0, 0xdf, 0xff, 0xd0, 0x0, 0xbf, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0xa0, 0x0, 0xdf, 0xff, 0xc0,
-    0x1, 0xff, 0xff, 0x70, 0x0, 0xff, 0xff, 0x90,
-    0x3, 0xff, 0xff, 0x40, 0x1, 0xff, 0xff, 0x60,
-    0x5, 0xff, 0xff, 0x10, 0x3, 0xff, 0xff, 0x30,
-    0x7, 0xff, 0xfe, 0x0, 0x5, 0xff, 0xff, 0x0,
-    0x9, 0xff, 0xfb, 0x0, 0x7, 0xff, 0xfd, 0x0,
-    0xa, 0xff, 0xf8, 0x0, 0x8, 0xff, 0xfa, 0x0,
-    0xc, 0xff, 0xf5, 0x0, 0xa, 0xff, 0xf7, 0x0,
-    0xe, 0xff, 0xf2, 0x0, 0xc, 0xff, 0xf4, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0xe, 0xff, 0xf1, 0x0,
-    0x2f, 0xff, 0xc0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x2, 0x22, 0x10, 0x0, 0x2, 0x22, 0x20, 0x0,
+    /* U+0031 "1" */
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x70, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0x6, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x20, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x6, 0x66, 0x66, 0x6c, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0,
 
-    /* U+0023 "#" */
+    /* U+0032 "2" */
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf6, 0x0, 0x1, 0xff, 0xf1,
+    0x0, 0x24, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8e, 0xff,
+    0xff, 0xfd, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xfa, 0x31, 0x3, 0x9f, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x23, 0x33, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x30,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x90, 0x0, 0xd, 0xff, 0x40,
+    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0x30, 0x0, 0x4f, 0xfd, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xfb, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xfc, 0x0, 0x0, 0xaf, 0xf7, 0x0,
+    0xa, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf2,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf6, 0x0, 0x1, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xe0, 0x0, 0x7, 0xff, 0xa0, 0x0,
+    0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf1, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x90, 0x0, 0xd, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xf6, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x20, 0x0, 0x4f, 0xfd, 0x0, 0x0,
+    0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x70,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xfc, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xc0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf5, 0x0, 0x1, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xe0, 0x0, 0x7, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x80, 0x0, 0xd, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x20, 0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xfb, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf5, 0x0, 0x1, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xe0, 0x0, 0x7, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0x66, 0x66, 0x6b, 0xff,
-    0xc6, 0x66, 0x6e, 0xff, 0x96, 0x66, 0x66, 0x20,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0,
-    0x0, 0x6, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x90,
-    0x0, 0xd, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x30,
-    0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfc, 0x0,
-    0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6, 0x0,
-    0x0, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
-    0x6, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x90, 0x0,
-    0xc, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x30, 0x0,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xfc, 0x0, 0x0,
-    0x9f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x26, 0x66, 0x66, 0x7f, 0xff, 0x76, 0x66, 0x9f,
-    0xfe, 0x66, 0x66, 0x66, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xfc, 0x0, 0x0, 0x9f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xe0, 0x0, 0x6, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x80, 0x0, 0xd, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x20, 0x0, 0x4f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0, 0xaf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x1, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xe0, 0x0, 0x7, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x70, 0x0, 0xe, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x10, 0x0, 0x4f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xfa, 0x0, 0x0, 0xbf, 0xf8, 0x0,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xfd,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf4, 0x0, 0x2, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x40, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xd0, 0x0, 0x8, 0xff, 0xb0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x60, 0x0, 0xe, 0xff, 0x50, 0x0,
+    0xef, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfb, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x10, 0x0, 0x5f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0x10, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf9, 0x0, 0x0, 0xcf, 0xf8, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf2,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfa, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0,
 
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xdd, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd,
+    /* U+0033 "3" */
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5a, 0xef, 0xff, 0xed, 0x95,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfa, 0x53, 0x34, 0x7c, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x4c, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xfa,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xe5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xb,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xbf, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xd5, 0x0, 0x0,
-    0x2, 0x9f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xec, 0xab, 0xdf, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x8e, 0xff, 0xff, 0xff,
-    0xff, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x37, 0xbf, 0xff, 0x62, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x0, 0x0, 0x0, 0x15, 0x76, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0x0, 0x0, 0x5, 0xff, 0xd3, 0x18, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80,
-    0x0, 0x0, 0xe, 0xfe, 0x10, 0x0, 0xef, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x9f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0x0,
-    0x0, 0x0, 0xbf, 0xf0, 0x0, 0x0, 0x7f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0,
-    0x0, 0x0, 0xff, 0xb0, 0x0, 0x0, 0x7f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0,
-    0x0, 0x5, 0xff, 0x60, 0x0, 0x0, 0x8f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x20, 0x0, 0x0, 0x8f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0,
-    0x0, 0xd, 0xfe, 0x0, 0x0, 0x0, 0xaf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0x0,
-    0x0, 0xf, 0xfb, 0x0, 0x0, 0x0, 0xcf, 0xf0,
-    0x0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0xef, 0xd0,
-    0x0, 0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf5, 0x0, 0x0, 0x0, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf3, 0x0, 0x0, 0x3, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf1, 0x0, 0x0, 0x6, 0xff, 0x50,
-    0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf0, 0x0, 0x0, 0x8, 0xff, 0x20,
-    0x0, 0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xe0, 0x0, 0x0, 0xc, 0xff, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xfb, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xf5, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xd0, 0x0, 0x0, 0xaf, 0xf1, 0x0,
-    0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xf0, 0x0, 0x1, 0xff, 0xb0, 0x0,
-    0x1, 0xef, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf4, 0x0, 0xa, 0xff, 0x40, 0x0,
-    0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xfd, 0x21, 0x9f, 0xfa, 0x0, 0x0,
-    0x2f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0xff, 0xf9, 0x10, 0x0, 0x5,
+    0x13, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x8e, 0xff, 0xff,
+    0xfc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xe7, 0x20, 0x15,
+    0xdf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x1e, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x1, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
     0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x64, 0x10, 0x0, 0x0, 0xd,
-    0xf4, 0x0, 0x0, 0x1, 0x57, 0x62, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xb0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x20, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0x7f, 0xfc, 0x31, 0x9f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0xe, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0x0, 0x7, 0xff, 0x50, 0x0, 0xb, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0x0, 0xd, 0xfe, 0x0, 0x0, 0x9, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0,
-    0x0, 0x2f, 0xf9, 0x0, 0x0, 0x9, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0, 0x0,
-    0x0, 0x7f, 0xf5, 0x0, 0x0, 0x9, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0,
-    0x0, 0xcf, 0xf1, 0x0, 0x0, 0xa, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0x0, 0xff, 0xd0, 0x0, 0x0, 0xb, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0, 0x0,
-    0x2, 0xff, 0xa0, 0x0, 0x0, 0xd, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x50, 0x0, 0x0,
-    0x5, 0xff, 0x70, 0x0, 0x0, 0xf, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x40, 0x0, 0x0, 0x2f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x20, 0x0, 0x0, 0x5f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xe, 0xfd, 0x0, 0x0, 0x0, 0xaf, 0xf1, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfc, 0x0, 0x0, 0x0, 0xef, 0xe0, 0x0,
-    0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfc, 0x0, 0x0, 0x3, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x7, 0xff, 0x40, 0x0,
-    0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfb, 0x0, 0x0, 0xc, 0xfe, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfd, 0x0, 0x0, 0x3f, 0xfa, 0x0, 0x0,
-    0x0, 0xaf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x20, 0x0, 0xcf, 0xf2, 0x0, 0x0,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xc2, 0x3b, 0xff, 0x90, 0x0, 0x0,
-    0xc, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4e, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x47, 0x51, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0026 "&" */
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfa, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0xdf, 0xfd, 0xa4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xff,
-    0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xf9, 0x64, 0x7d, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xfc, 0x20, 0x0, 0x0, 0xbf, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfa, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x2f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfe, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x40, 0x0,
-    0x9f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x90, 0xa, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xe2, 0xcf, 0xff, 0xfb,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x8f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf4,
+    0x2, 0xcf, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x36, 0xbf, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x34, 0x57, 0xbf, 0xff, 0xff, 0xfd, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xff, 0x60, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0xff, 0xf7, 0xa, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x80, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfb, 0x0,
-    0x0, 0xef, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xd1, 0x0, 0x0,
-    0x8f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x40, 0x0, 0x0, 0x2f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf3, 0x0,
-    0x0, 0x41, 0x0, 0x3, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf9, 0x0, 0x4,
-    0xfc, 0x0, 0x4, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xa0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x43, 0xff, 0xff, 0xf3,
-    0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xbe, 0xff, 0xff, 0x60, 0x4,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x2, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf9, 0x10,
-    0x0, 0x16, 0xdf, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfd, 0xcd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x8f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x70, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x29, 0xff, 0xff, 0xff, 0xfc, 0x70, 0x0,
-    0xa, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x57, 0x64, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0027 "'" */
-    0x0, 0x5f, 0xff, 0xf9, 0x0, 0x7f, 0xff, 0xf6,
-    0x0, 0x8f, 0xff, 0xf3, 0x0, 0xaf, 0xff, 0xf0,
-    0x0, 0xcf, 0xff, 0xd0, 0x0, 0xef, 0xff, 0xa0,
-    0x0, 0xff, 0xff, 0x70, 0x2, 0xff, 0xff, 0x40,
-    0x4, 0xff, 0xff, 0x10, 0x6, 0xff, 0xfe, 0x0,
-    0x7, 0xff, 0xfb, 0x0, 0x9, 0xff, 0xf8, 0x0,
-    0xb, 0xff, 0xf5, 0x0, 0xd, 0xff, 0xf2, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0x2, 0x22, 0x20, 0x0,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0029 ")" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xa, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
     0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x79, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf3,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xb6, 0x0, 0x0,
-    0x0, 0xe, 0xfb, 0x0, 0x0, 0x0, 0x27, 0xc5,
-    0x1f, 0xff, 0xfa, 0x50, 0x0, 0x1f, 0xf8, 0x0,
-    0x2, 0x8d, 0xff, 0xf8, 0x4e, 0xff, 0xff, 0xff,
-    0x94, 0x3f, 0xf6, 0x38, 0xdf, 0xff, 0xff, 0xe7,
-    0x0, 0x49, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x83, 0x0, 0x0, 0x0, 0x4, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xd7, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xfe, 0x72,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0x41, 0xef, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0, 0x6f, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x80, 0x0, 0xd, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x5, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xcf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x2d, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x20, 0x0, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x50,
+    0x0, 0x2f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf5,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf3, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x6f, 0xff, 0xa6, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf9, 0x0,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0x50, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x70, 0x0,
+    0x5, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xed, 0xff, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xff,
+    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x56, 0x76, 0x42, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 
-    /* U+002C "," */
-    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc4, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfc, 0x40, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x90, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+002D "-" */
-    0x1, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0xd, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-
-    /* U+002E "." */
-    0x0, 0x1, 0x43, 0x0, 0x0, 0x6f, 0xff, 0xc0,
-    0x5, 0xff, 0xff, 0xf7, 0xd, 0xff, 0xff, 0xfa,
-    0xf, 0xff, 0xff, 0xf8, 0xe, 0xff, 0xff, 0xf2,
-    0x5, 0xff, 0xfe, 0x40, 0x0, 0x26, 0x51, 0x0,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x67, 0x77, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    /* U+0034 "4" */
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
     0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x24, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b,
-    0xff, 0xff, 0xfc, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfc, 0x41, 0x4,
-    0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xfa, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf4, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf4, 0x0, 0x6,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xfe, 0xdf, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xa2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x67, 0x64, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x70, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x6, 0x66, 0x66, 0x6c, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0032 "2" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x24, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8e, 0xff,
-    0xff, 0xfd, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xfa, 0x31, 0x3, 0x9f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x23, 0x33, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfa, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0,
-
-    /* U+0033 "3" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x13, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x8e, 0xff, 0xff,
-    0xfc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xe7, 0x20, 0x15,
-    0xdf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x1, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xcf, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x36, 0xbf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x34, 0x57, 0xbf, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xbf, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x50, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x70, 0x0,
-    0x5, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xed, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xff,
-    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x56, 0x76, 0x42, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xdf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xad, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf3, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xf9, 0x4f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x18, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x80, 0xcf,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf1, 0xf, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf8, 0x3,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xfe, 0x0, 0x6f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x70,
-    0xa, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xe0, 0x0, 0xdf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf6,
-    0x0, 0xf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xfe, 0x0, 0x2, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x60, 0x0, 0x5f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xd0, 0x0, 0x7, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf5, 0x0, 0x0, 0xaf, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfd, 0x0, 0x0, 0xc,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x50, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0,
-    0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf4, 0x0, 0x0, 0x3, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x8, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf7,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xfd, 0xdf, 0xfd,
-    0xa6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfe, 0xb9, 0x9b, 0xef,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0x20, 0x0, 0x0, 0x5, 0xef, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xe4, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xb6,
-    0x31, 0x25, 0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf, 0xff,
-    0xff, 0xff, 0xe8, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x77, 0x53,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0, 0x5a, 0xdf,
-    0xda, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x9d, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8, 0x42, 0x49,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x6f, 0xff, 0xfd, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0x10, 0x0, 0x8, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40,
-    0x0, 0xd, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x50, 0x0, 0x3f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x60,
-    0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x60, 0x0, 0xaf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x50,
-    0x0, 0xef, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x40, 0x1, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x30,
-    0x5, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0x10, 0x7, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0,
-    0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xfb, 0x0, 0xb, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf7, 0x0,
-    0xb, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf4, 0x0, 0xb, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0,
-    0xb, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xb0, 0x0, 0x9, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x50, 0x0,
-    0x7, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfe, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xfe, 0x50, 0x0, 0x2b, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xdf, 0xff, 0xff, 0xfd, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x57, 0x75, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x2d, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x13, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x39, 0xef, 0xff, 0xff,
-    0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xfc, 0x51, 0x3, 0xaf, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x10, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xfd, 0x10, 0x0, 0x2, 0xdf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xfe, 0x85, 0x6a, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf9, 0x30, 0x26, 0xef,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xf3, 0x0, 0x0, 0x1, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xc0, 0x0, 0x0, 0x8, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0,
-    0x0, 0xf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0,
-    0x0, 0xa, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0xcf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf0, 0x0, 0x0, 0xe, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x70, 0x0, 0x0, 0xe,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc2, 0x0,
-    0x5, 0xdf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xa4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x14, 0x67, 0x53, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x42,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x9e, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf8, 0x30, 0x26, 0xef, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x1f, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x2e, 0xff, 0xff, 0x50, 0x0, 0x0, 0x8f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xa0,
-    0x0, 0x1, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xc0, 0x0, 0x6, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xe0,
-    0x0, 0xb, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0,
-    0x0, 0x4f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0,
-    0x0, 0xbf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xb0, 0x0, 0xef, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x90,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x60, 0x1, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x20,
-    0x2, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0,
-    0x2, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf7, 0x0, 0x1, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xdf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x9f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xb4, 0x23, 0x7e, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xf9, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9c,
-    0xfe, 0xb8, 0x19, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x0, 0x0, 0x0, 0x0, 0x57, 0x30, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xff, 0x60, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x34, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x43, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x5, 0xff, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x2, 0x65, 0x10, 0x0,
-    0x0, 0x0,
-
-    /* U+003B ";" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x57, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x34, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5d, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xcf, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2b, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x9f, 0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xff, 0xff,
-    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xfa, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4d, 0xff, 0xff, 0xb3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a,
-    0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
-    0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xd5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xfe, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xdf, 0xff, 0xe7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xef, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xaf, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xdf, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3d, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xcf, 0xff, 0xfe, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2c, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xb1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003D "=" */
-    0x0, 0x5, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-
-    /* U+003E ">" */
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xfc,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xef, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
-    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xdf, 0xff, 0xf8, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xcf, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xcf,
-    0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff, 0xfc,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xaf, 0xff, 0xfd, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x9f, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xff,
-    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0xff, 0xff, 0xa2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5b, 0xef, 0xff, 0xe9, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x30, 0x17, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x4, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x8f, 0xff, 0xf4, 0x0, 0x0, 0xa,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x3f, 0xff, 0xf5,
-    0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf5, 0x0, 0x0, 0x3f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf4, 0x0, 0x0,
-    0x6f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf2, 0x0, 0x0, 0xaf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf1, 0x0, 0x0, 0xdf, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0,
-    0x0, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xc0, 0x0, 0x0, 0x44, 0x44, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14,
-    0x9f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfe, 0xc7, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44,
-    0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x34, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3d, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x62, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x57,
-    0x78, 0x86, 0x53, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x27, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x29, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3b, 0xff, 0xff, 0xff, 0xfc,
-    0x75, 0x42, 0x10, 0x13, 0x47, 0xbf, 0xff, 0xff,
-    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xfa, 0x51, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xaf, 0xff, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x29, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x8c, 0xef, 0xec, 0x93, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6c, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x6, 0xaa, 0xa1, 0x0, 0xb, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0xef,
-    0xfa, 0x0, 0x0, 0x3f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xfc, 0x85, 0x45,
-    0xaf, 0xff, 0xf8, 0x6f, 0xff, 0x30, 0x0, 0x0,
-    0xcf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xff, 0xb3, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xfd,
-    0xff, 0xb0, 0x0, 0x0, 0x9, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x20, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x50, 0x0, 0x0,
-    0x8, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0xdf, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x0,
-    0x0, 0x2f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xd0, 0x0, 0x0, 0x5, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x40, 0x0, 0x0, 0xc, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xef, 0xf9, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x70, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x10, 0x0, 0x0, 0x2, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x50, 0x0, 0x0, 0xb, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0xef, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfb,
-    0x0, 0x0, 0x1, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xd0, 0x0, 0x0, 0x1f,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x10, 0x0, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf7, 0x0, 0x0,
-    0xc, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xd0, 0x0, 0x0, 0x8f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x3c, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x30,
-    0x0, 0x1, 0xff, 0xff, 0xfc, 0x63, 0x34, 0x7d,
-    0xff, 0xfd, 0xef, 0xff, 0x73, 0x37, 0xbf, 0xff,
-    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xfc, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x1, 0x33,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf7, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa3, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0x82, 0x0, 0x2, 0xef, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf3, 0x0, 0x0,
-    0x1, 0x7c, 0xef, 0xed, 0xa6, 0x10, 0x0, 0x0,
-    0x29, 0xdf, 0xfd, 0xa6, 0x0, 0x0, 0x4, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xff,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4b, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xd8, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x38, 0xdf, 0xff, 0xff,
-    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff,
-    0xff, 0xff, 0xd9, 0x65, 0x32, 0x12, 0x35, 0x7a,
-    0xef, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x29, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x56, 0x77, 0x76,
-    0x53, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xdf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf8, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x4f, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xc4, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x4f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x35, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf0, 0x5f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfa, 0x6, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x60,
-    0x6f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf2, 0x6, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfd,
-    0x0, 0x7f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0x90, 0x7, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf4, 0x0, 0x6f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x6, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xa0, 0x0, 0x6f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf6, 0x0, 0x6,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x10, 0x0, 0x6f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0,
-    0x5, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf7, 0x0, 0x0, 0x5f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x20,
-    0x0, 0x5, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xe0, 0x0, 0x0, 0x5f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf9,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x40, 0x0, 0x0, 0x4f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x4, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x11,
-    0x11, 0x11, 0x11, 0x4f, 0xff, 0xf7, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0xbf, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x1f, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfb, 0x0, 0x6, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0xcf,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfd, 0x0, 0x1f, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x7,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfe, 0x0, 0xcf, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0x2f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0x7, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xf0, 0xdf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0x10,
-
-    /* U+0042 "B" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xed, 0xcb, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xc0, 0x1,
-    0x24, 0x8f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x30, 0x0, 0x0, 0xb, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0x10, 0x1, 0x26, 0xef, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0,
-    0x14, 0x7e, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x50,
-    0x11, 0x36, 0xbf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xee, 0xda, 0x74, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x67, 0x86, 0x41, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x19, 0xef, 0xff, 0xff,
-    0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xc5, 0x10, 0x13, 0x9f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x2, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x7, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfe,
-    0x83, 0x12, 0x48, 0xef, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xfc, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x67, 0x65, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0044 "D" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xed, 0xb8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xc4, 0x56, 0x8c, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x4d, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x74, 0x67, 0x9e,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xfe, 0xdc, 0xb7, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xc4, 0x44, 0x44, 0x44, 0x44, 0x43, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0x54, 0x44, 0x44, 0x44, 0x44, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x84, 0x44, 0x44, 0x44, 0x44, 0x41,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0046 "F" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xc4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0x54, 0x44, 0x44, 0x44, 0x44, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x37, 0x89, 0x86, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff,
-    0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xf9, 0x41, 0x15, 0xef, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xd3, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfe, 0x82, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x74, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf6, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xf1, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xc,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x4, 0x44, 0x44, 0x4a, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x1f, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xa0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0xa, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xb4, 0x21,
-    0x38, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x76,
-    0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0048 "H" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x94, 0x44, 0x44, 0x44, 0x44, 0x46, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0049 "I" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
     0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x3,
-    0x10, 0x0, 0x0, 0xe, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xe3, 0x0, 0x0, 0xaf, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb8,
-    0x9d, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7, 0xdf,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x56, 0x76, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+004B "K" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x7f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xf0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x3,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0xcf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x50, 0x0, 0x6f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf3, 0x0, 0xe, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x0,
-    0x8, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x2, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xfb, 0x0, 0xbf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x90, 0x4f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf6, 0xd, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x47,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf3, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xaf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xdf,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf6, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x3d, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf0, 0x9f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xfe, 0x5, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xb0,
-    0x2f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf9, 0x0, 0xef,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x60, 0xa, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf4, 0x0, 0x6f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x10, 0x3, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfd, 0x0, 0x0,
-    0xbf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x8, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf8, 0x0, 0x0, 0x4f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+004C "L" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x74, 0x44, 0x44, 0x44, 0x44, 0x40, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70,
-
-    /* U+004D "M" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xef, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xcd, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xfa, 0xef, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x7e, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xc7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf4, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf9, 0x9f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x1f, 0xff, 0x30, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x5a, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xe0, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf0, 0xbf, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xfa, 0xf, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x8f, 0xfc, 0xc, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x70,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0xe, 0xff, 0x70,
-    0xdf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf3, 0xf, 0xff, 0x30, 0x0, 0x0, 0x3,
-    0xff, 0xf3, 0xe, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x0, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x8f, 0xfe, 0x0, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xb0, 0xf,
-    0xff, 0x30, 0x0, 0x0, 0xd, 0xff, 0x90, 0xf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xf7, 0x0, 0xff, 0xf2, 0x0, 0x0, 0x2, 0xff,
-    0xf4, 0x1, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x20, 0xf, 0xff, 0x20, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x2f, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xe0, 0x0, 0xff,
-    0xf2, 0x0, 0x0, 0xc, 0xff, 0xa0, 0x3, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf9,
-    0x0, 0xf, 0xff, 0x20, 0x0, 0x1, 0xff, 0xf5,
-    0x0, 0x4f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x50, 0x1, 0xff, 0xf2, 0x0, 0x0,
-    0x6f, 0xff, 0x0, 0x5, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf1, 0x0, 0x1f, 0xff,
-    0x20, 0x0, 0xc, 0xff, 0xa0, 0x0, 0x6f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfc, 0x0,
-    0x1, 0xff, 0xf2, 0x0, 0x1, 0xff, 0xf5, 0x0,
-    0x7, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x80, 0x0, 0x1f, 0xff, 0x20, 0x0, 0x6f,
-    0xff, 0x0, 0x0, 0x8f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf3, 0x0, 0x1, 0xff, 0xf2,
-    0x0, 0xb, 0xff, 0xb0, 0x0, 0x9, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x0, 0x0,
-    0x1f, 0xff, 0x10, 0x0, 0xff, 0xf6, 0x0, 0x0,
-    0xaf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xa0, 0x0, 0x1, 0xff, 0xf1, 0x0, 0x5f, 0xff,
-    0x10, 0x0, 0xb, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf6, 0x0, 0x0, 0x2f, 0xff, 0x10,
-    0xa, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff, 0x40,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x20, 0x0, 0x2,
-    0xff, 0xf1, 0x0, 0xff, 0xf6, 0x0, 0x0, 0xd,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xd0,
-    0x0, 0x0, 0x2f, 0xff, 0x10, 0x4f, 0xff, 0x10,
-    0x0, 0x0, 0xef, 0xff, 0x20, 0x0, 0x0, 0xa,
-    0xff, 0xf9, 0x0, 0x0, 0x2, 0xff, 0xf1, 0x9,
-    0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x40, 0x0, 0x0, 0x2f,
-    0xff, 0x10, 0xef, 0xf7, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0,
-    0x0, 0x2, 0xff, 0xf1, 0x2f, 0xff, 0x20, 0x0,
-    0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0, 0x8, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x16, 0xff,
-    0xc0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x70, 0x0, 0x0, 0x3, 0xff,
-    0xf0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf0, 0x0, 0x0, 0x2f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xe, 0xff, 0x20, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0x0, 0x0, 0x6, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf3, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0, 0x0,
-    0xbf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe,
-    0x0, 0x0, 0xf, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfb, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xd0, 0x0, 0x4, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xfd, 0x0, 0x0, 0x9f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xc0,
-    0x0, 0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xfc, 0x0, 0x2, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xb0, 0x0, 0x7f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfb, 0x0,
-    0xc, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x1, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xfa, 0x0, 0x5f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0,
-
-    /* U+004E "N" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xce, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xad, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x8b, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x7a, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x58,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x46, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x24, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x2, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x0, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfd, 0x0, 0xcf, 0xff, 0x10, 0x0, 0x0,
-    0x7f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xfb, 0x0, 0x9f, 0xff, 0x40, 0x0, 0x0, 0xaf,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf9,
-    0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0xcf, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf6, 0x0,
-    0x4f, 0xff, 0x90, 0x0, 0x0, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf4, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf1, 0x0, 0xe, 0xff,
-    0xf0, 0x0, 0x4, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf0, 0x0, 0xc, 0xff, 0xf1,
-    0x0, 0x6, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xc0, 0x0, 0x9, 0xff, 0xf4, 0x0,
-    0x8, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xa0, 0x0, 0x6, 0xff, 0xf7, 0x0, 0xb,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0x70, 0x0, 0x3, 0xff, 0xf9, 0x0, 0xd, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x50,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x20, 0x0,
-    0x0, 0xef, 0xff, 0x0, 0x2f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x10, 0x5f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x40, 0x7f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x70, 0xaf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x90,
-    0xcf, 0xff, 0x30, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0xdf,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xe0, 0xef, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf4, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xf8, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfc, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x56, 0x54, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9e,
-    0xff, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xfa, 0x30, 0x4,
-    0xcf, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x90, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x50, 0x0, 0x0, 0xe, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf3, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x5f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xf0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf3, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x50, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xe6, 0x21, 0x38,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x67, 0x65, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfe,
-    0xdc, 0xb9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xc4, 0x56,
-    0x8b, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x1b,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x20, 0x0, 0x0, 0x2c, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0x54, 0x56, 0x8c, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x81,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xed, 0xb8, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x14, 0x68, 0x75, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b,
-    0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe,
-    0x83, 0x0, 0x4c, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x30, 0x0, 0x2f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x4d,
-    0xf0, 0x0, 0x6f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x1a, 0xff,
-    0xf7, 0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf1, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0x66, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xec, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0x20, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfd, 0x52, 0x13, 0x7e,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xfd,
-    0x71, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x14, 0x67, 0x64, 0x20,
-    0x0, 0x8f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfe,
-    0xdc, 0xb8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xc4, 0x55,
-    0x79, 0xef, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x10, 0x0, 0x3, 0x9f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xcc, 0xcd, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xfa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0xcf, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xe0, 0x8f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xb0, 0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0xf,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x60, 0xb, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x40, 0x7, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x10, 0x2, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x0, 0x0,
-    0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfc, 0x0, 0x0, 0xaf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfa, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7,
-    0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0, 0x0,
-    0xd, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf2, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf0, 0x0,
-    0x0, 0x0,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x57, 0x87, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xdf, 0xff, 0xff, 0xff,
-    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xe8, 0x31, 0x3, 0x6d, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xfd,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xf1, 0x0, 0x0, 0x7, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xa, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x84, 0x21,
-    0x38, 0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3a, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x67,
-    0x75, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0054 "T" */
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x14, 0x44, 0x44, 0x44, 0xef, 0xff,
-    0xd4, 0x44, 0x44, 0x44, 0x10, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xdf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xad, 0xff, 0xf0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xf3, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xf9, 0x4f, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0x18, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x80, 0xcf,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xf1, 0xf, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf8, 0x3,
     0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x3, 0xef, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x73,
-    0x12, 0x49, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29,
-    0xff, 0xff, 0xff, 0xff, 0xb6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35,
-    0x77, 0x54, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x6f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x85, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf3, 0x5f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfd, 0x4, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x80, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf2, 0x3, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfc, 0x0, 0x2f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x70, 0x1,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf1, 0x0, 0xf, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfb, 0x0,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x60, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf1,
-    0x0, 0x0, 0xef, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfb, 0x0, 0x0, 0xe, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0xdf, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0, 0x0, 0xc,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0xb, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xd0, 0x0, 0x0, 0xa, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfe,
-    0x0, 0x0, 0xa, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfe, 0x0, 0x0, 0x5f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf0, 0x0, 0xa,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0,
-    0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x0, 0xa, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0,
-    0x0, 0xef, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x10, 0x4f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf1, 0x9, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x10, 0xef, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf1, 0x3f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x18, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf1, 0xcf, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x1f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf4, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe,
-    0x7f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xeb, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf6, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf1, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xc0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x70, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfc, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf7, 0x0, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf2, 0x0,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xfc, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xd0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf9, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe7, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x20,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xb9, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfd, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x7a, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf8, 0x0, 0x0, 0xef,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x3c,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf3,
-    0x0, 0x0, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xd, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xff, 0x60,
-    0x0, 0x0, 0x1, 0xff, 0xfb, 0xe, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x80, 0x0, 0x0,
-    0xef, 0xff, 0x60, 0x0, 0x0, 0x5, 0xff, 0xf7,
-    0xf, 0xff, 0xa0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0xef, 0xff, 0x60, 0x0, 0x0,
-    0xa, 0xff, 0xf2, 0xf, 0xff, 0xa0, 0x0, 0x0,
-    0x6, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x50, 0x0, 0x0, 0xf, 0xff, 0xd0, 0xf, 0xff,
-    0xa0, 0x0, 0x0, 0xb, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x50, 0x0, 0x0, 0x5f, 0xff,
-    0x70, 0xf, 0xff, 0xa0, 0x0, 0x0, 0xf, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0xef, 0xff, 0x50, 0x0,
-    0x0, 0xaf, 0xff, 0x20, 0xf, 0xff, 0x90, 0x0,
-    0x0, 0x5f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x40, 0x0, 0x0, 0xff, 0xfd, 0x0, 0xf,
-    0xff, 0x90, 0x0, 0x0, 0xaf, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x40, 0x0, 0x4, 0xff,
-    0xf8, 0x0, 0xf, 0xff, 0x90, 0x0, 0x0, 0xef,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xef, 0xff, 0x30,
-    0x0, 0x9, 0xff, 0xf3, 0x0, 0xf, 0xff, 0x90,
-    0x0, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x30, 0x0, 0xe, 0xff, 0xe0, 0x0,
-    0xf, 0xff, 0x80, 0x0, 0x8, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x30, 0x0, 0x4f,
-    0xff, 0x80, 0x0, 0x1f, 0xff, 0x80, 0x0, 0xd,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x20, 0x0, 0x9f, 0xff, 0x30, 0x0, 0x1f, 0xff,
-    0x80, 0x0, 0x2f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x20, 0x0, 0xef, 0xfe, 0x0,
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x7f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x20, 0x3,
-    0xff, 0xf9, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0,
-    0xcf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x10, 0x8, 0xff, 0xf4, 0x0, 0x0, 0x1f,
-    0xff, 0x70, 0x1, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x10, 0xd, 0xff, 0xe0,
-    0x0, 0x0, 0x1f, 0xff, 0x70, 0x5, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x0,
-    0x2f, 0xff, 0x90, 0x0, 0x0, 0x1f, 0xff, 0x70,
-    0xa, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x0, 0x8f, 0xff, 0x40, 0x0, 0x0,
-    0x1f, 0xff, 0x70, 0xf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x0, 0xdf, 0xff,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x70, 0x4f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x2, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x60, 0x9f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfe, 0x6, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x60, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfd, 0xa, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x51, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfd, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x55, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfc, 0x3f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x5a, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb, 0x8f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x4e,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0xcf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x7f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfc, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xcf, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0058 "X" */
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf1,
-    0x0, 0x0, 0xb, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf4,
-    0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xfe, 0x0, 0x6f, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x70,
+    0xa, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xe0, 0x0, 0xdf, 0xff, 0x90,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf6,
-    0x0, 0x0, 0xaf, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf9,
-    0x0, 0x2, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfb,
-    0x0, 0x9, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfe,
-    0x0, 0x1f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x30, 0xdf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x54, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x8a, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xcf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfa,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf1,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xa0,
-    0xef, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x30,
-    0xbf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfd, 0x0,
-    0x9f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf6, 0x0,
-    0x6f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0, 0x0,
-    0x4f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x70, 0x0,
-    0x1f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0, 0x0,
-    0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf7, 0x0, 0x0,
-    0xc, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf1, 0x0, 0x0,
-    0xa, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0059 "Y" */
-    0xcf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf3, 0x9f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xc0,
-    0x6f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x40, 0x4f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0,
-    0x1f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf5, 0x0, 0xe, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0xb, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x60, 0x0, 0x8, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfe, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf7, 0x0, 0x0, 0x2, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x70, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x90,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xb0, 0x0, 0x0, 0xf, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0,
-    0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0, 0xdf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf2,
-    0x0, 0x5, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf4, 0x0, 0xc, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf6,
-    0x0, 0x2f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf8, 0x0, 0x8f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfa,
-    0x0, 0xef, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xfc, 0x5, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0xa, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x1f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xfe, 0x0, 0x2, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0x60, 0x0, 0x5f, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xd0, 0x0, 0x7, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xf5, 0x0, 0x0, 0xaf, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xfd, 0x0, 0x0, 0xc,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0x50, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0,
+    0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xf4, 0x0, 0x0, 0x3, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x8, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
     0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xfb, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0,
+    0xef, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf7, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xb0,
+    0x3, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf2,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
 
-    /* U+005A "Z" */
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x14, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x4f, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0035 "5" */
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x40, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf7,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf2, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe0,
+    0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x50,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0x10, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf2, 0x0,
+    0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf4, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0,
+    0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x30, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0,
+    0x0, 0x5, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf6,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xfd, 0xdf, 0xfd,
+    0xa6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xfe, 0xb9, 0x9b, 0xef,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xf9, 0x20, 0x0, 0x0, 0x5, 0xef, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xa0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xf0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0x0, 0xcf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
     0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf6,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf6, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf2, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xd4,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+005B "[" */
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xec, 0xcc, 0xcc, 0xc9, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xe0,
+    0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf5,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfc,
+    0xc, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf1, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf3,
+    0x0, 0x6, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xe4, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xb6,
+    0x31, 0x25, 0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf, 0xff,
+    0xff, 0xff, 0xe8, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x77, 0x53,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x8d, 0xdd, 0xdd, 0xdd, 0xdd, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
 
-    /* U+005C "\\" */
-    0x67, 0x77, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x10,
+    /* U+0036 "6" */
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf8,
+    0x0, 0x8f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xb0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x10,
+    0xa, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf9, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
     0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x70,
-
-    /* U+005D "]" */
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xcc, 0xcc, 0xcc, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
     0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf3,
+    0x0, 0x0, 0xaf, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf6,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfa,
+    0x0, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x40,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x7d, 0xdd, 0xdd, 0xdd, 0xdd, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xdf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfa, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0xc,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xb0, 0xa, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x30, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc, 0x0,
-    0x5, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf4, 0x0, 0x2, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xd0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x50,
-    0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfd, 0x0, 0x0, 0x0, 0xaf, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0, 0x0,
-    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x5f, 0xfa, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x70, 0x0, 0x0, 0x0, 0x3f, 0xfd,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x30, 0x0,
-    0x0, 0xef, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0x50, 0x0, 0x7, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x80, 0x0, 0xe, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xb0,
-    0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xd0, 0x0, 0xdf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x5, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xf3, 0xd, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf5,
+    0x1f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0, 0x5a, 0xdf,
+    0xda, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0x9d, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8, 0x42, 0x49,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xfe, 0x20, 0x0, 0x0, 0x6f, 0xff, 0xfd, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0x10, 0x0, 0x8, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40,
+    0x0, 0xd, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0x50, 0x0, 0x3f, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x60,
+    0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0x60, 0x0, 0xaf, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x50,
+    0x0, 0xef, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0x40, 0x1, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x30,
+    0x5, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0x10, 0x7, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0,
+    0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xfb, 0x0, 0xb, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf7, 0x0,
+    0xb, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xf4, 0x0, 0xb, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0,
+    0xb, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xb0, 0x0, 0x9, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x50, 0x0,
+    0x7, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xfe, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xfe, 0x50, 0x0, 0x2b, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xdf, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xdf, 0xff, 0xff, 0xfd, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x57, 0x75, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
 
-    /* U+005F "_" */
-    0x4, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3, 0xff, 0xff, 0xff,
+    /* U+0037 "7" */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xef,
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-
-    /* U+0060 "`" */
-    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0xae,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x0,
-    0x4, 0xef, 0xff, 0xf3, 0x0, 0x0, 0x2e, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x3f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x6f, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x62, 0x0,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x46, 0x64,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xff, 0xff, 0xd2, 0xf, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x83, 0x15,
-    0xef, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xf3, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0x80, 0x0, 0x0, 0xd, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x3f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x8f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfc, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf9, 0x0, 0x0, 0x8, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf7, 0x0,
-    0x0, 0xb, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf4, 0x0, 0x0, 0xe, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf1, 0x0,
-    0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf0, 0x0, 0x0, 0x4f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xa0, 0x0, 0x0, 0x9f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x70, 0x0,
-    0x0, 0xbf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x50, 0x0, 0x0, 0xdf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20, 0x0,
-    0x0, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfd, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xfb, 0x0, 0x0, 0x2, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf8, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf6, 0x0, 0x0, 0x3, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xf1, 0x0, 0x0, 0x1, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xe0, 0x0, 0x0, 0x1d, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfb,
-    0x31, 0x26, 0xef, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xef,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x1, 0xbf, 0xff, 0xff, 0xe7, 0x2, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0x67,
-    0x64, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0062 "b" */
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x2d, 0xff, 0xff, 0x10,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0x90, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xb0, 0x0, 0x46, 0x64, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x80, 0x7f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xb4, 0x13, 0xbf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x20, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x70, 0x0, 0x0, 0xe, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x90,
-    0x0, 0x0, 0x1f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x3f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x80,
-    0x0, 0x0, 0x6f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x80, 0x0, 0x0, 0x8f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0xbf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x40, 0x0, 0x0, 0xdf, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0,
-    0x0, 0x4, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xfc, 0x0, 0x0, 0x7, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf9, 0x0,
-    0x0, 0x9, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf6, 0x0, 0x0, 0xc, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf3, 0x0,
-    0x0, 0xe, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xd0, 0x0,
-    0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xa0, 0x0, 0x0, 0x6f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0xbf, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf2, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xb0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xa4, 0x13, 0xaf, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf7, 0x6f, 0xff, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf5, 0x5,
-    0xef, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x76, 0x31, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x46, 0x75,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x2e, 0xff, 0xff, 0xfc, 0xad, 0xff, 0x50,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xa1, 0x0, 0x6,
-    0xf3, 0x0, 0x0, 0x7, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x5, 0x0, 0x0, 0x1, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x30, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xf9, 0x0, 0x1, 0xaf, 0x40, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xfe, 0xab, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
-    0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x47, 0x52, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0064 "d" */
+    0x0, 0xbf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xf4, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xe0, 0x0, 0x0,
+    0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xe0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf7, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0xd, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
     0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfa, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0x30, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf0, 0x0,
+    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfd,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x76,
-    0x40, 0x0, 0xcf, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xd2, 0xe,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xe2, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf9, 0x31, 0x5e, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xf4, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0x70, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0x30, 0x0, 0x2, 0xef, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xfe, 0x61,
-    0x27, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
-    0xfe, 0x70, 0x2f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x46, 0x64, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x57, 0x63,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xaf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xca, 0xdf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd3, 0x0, 0x8, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x10,
-    0x0, 0x0, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x2f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0,
-    0x0, 0x0, 0x9f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0, 0x6,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf0, 0x0, 0xc, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0,
-    0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xd0, 0x0, 0x9f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xc0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x6, 0xff,
-    0xff, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0x20, 0x8, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x2a, 0xaa, 0xa1, 0x0,
-    0xe, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xe0, 0x0, 0xe, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xa0, 0x0, 0xd, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x50,
-    0x0, 0xb, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x10, 0x0, 0x8, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf9, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x7f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xe3, 0x0, 0x7,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xca, 0xdf, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1a, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x14, 0x66, 0x41, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0066 "f" */
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x60, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xe0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6b, 0xef, 0xec, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x31, 0x5c, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xe1, 0x0, 0x0, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf9, 0x0,
+    0x5f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
     0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x66,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xe5, 0x9, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff,
-    0xff, 0xff, 0xf5, 0xcf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf7, 0x21, 0x5e, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x60, 0x0, 0x0, 0xa,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x4f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xe0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x90, 0x0, 0x0, 0xe, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf7, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x40, 0x0, 0x0, 0x4f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf2,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xd0, 0x0, 0x0, 0xb, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x80, 0x0, 0x0, 0xe, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x30, 0x0, 0x0, 0xf, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf3, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xd1, 0x0, 0x4, 0xef, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xfb, 0x9c, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xe5, 0xbf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3b, 0xef, 0xec, 0x70,
-    0xe, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x12,
-    0x22, 0x10, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xf8, 0x0, 0x0, 0x2c,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xfd, 0xaa, 0xcf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff,
-    0xff, 0xfd, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x56, 0x76, 0x52, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x77, 0x74, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x90,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf2, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xb0, 0x0, 0x3, 0x67, 0x53, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x80, 0x8, 0xef,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x64, 0xef, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xd5, 0x21, 0x4d, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xa0, 0x0, 0x0, 0xe, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x80,
-    0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x60, 0x0, 0x0, 0x3f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x20, 0x0, 0x0, 0x8f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf8, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf5, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf3, 0x0, 0x0, 0x7, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0,
-    0x0, 0x9, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xe0, 0x0, 0x0, 0xc, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0,
-    0x0, 0xe, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x90, 0x0, 0x0, 0x1f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x60, 0x0,
-    0x0, 0x3f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x6f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf5, 0x0, 0x0, 0x5, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf2, 0x0, 0x0,
-    0x7, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf0, 0x0, 0x0, 0xa, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xd0, 0x0, 0x0,
-    0xc, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xa0, 0x0, 0x0, 0xf, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x80, 0x0, 0x0,
-
-    /* U+0069 "i" */
-    0x0, 0x0, 0x0, 0x0, 0x4c, 0xfc, 0x30, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x37, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf4, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf7,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x74, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xd5, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x10, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x30,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xe0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xf7, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf2,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
 
-    /* U+006B "k" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x77, 0x74, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xb0, 0x0,
+    /* U+0038 "8" */
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x60, 0x0,
+    0x13, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x39, 0xef, 0xff, 0xff,
+    0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xfc, 0x51, 0x3, 0xaf, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0x10, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x1, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xfd, 0x10, 0x0, 0x2, 0xdf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xfe, 0x85, 0x6a, 0xff, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6d, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xf9, 0x30, 0x26, 0xef,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xf3, 0x0, 0x0, 0x1, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xc0, 0x0, 0x0, 0x8, 0xff,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0,
+    0x0, 0xf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0,
+    0x0, 0xa, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0xcf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xf0, 0x0, 0x0, 0xe, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0x70, 0x0, 0x0, 0xe,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc2, 0x0,
+    0x5, 0xdf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xa4,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x50, 0x0, 0x0, 0x2, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xd, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfd, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xfb, 0x0, 0x0, 0x3f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf8, 0x0, 0x1, 0xdf,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf6, 0x0, 0xa, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf3, 0x0, 0x7f, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf1, 0x3, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xe0, 0x1e, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xc0, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x97, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xbf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfb, 0xaf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf8,
-    0x2f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf6, 0xa, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf3,
-    0x3, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf1, 0x0, 0xbf, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0,
-    0x0, 0x3f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xc0, 0x0, 0xc, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x90,
-    0x0, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x70, 0x0, 0x0, 0xcf, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x5f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x20, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x5, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x7, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xf5, 0x0, 0x0, 0xa, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfd, 0x0, 0x0,
-    0xc, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0x60, 0x0, 0xf, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xe0, 0x0,
-
-    /* U+006C "l" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x77, 0x74, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+006D "m" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x67, 0x51, 0x0, 0x0, 0x0, 0x0, 0x35, 0x76,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf8,
-    0x0, 0x8e, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x7,
-    0xdf, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x53, 0xdf, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xf7, 0x31, 0x3c, 0xff, 0xff, 0xde, 0xff, 0x83,
-    0x12, 0x9f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0xdf, 0xff, 0xf1, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x30, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0xbf, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf1, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xd0, 0x0, 0x0, 0x2f, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xfc, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x90, 0x0, 0x0,
-    0x7f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7,
-    0x0, 0x0, 0xa, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xcf, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf2, 0x0, 0x0, 0xf,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xd0, 0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfa, 0x0, 0x0, 0x7, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x80, 0x0,
-    0x0, 0x9f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf5, 0x0, 0x0, 0xc, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x30, 0x0, 0x0, 0xef, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0,
-    0x1f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xb0, 0x0, 0x0, 0x6f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf9, 0x0, 0x0, 0x8,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x60,
-    0x0, 0x0, 0xbf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf4, 0x0, 0x0, 0xd, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x10, 0x0, 0x0, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xe0, 0x0,
-    0x0, 0x2f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfc, 0x0, 0x0, 0x5, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x90, 0x0, 0x0, 0x7f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x0, 0x0,
-    0xa, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0xcf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf2, 0x0, 0x0, 0xf, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x0, 0x0, 0x0,
-
-    /* U+006E "n" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x67, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x80, 0x8, 0xef, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x64, 0xef, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xd5, 0x21,
-    0x4d, 0xff, 0xff, 0x70, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x1, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xa0,
-    0x0, 0x0, 0xd, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x60,
-    0x0, 0x0, 0x2f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x40, 0x0, 0x0, 0x5f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x7f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf8, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf5, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf3, 0x0,
-    0x0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf0, 0x0, 0x0, 0x9, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0, 0x0,
-    0x0, 0xc, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xb0, 0x0, 0x0, 0xe, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x90, 0x0,
-    0x0, 0x1f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x60, 0x0, 0x0, 0x3f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x6f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x8f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf7, 0x0, 0x0, 0x2, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf5, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf2, 0x0, 0x0, 0x7, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0,
-    0xa, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xd0, 0x0, 0x0, 0xc, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xa0, 0x0, 0x0,
-    0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0x80, 0x0, 0x0,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x66,
-    0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xaf, 0xff, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfd, 0xae, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xe4, 0x0, 0x7, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xf2, 0x0, 0x0, 0xb, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xa0, 0x0, 0x0, 0xd, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xfa, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf9, 0x0, 0x0,
-    0xa, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x80, 0x0, 0x0, 0xef, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf6, 0x0,
-    0x0, 0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x40, 0x0, 0x3, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf2,
-    0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x0, 0x0, 0x8, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xc0, 0x0, 0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf9, 0x0, 0x0, 0xc,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0xdf, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf2, 0x0, 0x0,
-    0xe, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x90, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x5f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x30, 0x0, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xca, 0xef, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xf8,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x25, 0x75, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0x14, 0x67, 0x53, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
 
-    /* U+0070 "p" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x46, 0x64, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x80, 0x7e, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x6b, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xa4, 0x14, 0xcf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x1, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xb3, 0x13, 0xaf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf7, 0x6f, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf4, 0x5, 0xef,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf2, 0x0, 0x4, 0x76, 0x31, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfc, 0x0,
+    /* U+0039 "9" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x42,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf4, 0x0, 0x0,
+    0x2, 0x9e, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xf8, 0x30, 0x26, 0xef, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x1f, 0xff, 0xfe, 0x20, 0x0, 0x0,
+    0x2e, 0xff, 0xff, 0x50, 0x0, 0x0, 0x8f, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xa0,
+    0x0, 0x1, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xc0, 0x0, 0x6, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xe0,
+    0x0, 0xb, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0,
+    0x0, 0x4f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0,
+    0x0, 0xbf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xb0, 0x0, 0xef, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x90,
+    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0x60, 0x1, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x20,
+    0x2, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0,
+    0x2, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xf7, 0x0, 0x1, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0x0,
+    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0xdf, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x9f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xb4, 0x23, 0x7e, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xf9, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9c,
+    0xfe, 0xb8, 0x19, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x46, 0x64,
+    0x1, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x30,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xaf, 0xff, 0xff, 0xd2, 0xf, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x83, 0x15,
-    0xef, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x80, 0x0, 0x0, 0xb, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x30, 0x0, 0x0, 0x7f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xcf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf9, 0x0, 0x0, 0x7, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf6, 0x0,
-    0x0, 0xb, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf4, 0x0, 0x0, 0xe, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf1, 0x0,
-    0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0x0, 0x4f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x6f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xa0, 0x0, 0x0, 0x8f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x70, 0x0,
-    0x0, 0xaf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x50, 0x0, 0x0, 0xcf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20, 0x0,
-    0x0, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfd, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfb, 0x0, 0x0, 0x2, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf8, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf6, 0x0, 0x0, 0x2, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-    0x51, 0x27, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xef,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xe7, 0x2, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36,
-    0x64, 0x0, 0x5, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+0072 "r" */
+    0x2f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf1, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x30, 0x0, 0x0, 0xc, 0xff, 0xf8, 0x0, 0x6f,
-    0xf5, 0x0, 0x0, 0x0, 0xef, 0xff, 0x50, 0x9f,
-    0xff, 0x20, 0x0, 0x0, 0x1f, 0xff, 0xf3, 0x8f,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x5f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xfd,
-    0xff, 0xb9, 0x60, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x46, 0x76,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf,
-    0xff, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xeb, 0xbe,
-    0xff, 0xfb, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x5e, 0xf9, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x2, 0xe6, 0x0, 0x0,
-    0xf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x44,
-    0x0, 0x0, 0x3f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
     0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0,
-    0x5, 0x10, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0x80, 0x0, 0xa, 0xd1, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x20, 0x0, 0xc, 0xfd, 0x40, 0x0,
-    0x3, 0xdf, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff,
-    0xfd, 0xaa, 0xdf, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff,
-    0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x26, 0x76, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x9, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0075 "u" */
-    0x0, 0x0, 0xf, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xa0, 0x0, 0x2, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x0,
-    0x0, 0x5f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x50, 0x0, 0x7, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf2, 0x0, 0x0,
-    0xaf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xd0, 0x0, 0x0, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
-    0x0, 0x0, 0x1f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x80, 0x0, 0x4, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf6, 0x0,
-    0x0, 0x6f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0x9, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf1, 0x0, 0x0,
-    0xbf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x0, 0x0, 0xe, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfa,
-    0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x70, 0x0, 0x5, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf5, 0x0,
-    0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x20, 0x0, 0xa, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0, 0x0,
-    0xdf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfd, 0x0, 0x0, 0xf, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xb0, 0x0, 0x2, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf8,
-    0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x60, 0x0, 0x7, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf3, 0x0,
-    0x0, 0x9f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x10, 0x0, 0xc, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0, 0x0,
-    0xef, 0xff, 0x90, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfa, 0x0, 0x0, 0xf, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xf9, 0x0, 0x0, 0x4e, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfe, 0xaa, 0xdf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
-    0xff, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x56, 0x76, 0x51, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0076 "v" */
-    0x1f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x80, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf2, 0xf, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfc, 0x0,
-    0xef, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x60, 0xc, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf1, 0x0, 0xbf, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xfa, 0x0, 0xa,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x40, 0x0, 0x9f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xe0, 0x0, 0x8, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf8, 0x0, 0x0, 0x7f,
-    0xff, 0xa0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x20,
-    0x0, 0x6, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xc0, 0x0, 0x0, 0x5f, 0xff, 0xc0, 0x0,
-    0x0, 0xd, 0xff, 0xf6, 0x0, 0x0, 0x4, 0xff,
-    0xfc, 0x0, 0x0, 0x2, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xd0, 0x0, 0x0, 0x8f, 0xff,
-    0xa0, 0x0, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x0,
-    0xe, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf0, 0x0, 0x4, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x10, 0x5, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf2, 0x0, 0xbf, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x20, 0x1f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf3,
-    0x6, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x40, 0xbf, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf4, 0xf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x54,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf6, 0x9f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x7e, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0xef, 0xff, 0x60, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfb,
-    0xdf, 0xff, 0x60, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf5,
-    0xcf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xe0,
-    0xcf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x90,
-    0xbf, 0xff, 0x60, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x30,
-    0xaf, 0xff, 0x70, 0x0, 0x0, 0x2, 0xff, 0xef,
-    0xfe, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfd, 0x0,
-    0xaf, 0xff, 0x70, 0x0, 0x0, 0x7, 0xff, 0xaf,
-    0xfe, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x0,
-    0x9f, 0xff, 0x70, 0x0, 0x0, 0xc, 0xff, 0x7f,
-    0xfe, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf1, 0x0,
-    0x8f, 0xff, 0x70, 0x0, 0x0, 0x2f, 0xff, 0x4f,
-    0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xa0, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x7f, 0xfb, 0x5f,
-    0xfe, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0xcf, 0xf7, 0x5f,
-    0xfe, 0x0, 0x0, 0x3, 0xff, 0xfe, 0x0, 0x0,
-    0x6f, 0xff, 0x70, 0x0, 0x1, 0xff, 0xf2, 0x5f,
-    0xfe, 0x0, 0x0, 0x9, 0xff, 0xf8, 0x0, 0x0,
-    0x5f, 0xff, 0x70, 0x0, 0x6, 0xff, 0xd0, 0x5f,
-    0xfe, 0x0, 0x0, 0xe, 0xff, 0xf2, 0x0, 0x0,
-    0x5f, 0xff, 0x70, 0x0, 0xb, 0xff, 0x80, 0x5f,
-    0xfe, 0x0, 0x0, 0x4f, 0xff, 0xc0, 0x0, 0x0,
-    0x4f, 0xff, 0x70, 0x0, 0x1f, 0xff, 0x30, 0x5f,
-    0xfd, 0x0, 0x0, 0xaf, 0xff, 0x60, 0x0, 0x0,
-    0x3f, 0xff, 0x70, 0x0, 0x6f, 0xfe, 0x0, 0x5f,
-    0xfd, 0x0, 0x0, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x2f, 0xff, 0x70, 0x0, 0xbf, 0xf9, 0x0, 0x5f,
-    0xfd, 0x0, 0x5, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x70, 0x0, 0xff, 0xf4, 0x0, 0x5f,
-    0xfd, 0x0, 0xb, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x70, 0x5, 0xff, 0xe0, 0x0, 0x5f,
-    0xfd, 0x0, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x70, 0xa, 0xff, 0x90, 0x0, 0x5f,
-    0xfd, 0x0, 0x6f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x80, 0xf, 0xff, 0x40, 0x0, 0x5f,
-    0xfd, 0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x80, 0x4f, 0xff, 0x0, 0x0, 0x5f,
-    0xfd, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x80, 0x8f, 0xfa, 0x0, 0x0, 0x5f,
-    0xfd, 0x6, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x90, 0xdf, 0xf5, 0x0, 0x0, 0x5f,
-    0xfd, 0xb, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x91, 0xff, 0xf0, 0x0, 0x0, 0x5f,
-    0xfc, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xa6, 0xff, 0xa0, 0x0, 0x0, 0x5f,
-    0xfc, 0x5f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xab, 0xff, 0x50, 0x0, 0x0, 0x5f,
-    0xfc, 0xaf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xcf, 0xff, 0x10, 0x0, 0x0, 0x5f,
-    0xfd, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0, 0xb,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf3,
-    0x0, 0x0, 0xcf, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x70, 0x0, 0x5f,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf9, 0x0, 0xc, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xb0, 0x4, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfd, 0x0, 0xcf,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x29, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf4, 0xef,
+    0x0, 0x0, 0x2f, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
     0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xdf, 0xf8, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xcf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xb8, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf5, 0x6f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfe, 0x4,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x60, 0x1f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xd0, 0x0, 0xdf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf5, 0x0,
-    0xa, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfd, 0x0, 0x0, 0x6f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x40, 0x0, 0x2, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0,
-    0x0, 0xe, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x0, 0x0, 0x0,
 
-    /* U+0079 "y" */
-    0x0, 0x1f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf2,
-    0x0, 0xe, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xb0, 0x0, 0xd, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x40,
-    0x0, 0xb, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xfe, 0x0, 0x0, 0xa, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf7, 0x0,
-    0x0, 0x9, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf1, 0x0, 0x0, 0x7, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xa0, 0x0,
-    0x0, 0x6, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x4, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x0, 0x0, 0x6, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x0, 0x0, 0xc, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x0, 0x0, 0x2f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0x10, 0x0, 0x8f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x20, 0x0, 0xef, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x30, 0x4, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x40, 0xa, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x40, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x50, 0x6f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x60, 0xcf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x72, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x87, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x8d, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xe0,
+    /* U+003A ":" */
+    0x0, 0x0, 0x0, 0x0, 0x57, 0x30, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xff, 0x60, 0x0, 0x0, 0x1,
+    0xef, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x34, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x10,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xe1, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x20, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0x70, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf3,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x50,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf8, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xa0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6a,
-    0xde, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xe9, 0x63, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xd0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x19, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x9f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfe, 0x81, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7c, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfd,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xa6, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x29, 0xce, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+007C "|" */
-    0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff, 0x2b,
-    0xff, 0xf2, 0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf,
-    0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff, 0x2b, 0xff,
-    0xf2, 0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff,
-    0x2b, 0xff, 0xf2, 0xbf, 0xff, 0x2b, 0xff, 0xf2,
-    0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff, 0x2b,
-    0xff, 0xf2, 0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf,
-    0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff, 0x2b, 0xff,
-    0xf2, 0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff,
-    0x2b, 0xff, 0xf2, 0xbf, 0xff, 0x2b, 0xff, 0xf2,
-    0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff, 0x2b,
-    0xff, 0xf2, 0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf,
-    0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff, 0x2b, 0xff,
-    0xf2, 0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff,
-    0x2b, 0xff, 0xf2, 0xbf, 0xff, 0x2b, 0xff, 0xf2,
-    0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff, 0x2b,
-    0xff, 0xf2, 0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf,
-    0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff, 0x2b, 0xff,
-    0xf2, 0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff,
-    0x2b, 0xff, 0xf2, 0xbf, 0xff, 0x2b, 0xff, 0xf2,
-    0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff, 0x2b,
-    0xff, 0xf2, 0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf,
-    0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff, 0x2b, 0xff,
-    0xf2, 0xbf, 0xff, 0x2b, 0xff, 0xf2, 0xbf, 0xff,
-    0x2b, 0xff, 0xf2,
-
-    /* U+007D "}" */
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xec, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x6a, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xb0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0xff, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x9e, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xed, 0xa5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x30, 0x0, 0x0,
-    0x0, 0x6c, 0xef, 0xd9, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xe1, 0x0, 0x0, 0x4d, 0xff,
-    0xff, 0xff, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0xfb, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb5, 0x0, 0x0, 0x5e, 0xff, 0xf3,
-    0x0, 0x6f, 0xff, 0xfe, 0xbd, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xbe, 0xff, 0xff, 0x50, 0x4, 0xff,
-    0xfd, 0x30, 0x0, 0x16, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x1f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x3, 0x9e, 0xff, 0xff, 0xff, 0xfc,
-    0x20, 0x0, 0xa, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x59, 0xdf, 0xda, 0x50, 0x0, 0x0,
-    0x0, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x43, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x5, 0xff, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x2, 0x65, 0x10, 0x0,
+    0x0, 0x0,
 
     /* U+00B0 "°" */
     0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xef, 0xda,
@@ -6943,101 +968,19 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 220, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 362, .box_w = 14, .box_h = 52, .ofs_x = 8, .ofs_y = -1},
-    {.bitmap_index = 364, .adv_w = 326, .box_w = 16, .box_h = 16, .ofs_x = 9, .ofs_y = 35},
-    {.bitmap_index = 492, .adv_w = 439, .box_w = 32, .box_h = 50, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1292, .adv_w = 439, .box_w = 28, .box_h = 63, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 2174, .adv_w = 550, .box_w = 32, .box_h = 53, .ofs_x = 5, .ofs_y = -1},
-    {.bitmap_index = 3022, .adv_w = 559, .box_w = 30, .box_h = 52, .ofs_x = 5, .ofs_y = -1},
-    {.bitmap_index = 3802, .adv_w = 237, .box_w = 8, .box_h = 16, .ofs_x = 10, .ofs_y = 35},
-    {.bitmap_index = 3866, .adv_w = 317, .box_w = 18, .box_h = 58, .ofs_x = 8, .ofs_y = -6},
-    {.bitmap_index = 4388, .adv_w = 317, .box_w = 18, .box_h = 58, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 4910, .adv_w = 438, .box_w = 24, .box_h = 23, .ofs_x = 8, .ofs_y = 28},
-    {.bitmap_index = 5186, .adv_w = 469, .box_w = 28, .box_h = 33, .ofs_x = 3, .ofs_y = 1},
-    {.bitmap_index = 5648, .adv_w = 220, .box_w = 13, .box_h = 18, .ofs_x = -1, .ofs_y = -11},
-    {.bitmap_index = 5765, .adv_w = 165, .box_w = 13, .box_h = 6, .ofs_x = 2, .ofs_y = 19},
-    {.bitmap_index = 5804, .adv_w = 220, .box_w = 8, .box_h = 8, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 5836, .adv_w = 490, .box_w = 45, .box_h = 69, .ofs_x = -4, .ofs_y = -15},
-    {.bitmap_index = 7389, .adv_w = 439, .box_w = 31, .box_h = 53, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 8211, .adv_w = 439, .box_w = 13, .box_h = 51, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 8543, .adv_w = 439, .box_w = 29, .box_h = 52, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9297, .adv_w = 439, .box_w = 28, .box_h = 53, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 10039, .adv_w = 439, .box_w = 25, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 10677, .adv_w = 439, .box_w = 28, .box_h = 52, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 11405, .adv_w = 439, .box_w = 24, .box_h = 52, .ofs_x = 4, .ofs_y = -1},
-    {.bitmap_index = 12029, .adv_w = 439, .box_w = 29, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 12769, .adv_w = 439, .box_w = 27, .box_h = 53, .ofs_x = 4, .ofs_y = -1},
-    {.bitmap_index = 13485, .adv_w = 439, .box_w = 24, .box_h = 52, .ofs_x = 7, .ofs_y = 0},
-    {.bitmap_index = 14109, .adv_w = 220, .box_w = 13, .box_h = 36, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 14343, .adv_w = 220, .box_w = 17, .box_h = 47, .ofs_x = -1, .ofs_y = -12},
-    {.bitmap_index = 14743, .adv_w = 469, .box_w = 31, .box_h = 36, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 15301, .adv_w = 469, .box_w = 30, .box_h = 16, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 15541, .adv_w = 469, .box_w = 30, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 16081, .adv_w = 460, .box_w = 22, .box_h = 53, .ofs_x = 8, .ofs_y = -1},
-    {.bitmap_index = 16664, .adv_w = 845, .box_w = 57, .box_h = 53, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 18175, .adv_w = 385, .box_w = 25, .box_h = 51, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18813, .adv_w = 420, .box_w = 28, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 19527, .adv_w = 388, .box_w = 26, .box_h = 53, .ofs_x = 4, .ofs_y = -1},
-    {.bitmap_index = 20216, .adv_w = 435, .box_w = 30, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 20981, .adv_w = 357, .box_w = 25, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 21619, .adv_w = 362, .box_w = 25, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 22257, .adv_w = 435, .box_w = 29, .box_h = 53, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 23026, .adv_w = 457, .box_w = 30, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 23791, .adv_w = 201, .box_w = 14, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 24148, .adv_w = 277, .box_w = 22, .box_h = 52, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 24720, .adv_w = 390, .box_w = 29, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 25460, .adv_w = 310, .box_w = 18, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 25919, .adv_w = 593, .box_w = 37, .box_h = 51, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 26863, .adv_w = 459, .box_w = 30, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 27628, .adv_w = 471, .box_w = 31, .box_h = 53, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 28450, .adv_w = 378, .box_w = 28, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 29164, .adv_w = 471, .box_w = 32, .box_h = 56, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 30060, .adv_w = 402, .box_w = 28, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 30774, .adv_w = 411, .box_w = 26, .box_h = 53, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 31463, .adv_w = 328, .box_w = 21, .box_h = 51, .ofs_x = 7, .ofs_y = 0},
-    {.bitmap_index = 31999, .adv_w = 454, .box_w = 29, .box_h = 52, .ofs_x = 4, .ofs_y = -1},
-    {.bitmap_index = 32753, .adv_w = 411, .box_w = 25, .box_h = 51, .ofs_x = 8, .ofs_y = 0},
-    {.bitmap_index = 33391, .adv_w = 639, .box_w = 38, .box_h = 51, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 34360, .adv_w = 425, .box_w = 32, .box_h = 51, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 35176, .adv_w = 414, .box_w = 24, .box_h = 51, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 35788, .adv_w = 354, .box_w = 28, .box_h = 51, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 36502, .adv_w = 317, .box_w = 21, .box_h = 59, .ofs_x = 7, .ofs_y = -8},
-    {.bitmap_index = 37122, .adv_w = 234, .box_w = 23, .box_h = 69, .ofs_x = 0, .ofs_y = -15},
-    {.bitmap_index = 37916, .adv_w = 317, .box_w = 21, .box_h = 59, .ofs_x = -1, .ofs_y = -8},
-    {.bitmap_index = 38536, .adv_w = 469, .box_w = 22, .box_h = 28, .ofs_x = 7, .ofs_y = 23},
-    {.bitmap_index = 38844, .adv_w = 528, .box_w = 35, .box_h = 4, .ofs_x = -2, .ofs_y = -8},
-    {.bitmap_index = 38914, .adv_w = 296, .box_w = 11, .box_h = 12, .ofs_x = 10, .ofs_y = 39},
-    {.bitmap_index = 38980, .adv_w = 369, .box_w = 24, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 39412, .adv_w = 369, .box_w = 24, .box_h = 55, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 40072, .adv_w = 294, .box_w = 19, .box_h = 36, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 40414, .adv_w = 369, .box_w = 27, .box_h = 55, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 41157, .adv_w = 362, .box_w = 22, .box_h = 36, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 41553, .adv_w = 220, .box_w = 20, .box_h = 55, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 42103, .adv_w = 374, .box_w = 25, .box_h = 49, .ofs_x = 1, .ofs_y = -14},
-    {.bitmap_index = 42716, .adv_w = 375, .box_w = 24, .box_h = 54, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 43364, .adv_w = 164, .box_w = 14, .box_h = 48, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 43700, .adv_w = 164, .box_w = 16, .box_h = 61, .ofs_x = 0, .ofs_y = -13},
-    {.bitmap_index = 44188, .adv_w = 371, .box_w = 24, .box_h = 54, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 44836, .adv_w = 164, .box_w = 14, .box_h = 54, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 45214, .adv_w = 590, .box_w = 37, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 45862, .adv_w = 375, .box_w = 24, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 46282, .adv_w = 375, .box_w = 25, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 46732, .adv_w = 369, .box_w = 26, .box_h = 48, .ofs_x = 0, .ofs_y = -13},
-    {.bitmap_index = 47356, .adv_w = 369, .box_w = 24, .box_h = 48, .ofs_x = 2, .ofs_y = -13},
-    {.bitmap_index = 47932, .adv_w = 216, .box_w = 17, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 48230, .adv_w = 294, .box_w = 20, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 48590, .adv_w = 222, .box_w = 16, .box_h = 44, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 48942, .adv_w = 370, .box_w = 23, .box_h = 35, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 49345, .adv_w = 334, .box_w = 21, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 49702, .adv_w = 532, .box_w = 32, .box_h = 34, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 50246, .adv_w = 354, .box_w = 27, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 50705, .adv_w = 351, .box_w = 24, .box_h = 47, .ofs_x = 3, .ofs_y = -13},
-    {.bitmap_index = 51269, .adv_w = 350, .box_w = 27, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 51728, .adv_w = 317, .box_w = 21, .box_h = 56, .ofs_x = 6, .ofs_y = -5},
-    {.bitmap_index = 52316, .adv_w = 358, .box_w = 5, .box_h = 78, .ofs_x = 13, .ofs_y = -19},
-    {.bitmap_index = 52511, .adv_w = 317, .box_w = 21, .box_h = 56, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 53099, .adv_w = 469, .box_w = 28, .box_h = 10, .ofs_x = 3, .ofs_y = 12},
-    {.bitmap_index = 53239, .adv_w = 422, .box_w = 23, .box_h = 20, .ofs_x = 8, .ofs_y = 31}
+    {.bitmap_index = 0, .adv_w = 165, .box_w = 13, .box_h = 6, .ofs_x = 2, .ofs_y = 19},
+    {.bitmap_index = 39, .adv_w = 439, .box_w = 31, .box_h = 53, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 861, .adv_w = 439, .box_w = 13, .box_h = 51, .ofs_x = 12, .ofs_y = 0},
+    {.bitmap_index = 1193, .adv_w = 439, .box_w = 29, .box_h = 52, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1947, .adv_w = 439, .box_w = 28, .box_h = 53, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 2689, .adv_w = 439, .box_w = 25, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 3327, .adv_w = 439, .box_w = 28, .box_h = 52, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 4055, .adv_w = 439, .box_w = 24, .box_h = 52, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 4679, .adv_w = 439, .box_w = 29, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 5419, .adv_w = 439, .box_w = 27, .box_h = 53, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 6135, .adv_w = 439, .box_w = 24, .box_h = 52, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 6759, .adv_w = 220, .box_w = 13, .box_h = 36, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 6993, .adv_w = 422, .box_w = 23, .box_h = 20, .ofs_x = 8, .ofs_y = 31}
 };
 
 /*---------------------
@@ -7049,11 +992,19 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] = {
     {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .range_start = 32, .range_length = 1, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 45, .range_length = 1, .glyph_id_start = 2,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 48, .range_length = 11, .glyph_id_start = 3,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     },
     {
-        .range_start = 176, .range_length = 1, .glyph_id_start = 96,
+        .range_start = 176, .range_length = 1, .glyph_id_start = 14,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     }
 };
@@ -7065,124 +1016,20 @@ static const lv_font_fmt_txt_cmap_t cmaps[] = {
 
 /*Pair left and right glyphs for kerning*/
 static const uint8_t kern_pair_glyph_ids[] = {
-    34, 53,
-    34, 55,
-    34, 56,
-    34, 58,
-    34, 87,
-    34, 88,
-    34, 90,
-    39, 13,
-    39, 15,
-    39, 34,
-    45, 53,
-    45, 55,
-    45, 56,
-    45, 58,
-    45, 90,
-    49, 13,
-    49, 15,
-    49, 34,
-    51, 53,
-    51, 55,
-    51, 56,
-    51, 58,
-    53, 13,
-    53, 14,
-    53, 15,
-    53, 27,
-    53, 28,
-    53, 34,
-    53, 66,
-    53, 68,
-    53, 70,
-    53, 80,
-    53, 83,
-    53, 84,
-    53, 86,
-    53, 88,
-    53, 90,
-    55, 13,
-    55, 14,
-    55, 15,
-    55, 27,
-    55, 28,
-    55, 34,
-    55, 66,
-    55, 70,
-    55, 74,
-    55, 80,
-    55, 83,
-    55, 86,
-    56, 13,
-    56, 14,
-    56, 15,
-    56, 27,
-    56, 28,
-    56, 34,
-    56, 66,
-    56, 70,
-    56, 74,
-    56, 80,
-    56, 83,
-    56, 86,
-    56, 90,
-    58, 13,
-    58, 14,
-    58, 15,
-    58, 27,
-    58, 28,
-    58, 34,
-    58, 66,
-    58, 70,
-    58, 80,
-    58, 81,
-    58, 82,
-    58, 86,
-    58, 87,
-    83, 13,
-    83, 15,
-    83, 71,
-    83, 73,
-    83, 78,
-    83, 79,
-    83, 83,
-    83, 85,
-    83, 86,
-    83, 87,
-    83, 88,
-    83, 90,
-    83, 91,
-    87, 13,
-    87, 15,
-    88, 13,
-    88, 15,
-    90, 13,
-    90, 15
+    1, 1
 };
 
 /* Kerning between the respective left and right glyphs
  * 4.4 format which needs to scaled with `kern_scale`*/
 static const int8_t kern_pair_values[] = {
-    -33, -27, -27, -49, -11, -16, -11, -99,
-        -99, -33, -33, -33, -33, -44, -16, -115,
-        -115, -33, -16, -7, -7, -16, -53, -27,
-        -53, -53, -53, -33, -44, -44, -44, -44,
-        -53, -44, -53, -44, -44, -69, -7, -69,
-        -16, -16, -27, -27, -27, 7, -27, -16,
-        -16, -66, -7, -66, -9, -9, -27, -21,
-        -21, 7, -21, -11, -11, -7, -71, -66,
-        -71, -33, -33, -49, -49, -58, -49, -33,
-        -49, -33, -16, -37, -37, 7, 7, 7,
-        7, 7, 7, 7, 16, 16, 16, 7,
-        -49, -49, -33, -33, -49, -49
+    0
     };
 
 /*Collect the kern pair's data in one place*/
 static const lv_font_fmt_txt_kern_pair_t kern_pairs = {
     .glyph_ids = kern_pair_glyph_ids,
     .values = kern_pair_values,
-    .pair_cnt = 94,
+    .pair_cnt = 1,
     .glyph_ids_size = 0
 };
 
@@ -7202,7 +1049,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = &kern_pairs,
     .kern_scale = 19,
-    .cmap_num = 2,
+    .cmap_num = 4,
     .bpp = 4,
     .kern_classes = 0,
     .bitmap_format = 0,
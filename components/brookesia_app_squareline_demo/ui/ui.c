@@ -151,8 +151,15 @@ void ui_event_startevents____initial_actions0(lv_event_t *e);
 lv_obj_t *ui_startevents____initial_actions0;
 
 // IMAGES AND IMAGE SETS
+// esp-brookesia: changed
+#if CONFIG_ESP_BROOKESIA_APP_SQUARELINE_DEMO_ENABLE_ASSETS_PARTITION
+// Not constant expressions, set by `phone_app_squareline_ui_init()`
+const lv_image_dsc_t *ui_imgset_chatbox[1];
+const lv_image_dsc_t *ui_imgset_weather_[3];
+#else
 const lv_image_dsc_t *ui_imgset_chatbox[1] = {&ui_img_chatbox2_png};
 const lv_image_dsc_t *ui_imgset_weather_[3] = {&ui_img_weather_1_png, &ui_img_weather_2_png, &ui_img_weather_3_png};
+#endif
 
 ///////////////////// TEST LVGL SETTINGS ////////////////////
 #if LV_COLOR_DEPTH != 16
@@ -323,6 +330,13 @@ void ui_event_startevents____initial_actions0(lv_event_t *e)
 // esp-brookesia: changed
 void phone_app_squareline_ui_init(void)
 {
+    // esp-brookesia: changed
+#if CONFIG_ESP_BROOKESIA_APP_SQUARELINE_DEMO_ENABLE_ASSETS_PARTITION
+    ui_imgset_chatbox[0] = &ui_img_chatbox2_png;
+    ui_imgset_weather_[0] = &ui_img_weather_1_png;
+    ui_imgset_weather_[1] = &ui_img_weather_2_png;
+    ui_imgset_weather_[2] = &ui_img_weather_3_png;
+#endif
     lv_display_t *dispp = lv_display_get_default();
     lv_theme_t *theme = lv_theme_simple_init(dispp);
     lv_disp_set_theme(dispp, theme);
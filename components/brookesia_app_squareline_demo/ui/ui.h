@@ -17,6 +17,7 @@ extern "C" {
 
 // esp-brookesia: changed
 #include "lvgl.h"
+#include "sdkconfig.h"
 #include "esp_brookesia.h"
 
 // esp-brookesia: changed
@@ -150,6 +151,29 @@ void ui_event_startevents____initial_actions0(lv_event_t *e);
 extern lv_obj_t *ui_startevents____initial_actions0;
 
 // IMAGES AND IMAGE SETS
+// esp-brookesia: changed
+#if CONFIG_ESP_BROOKESIA_APP_SQUARELINE_DEMO_ENABLE_ASSETS_PARTITION
+const lv_image_dsc_t *phone_app_squareline_get_image(const char *name);
+const lv_font_t *phone_app_squareline_get_font(const char *name);
+
+#define ui_img_sls_logo_png (*phone_app_squareline_get_image("ui_img_sls_logo_png"))    // assets/sls_logo.png
+#define ui_img_pattern_png (*phone_app_squareline_get_image("ui_img_pattern_png"))    // assets/pattern.png
+#define ui_img_clock_min_png (*phone_app_squareline_get_image("ui_img_clock_min_png"))    // assets/clock_min.png
+#define ui_img_clock_hour_png (*phone_app_squareline_get_image("ui_img_clock_hour_png"))    // assets/clock_hour.png
+#define ui_img_clock_sec_png (*phone_app_squareline_get_image("ui_img_clock_sec_png"))    // assets/clock_sec.png
+#define ui_img_phone_png (*phone_app_squareline_get_image("ui_img_phone_png"))    // assets/phone.png
+#define ui_img_avatar_png (*phone_app_squareline_get_image("ui_img_avatar_png"))    // assets/avatar.png
+#define ui_img_chatbox_png (*phone_app_squareline_get_image("ui_img_chatbox_png"))    // assets/chatbox.png
+#define ui_img_chatbox2_png (*phone_app_squareline_get_image("ui_img_chatbox2_png"))    // assets/chatbox2.png
+#define ui_img_play_png (*phone_app_squareline_get_image("ui_img_play_png"))    // assets/play.png
+#define ui_img_album_png (*phone_app_squareline_get_image("ui_img_album_png"))    // assets/album.png
+#define ui_img_backward_png (*phone_app_squareline_get_image("ui_img_backward_png"))    // assets/backward.png
+#define ui_img_forward_png (*phone_app_squareline_get_image("ui_img_forward_png"))    // assets/forward.png
+#define ui_img_cloud_png (*phone_app_squareline_get_image("ui_img_cloud_png"))    // assets/cloud.png
+#define ui_img_weather_1_png (*phone_app_squareline_get_image("ui_img_weather_1_png"))    // assets/weather_1.png
+#define ui_img_weather_2_png (*phone_app_squareline_get_image("ui_img_weather_2_png"))    // assets/weather_2.png
+#define ui_img_weather_3_png (*phone_app_squareline_get_image("ui_img_weather_3_png"))    // assets/weather_3.png
+#else
 LV_IMG_DECLARE(ui_img_sls_logo_png);    // assets/sls_logo.png
 LV_IMG_DECLARE(ui_img_pattern_png);    // assets/pattern.png
 LV_IMG_DECLARE(ui_img_clock_min_png);    // assets/clock_min.png
@@ -167,9 +191,14 @@ LV_IMG_DECLARE(ui_img_cloud_png);    // assets/cloud.png
 LV_IMG_DECLARE(ui_img_weather_1_png);    // assets/weather_1.png
 LV_IMG_DECLARE(ui_img_weather_2_png);    // assets/weather_2.png
 LV_IMG_DECLARE(ui_img_weather_3_png);    // assets/weather_3.png
+#endif
 
 // FONTS
+#if CONFIG_ESP_BROOKESIA_APP_SQUARELINE_DEMO_ENABLE_ASSETS_PARTITION
+#define ui_font_Number (*phone_app_squareline_get_font("ui_font_Number"))
+#else
 LV_FONT_DECLARE(ui_font_Number);
+#endif
 
 
 // esp-brookesia: changed
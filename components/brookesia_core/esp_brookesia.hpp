@@ -17,12 +17,24 @@
 #include "style/esp_brookesia_gui_style.hpp"
 #include "style/esp_brookesia_gui_stylesheet_manager.hpp"
 #include "gui/lvgl/esp_brookesia_lv_helper.hpp"
+/* GUI - Watchface */
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+#   include "gui/watchface/esp_brookesia_watchface.hpp"
+#endif
 
 /* Services */
 /* Services - Storage NVS */
 #if ESP_BROOKESIA_SERVICES_ENABLE_STORAGE_NVS
 #   include "services/storage_nvs/esp_brookesia_service_storage_nvs.hpp"
 #endif
+/* Services - Power */
+#if ESP_BROOKESIA_SERVICES_ENABLE_POWER
+#   include "services/power/esp_brookesia_service_power.hpp"
+#endif
+/* Services - CPU Governor */
+#if ESP_BROOKESIA_SERVICES_ENABLE_CPU_GOVERNOR
+#   include "services/cpu_governor/esp_brookesia_service_cpu_governor.hpp"
+#endif
 
 /* Systems */
 /* Systems - Core */
@@ -27,6 +27,7 @@ namespace esp_brookesia::gui {
 
 AnimPlayer::FlushReadySignal AnimPlayer::flush_ready_signal;
 AnimPlayer::AnimationStopSignal AnimPlayer::animation_stop_signal;
+AnimPlayer::BoostRequestSignal AnimPlayer::boost_request_signal;
 
 AnimPlayer::~AnimPlayer()
 {
@@ -125,6 +126,7 @@ bool AnimPlayer::begin(const AnimPlayerData &data)
                     self->_player_flags.is_frame_done = true;
                 } else if (event == PLAYER_EVENT_IDLE) {
                     self->_player_state = OperationState::Stop;
+                    self->updateBoostRequest(false);
 
                     auto &event_wrapper = self->_current_event;
                     ESP_UTILS_CHECK_NULL_EXIT(event_wrapper, "Invalid current event");
@@ -244,6 +246,7 @@ bool AnimPlayer::del()
         _assets_handle = nullptr;
     }
 
+    updateBoostRequest(false);
     _animation_configs.clear();
     _animation_data.clear();
     _is_begun = false;
@@ -493,6 +496,7 @@ bool AnimPlayer::processEvent(std::shared_ptr<EventWrapper> event_wrapper)
             ESP_UTILS_LOGD("Animation[%d] set src data end", index);
 
             _player_state = OperationState::Play;
+            updateBoostRequest(true);
             anim_player_get_segment(_player_handle, &start, &end);
             anim_player_set_segment(_player_handle, start, end, config.fps, is_repeat);
             anim_player_update(_player_handle, PLAYER_ACTION_START);
@@ -527,4 +531,11 @@ bool AnimPlayer::processEvent(std::shared_ptr<EventWrapper> event_wrapper)
     return true;
 }
 
+void AnimPlayer::updateBoostRequest(bool boost)
+{
+    if (_is_boost_requested.exchange(boost) != boost) {
+        boost_request_signal(boost, this);
+    }
+}
+
 } // namespace esp_brookesia::gui
@@ -116,6 +116,7 @@ public:
                                 void(int x_start, int y_start, int x_end, int y_end, AnimPlayer *player)
                                 >;
     using AnimationEndSignal = boost::signals2::signal<void(AnimPlayer *player)>;
+    using BoostRequestSignal = boost::signals2::signal<void(bool boost, AnimPlayer *player)>;
 
     static constexpr int INDEX_NONE = -1;
 
@@ -134,6 +135,11 @@ public:
 
     static FlushReadySignal flush_ready_signal;
     static AnimationStopSignal animation_stop_signal;
+    /**
+     * @brief Emitted when the player starts (`true`) and stops (`false`) decoding frames, e.g. to raise the CPU
+     *        frequency while playing
+     */
+    static BoostRequestSignal boost_request_signal;
 
 private:
     using EventPromise = std::promise<void>;
@@ -149,6 +155,7 @@ private:
     bool waitPlayerIdle();
     bool waitPlayerState(OperationState state);
     bool processEvent(std::shared_ptr<EventWrapper> event_wrapper);
+    void updateBoostRequest(bool boost);
 
     bool _is_begun = false;
     AnimPlayerCanvasConfig _canvas_config = {};
@@ -170,6 +177,7 @@ private:
     OperationState _player_state = OperationState::Stop;
     std::condition_variable _player_condition;
     anim_player_handle_t _player_handle = nullptr;
+    std::atomic<bool> _is_boost_requested = false;
     mmap_assets_handle_t _assets_handle = nullptr;
 };
 
@@ -51,6 +51,13 @@
 #           define ESP_BROOKESIA_LVGL_ANIMATION_ENABLE_DEBUG_LOG  (0)
 #       endif
 #   endif
+#   if !defined(ESP_BROOKESIA_LVGL_ASSETS_ENABLE_DEBUG_LOG)
+#       if defined(CONFIG_ESP_BROOKESIA_LVGL_ASSETS_ENABLE_DEBUG_LOG)
+#           define ESP_BROOKESIA_LVGL_ASSETS_ENABLE_DEBUG_LOG  CONFIG_ESP_BROOKESIA_LVGL_ASSETS_ENABLE_DEBUG_LOG
+#       else
+#           define ESP_BROOKESIA_LVGL_ASSETS_ENABLE_DEBUG_LOG  (0)
+#       endif
+#   endif
 #   if !defined(ESP_BROOKESIA_LVGL_CANVAS_ENABLE_DEBUG_LOG)
 #       if defined(CONFIG_ESP_BROOKESIA_LVGL_CANVAS_ENABLE_DEBUG_LOG)
 #           define ESP_BROOKESIA_LVGL_CANVAS_ENABLE_DEBUG_LOG  CONFIG_ESP_BROOKESIA_LVGL_CANVAS_ENABLE_DEBUG_LOG
@@ -79,6 +86,13 @@
 #           define ESP_BROOKESIA_LVGL_HELPER_ENABLE_DEBUG_LOG  (0)
 #       endif
 #   endif
+#   if !defined(ESP_BROOKESIA_LVGL_LATENCY_MONITOR_ENABLE_DEBUG_LOG)
+#       if defined(CONFIG_ESP_BROOKESIA_LVGL_LATENCY_MONITOR_ENABLE_DEBUG_LOG)
+#           define ESP_BROOKESIA_LVGL_LATENCY_MONITOR_ENABLE_DEBUG_LOG  CONFIG_ESP_BROOKESIA_LVGL_LATENCY_MONITOR_ENABLE_DEBUG_LOG
+#       else
+#           define ESP_BROOKESIA_LVGL_LATENCY_MONITOR_ENABLE_DEBUG_LOG  (0)
+#       endif
+#   endif
 #   if !defined(ESP_BROOKESIA_LVGL_LOCK_ENABLE_DEBUG_LOG)
 #       if defined(CONFIG_ESP_BROOKESIA_LVGL_LOCK_ENABLE_DEBUG_LOG)
 #           define ESP_BROOKESIA_LVGL_LOCK_ENABLE_DEBUG_LOG  CONFIG_ESP_BROOKESIA_LVGL_LOCK_ENABLE_DEBUG_LOG
@@ -93,6 +107,27 @@
 #           define ESP_BROOKESIA_LVGL_OBJECT_ENABLE_DEBUG_LOG  (0)
 #       endif
 #   endif
+#   if !defined(ESP_BROOKESIA_LVGL_REFRESH_MONITOR_ENABLE_DEBUG_LOG)
+#       if defined(CONFIG_ESP_BROOKESIA_LVGL_REFRESH_MONITOR_ENABLE_DEBUG_LOG)
+#           define ESP_BROOKESIA_LVGL_REFRESH_MONITOR_ENABLE_DEBUG_LOG  CONFIG_ESP_BROOKESIA_LVGL_REFRESH_MONITOR_ENABLE_DEBUG_LOG
+#       else
+#           define ESP_BROOKESIA_LVGL_REFRESH_MONITOR_ENABLE_DEBUG_LOG  (0)
+#       endif
+#   endif
+#   if !defined(ESP_BROOKESIA_LVGL_RENDER_PROFILER_ENABLE_DEBUG_LOG)
+#       if defined(CONFIG_ESP_BROOKESIA_LVGL_RENDER_PROFILER_ENABLE_DEBUG_LOG)
+#           define ESP_BROOKESIA_LVGL_RENDER_PROFILER_ENABLE_DEBUG_LOG  CONFIG_ESP_BROOKESIA_LVGL_RENDER_PROFILER_ENABLE_DEBUG_LOG
+#       else
+#           define ESP_BROOKESIA_LVGL_RENDER_PROFILER_ENABLE_DEBUG_LOG  (0)
+#       endif
+#   endif
+#   if !defined(ESP_BROOKESIA_LVGL_SCHEDULER_ENABLE_DEBUG_LOG)
+#       if defined(CONFIG_ESP_BROOKESIA_LVGL_SCHEDULER_ENABLE_DEBUG_LOG)
+#           define ESP_BROOKESIA_LVGL_SCHEDULER_ENABLE_DEBUG_LOG  CONFIG_ESP_BROOKESIA_LVGL_SCHEDULER_ENABLE_DEBUG_LOG
+#       else
+#           define ESP_BROOKESIA_LVGL_SCHEDULER_ENABLE_DEBUG_LOG  (0)
+#       endif
+#   endif
 #   if !defined(ESP_BROOKESIA_LVGL_SCREEN_ENABLE_DEBUG_LOG)
 #       if defined(CONFIG_ESP_BROOKESIA_LVGL_SCREEN_ENABLE_DEBUG_LOG)
 #           define ESP_BROOKESIA_LVGL_SCREEN_ENABLE_DEBUG_LOG  CONFIG_ESP_BROOKESIA_LVGL_SCREEN_ENABLE_DEBUG_LOG
@@ -100,6 +135,13 @@
 #           define ESP_BROOKESIA_LVGL_SCREEN_ENABLE_DEBUG_LOG  (0)
 #       endif
 #   endif
+#   if !defined(ESP_BROOKESIA_LVGL_TILED_SNAPSHOT_ENABLE_DEBUG_LOG)
+#       if defined(CONFIG_ESP_BROOKESIA_LVGL_TILED_SNAPSHOT_ENABLE_DEBUG_LOG)
+#           define ESP_BROOKESIA_LVGL_TILED_SNAPSHOT_ENABLE_DEBUG_LOG  CONFIG_ESP_BROOKESIA_LVGL_TILED_SNAPSHOT_ENABLE_DEBUG_LOG
+#       else
+#           define ESP_BROOKESIA_LVGL_TILED_SNAPSHOT_ENABLE_DEBUG_LOG  (0)
+#       endif
+#   endif
 #   if !defined(ESP_BROOKESIA_LVGL_TIMER_ENABLE_DEBUG_LOG)
 #       if defined(CONFIG_ESP_BROOKESIA_LVGL_TIMER_ENABLE_DEBUG_LOG)
 #           define ESP_BROOKESIA_LVGL_TIMER_ENABLE_DEBUG_LOG  CONFIG_ESP_BROOKESIA_LVGL_TIMER_ENABLE_DEBUG_LOG
@@ -107,6 +149,13 @@
 #           define ESP_BROOKESIA_LVGL_TIMER_ENABLE_DEBUG_LOG  (0)
 #       endif
 #   endif
+#   if !defined(ESP_BROOKESIA_LVGL_TOUCH_INPUT_ENABLE_DEBUG_LOG)
+#       if defined(CONFIG_ESP_BROOKESIA_LVGL_TOUCH_INPUT_ENABLE_DEBUG_LOG)
+#           define ESP_BROOKESIA_LVGL_TOUCH_INPUT_ENABLE_DEBUG_LOG  CONFIG_ESP_BROOKESIA_LVGL_TOUCH_INPUT_ENABLE_DEBUG_LOG
+#       else
+#           define ESP_BROOKESIA_LVGL_TOUCH_INPUT_ENABLE_DEBUG_LOG  (0)
+#       endif
+#   endif
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -148,3 +197,24 @@
 #       define ESP_BROOKESIA_STYLE_ENABLE_DEBUG_LOG  (0)
 #   endif
 #endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////// Watchface /////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(ESP_BROOKESIA_GUI_ENABLE_WATCHFACE)
+#   if defined(CONFIG_ESP_BROOKESIA_GUI_ENABLE_WATCHFACE)
+#       define ESP_BROOKESIA_GUI_ENABLE_WATCHFACE  CONFIG_ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+#   else
+#       define ESP_BROOKESIA_GUI_ENABLE_WATCHFACE  (0)
+#   endif
+#endif
+
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+#   if !defined(ESP_BROOKESIA_WATCHFACE_ENABLE_DEBUG_LOG)
+#       if defined(CONFIG_ESP_BROOKESIA_WATCHFACE_ENABLE_DEBUG_LOG)
+#           define ESP_BROOKESIA_WATCHFACE_ENABLE_DEBUG_LOG  CONFIG_ESP_BROOKESIA_WATCHFACE_ENABLE_DEBUG_LOG
+#       else
+#           define ESP_BROOKESIA_WATCHFACE_ENABLE_DEBUG_LOG  (0)
+#       endif
+#   endif
+#endif
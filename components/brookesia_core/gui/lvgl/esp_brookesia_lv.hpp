@@ -5,11 +5,18 @@
  */
 #pragma once
 #include "esp_brookesia_lv_animation.hpp"
+#include "esp_brookesia_lv_assets.hpp"
 #include "esp_brookesia_lv_canvas.hpp"
 #include "esp_brookesia_lv_container.hpp"
 #include "esp_brookesia_lv_display.hpp"
 #include "esp_brookesia_lv_helper.hpp"
+#include "esp_brookesia_lv_latency_monitor.hpp"
 #include "esp_brookesia_lv_lock.hpp"
 #include "esp_brookesia_lv_object.hpp"
+#include "esp_brookesia_lv_refresh_monitor.hpp"
+#include "esp_brookesia_lv_render_profiler.hpp"
+#include "esp_brookesia_lv_scheduler.hpp"
 #include "esp_brookesia_lv_screen.hpp"
+#include "esp_brookesia_lv_tiled_snapshot.hpp"
 #include "esp_brookesia_lv_timer.hpp"
+#include "esp_brookesia_lv_touch_input.hpp"
@@ -0,0 +1,418 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <cstring>
+#include "esp_brookesia_gui_internal.h"
+#if !ESP_BROOKESIA_LVGL_ASSETS_ENABLE_DEBUG_LOG
+#   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
+#endif
+#include "private/esp_brookesia_lv_utils.hpp"
+#include "esp_brookesia_lv_assets.hpp"
+
+#define ASSETS_DATA_ALIGN   (4)
+
+namespace esp_brookesia::gui {
+
+LvAssets &LvAssets::getInstance()
+{
+    static LvAssets s_instance;
+    return s_instance;
+}
+
+LvAssets::~LvAssets()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    if (!del()) {
+        ESP_UTILS_LOGE("Delete failed");
+    }
+}
+
+bool LvAssets::addPartition(const LvAssetsPartitionConfig &config)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_NULL_RETURN(config.partition_label, false, "Invalid partition label");
+    ESP_UTILS_LOGD(
+        "Param: partition(%s), max_files(%d), checksum(0x%x)", config.partition_label, config.max_files,
+        static_cast<unsigned>(config.checksum)
+    );
+
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    if (hasPartition(config.partition_label)) {
+        ESP_UTILS_LOGD("Partition(%s) already added", config.partition_label);
+        return true;
+    }
+
+    mmap_assets_config_t asset_config = {
+        .partition_label = config.partition_label,
+        .max_files = config.max_files,
+        .checksum = config.checksum,
+        .flags = {
+            .mmap_enable = true,
+            .full_check = (config.checksum != 0),
+        },
+    };
+    mmap_assets_handle_t handle = nullptr;
+    ESP_UTILS_CHECK_ERROR_RETURN(mmap_assets_new(&asset_config, &handle), false, "Failed to create mmap assets");
+
+    auto file_num = mmap_assets_get_stored_files(handle);
+    for (int i = 0; i < file_num; i++) {
+        std::string name = mmap_assets_get_name(handle, i);
+        auto dot = name.rfind('.');
+        if (dot != std::string::npos) {
+            name.erase(dot);
+        }
+        if (_files.find(name) != _files.end()) {
+            ESP_UTILS_LOGW("Duplicate asset(%s) in partition(%s), ignored", name.c_str(), config.partition_label);
+            continue;
+        }
+        _files[name] = File{
+            .data = mmap_assets_get_mem(handle, i),
+            .size = static_cast<size_t>(mmap_assets_get_size(handle, i)),
+        };
+        ESP_UTILS_LOGD("Add asset(%s): size(%d)", name.c_str(), static_cast<int>(_files[name].size));
+    }
+    _partitions.emplace_back(config.partition_label, handle);
+
+    ESP_UTILS_LOGI("Added %d assets from partition(%s)", file_num, config.partition_label);
+
+    return true;
+}
+
+bool LvAssets::addMemory(const char *name, const void *data, size_t size)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_NULL_RETURN(name, false, "Invalid name");
+    ESP_UTILS_CHECK_FALSE_RETURN((data != nullptr) && (size > 0), false, "Invalid data");
+    ESP_UTILS_LOGD("Param: name(%s), data(%p), size(%d)", name, data, static_cast<int>(size));
+
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    ESP_UTILS_CHECK_FALSE_RETURN(_files.find(name) == _files.end(), false, "Asset(%s) already added", name);
+    _files[name] = File{
+        .data = static_cast<const uint8_t *>(data),
+        .size = size,
+    };
+
+    return true;
+}
+
+bool LvAssets::hasPartition(const char *partition_label) const
+{
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    for (auto &partition : _partitions) {
+        if (partition.first == partition_label) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool LvAssets::del()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    _images.clear();
+    _fonts.clear();
+    _files.clear();
+    for (auto &partition : _partitions) {
+        mmap_assets_del(partition.second);
+    }
+    _partitions.clear();
+    _mapped_size = 0;
+    _copied_size = 0;
+
+    return true;
+}
+
+const lv_image_dsc_t *LvAssets::getImage(const char *name)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(name, nullptr, "Invalid name");
+
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    auto it = _images.find(name);
+    if (it != _images.end()) {
+        return &it->second->dsc;
+    }
+
+    auto file = findFile(name);
+    ESP_UTILS_CHECK_NULL_RETURN(file, nullptr, "Image(%s) not found", name);
+
+    auto image = std::make_unique<Image>();
+    ESP_UTILS_CHECK_NULL_RETURN(image, nullptr, "Failed to create image");
+    ESP_UTILS_CHECK_FALSE_RETURN(createImage(*file, *image), nullptr, "Invalid image(%s)", name);
+    ESP_UTILS_LOGD(
+        "Create image(%s): %dx%d, cf(%d)", name, static_cast<int>(image->dsc.header.w),
+        static_cast<int>(image->dsc.header.h), static_cast<int>(image->dsc.header.cf)
+    );
+
+    return &_images.emplace(name, std::move(image)).first->second->dsc;
+}
+
+const lv_font_t *LvAssets::getFont(const char *name)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(name, nullptr, "Invalid name");
+
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    auto it = _fonts.find(name);
+    if (it != _fonts.end()) {
+        return &it->second->font;
+    }
+
+    auto file = findFile(name);
+    ESP_UTILS_CHECK_NULL_RETURN(file, nullptr, "Font(%s) not found", name);
+
+    auto font = std::make_unique<Font>();
+    ESP_UTILS_CHECK_NULL_RETURN(font, nullptr, "Failed to create font");
+    ESP_UTILS_CHECK_FALSE_RETURN(createFont(*file, *font), nullptr, "Invalid font(%s)", name);
+    ESP_UTILS_LOGD(
+        "Create font(%s): line height(%d), bpp(%d)", name, static_cast<int>(font->font.line_height),
+        static_cast<int>(font->dsc.bpp)
+    );
+
+    return &_fonts.emplace(name, std::move(font)).first->second->font;
+}
+
+const uint8_t *LvAssets::getFile(const char *name, size_t *size)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(name, nullptr, "Invalid name");
+
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    auto file = findFile(name);
+    ESP_UTILS_CHECK_NULL_RETURN(file, nullptr, "File(%s) not found", name);
+    if (size != nullptr) {
+        *size = file->size;
+    }
+
+    return file->data;
+}
+
+LvAssets::Stats LvAssets::getStats() const
+{
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    return {
+        .file_num = _files.size(),
+        .image_num = _images.size(),
+        .font_num = _fonts.size(),
+        .mapped_size = _mapped_size,
+        .copied_size = _copied_size,
+    };
+}
+
+void LvAssets::dump() const
+{
+    auto stats = getStats();
+
+    ESP_UTILS_LOGI(
+        "Assets: %d files in %d partitions, %d images and %d fonts requested, %d bytes mapped, %d bytes copied",
+        static_cast<int>(stats.file_num), static_cast<int>(_partitions.size()), static_cast<int>(stats.image_num),
+        static_cast<int>(stats.font_num), static_cast<int>(stats.mapped_size), static_cast<int>(stats.copied_size)
+    );
+}
+
+const LvAssets::File *LvAssets::findFile(const char *name) const
+{
+    auto it = _files.find(name);
+
+    return (it == _files.end()) ? nullptr : &it->second;
+}
+
+const uint8_t *LvAssets::alignData(const File &file, std::unique_ptr<uint8_t[]> &copy)
+{
+    if ((reinterpret_cast<uintptr_t>(file.data) % ASSETS_DATA_ALIGN) == 0) {
+        _mapped_size += file.size;
+        return file.data;
+    }
+
+    // The packed data can't be read in place by the 16/32-bit loads, so it's copied once
+    ESP_UTILS_LOGW("Asset at %p is misaligned, copy %d bytes", file.data, static_cast<int>(file.size));
+    copy.reset(new (std::nothrow) uint8_t[file.size]);
+    ESP_UTILS_CHECK_NULL_RETURN(copy, nullptr, "Failed to alloc copy");
+    memcpy(copy.get(), file.data, file.size);
+    _copied_size += file.size;
+
+    return copy.get();
+}
+
+bool LvAssets::createImage(const File &file, Image &image)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(file.size > sizeof(lv_image_header_t), false, "Invalid size");
+
+    lv_image_header_t header = {};
+    memcpy(&header, file.data, sizeof(header));
+    ESP_UTILS_CHECK_FALSE_RETURN(header.magic == LV_IMAGE_HEADER_MAGIC, false, "Invalid magic(0x%x)", header.magic);
+    auto cf = static_cast<lv_color_format_t>(header.cf);
+    uint32_t stride = (header.stride != 0) ? header.stride : lv_draw_buf_width_to_stride(header.w, cf);
+    size_t data_size = file.size - sizeof(header);
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (header.flags & LV_IMAGE_FLAGS_COMPRESSED) || LV_COLOR_FORMAT_IS_INDEXED(cf) ||
+        (data_size >= stride * header.h), false, "Data(%d) smaller than %dx%d", static_cast<int>(data_size),
+        static_cast<int>(stride), static_cast<int>(header.h)
+    );
+
+    auto data = alignData(file, image.copy);
+    ESP_UTILS_CHECK_NULL_RETURN(data, false, "Align data failed");
+
+    image.dsc.header = header;
+    image.dsc.header.stride = stride;
+    image.dsc.data_size = data_size;
+    image.dsc.data = data + sizeof(header);
+
+    return true;
+}
+
+bool LvAssets::createFont(const File &file, Font &font)
+{
+    using Header = esp_brookesia_lv_assets_font_header_t;
+
+    ESP_UTILS_CHECK_FALSE_RETURN(file.size > sizeof(Header), false, "Invalid size");
+
+    Header header = {};
+    memcpy(&header, file.data, sizeof(header));
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        header.magic == ESP_BROOKESIA_LV_ASSETS_FONT_MAGIC, false, "Invalid magic(0x%x)",
+        static_cast<unsigned>(header.magic)
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        header.version == ESP_BROOKESIA_LV_ASSETS_FONT_VERSION, false, "Unsupported version(%d)", header.version
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(header.size <= file.size, false, "Truncated font");
+    auto in_range = [&header](uint32_t offset, size_t size) {
+        return (offset != 0) && (offset % ASSETS_DATA_ALIGN == 0) && (offset + size <= header.size);
+    };
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        in_range(header.glyph_dsc_offset, header.glyph_num * sizeof(esp_brookesia_lv_assets_glyph_dsc_t)) &&
+        in_range(header.glyph_bitmap_offset, 0) &&
+        in_range(header.cmap_offset, header.cmap_num * sizeof(esp_brookesia_lv_assets_cmap_t)), false,
+        "Invalid offsets"
+    );
+
+    auto data = alignData(file, font.copy);
+    ESP_UTILS_CHECK_NULL_RETURN(data, false, "Align data failed");
+
+    // Glyph descriptors, used in place if the layout of LVGL is the same
+    auto glyph_dsc = reinterpret_cast<const esp_brookesia_lv_assets_glyph_dsc_t *>(data + header.glyph_dsc_offset);
+#if LV_FONT_FMT_TXT_LARGE
+    static_assert(
+        sizeof(lv_font_fmt_txt_glyph_dsc_t) == sizeof(esp_brookesia_lv_assets_glyph_dsc_t), "Glyph layout differs"
+    );
+    font.dsc.glyph_dsc = reinterpret_cast<const lv_font_fmt_txt_glyph_dsc_t *>(glyph_dsc);
+#else
+    font.glyph_dsc.resize(header.glyph_num);
+    for (size_t i = 0; i < header.glyph_num; i++) {
+        font.glyph_dsc[i].bitmap_index = glyph_dsc[i].bitmap_index;
+        font.glyph_dsc[i].adv_w = glyph_dsc[i].adv_w;
+        font.glyph_dsc[i].box_w = glyph_dsc[i].box_w;
+        font.glyph_dsc[i].box_h = glyph_dsc[i].box_h;
+        font.glyph_dsc[i].ofs_x = glyph_dsc[i].ofs_x;
+        font.glyph_dsc[i].ofs_y = glyph_dsc[i].ofs_y;
+    }
+    font.dsc.glyph_dsc = font.glyph_dsc.data();
+#endif
+
+    // Character maps, their lists are used in place
+    auto cmaps = reinterpret_cast<const esp_brookesia_lv_assets_cmap_t *>(data + header.cmap_offset);
+    font.cmaps.resize(header.cmap_num);
+    for (size_t i = 0; i < header.cmap_num; i++) {
+        auto &cmap = font.cmaps[i];
+        cmap.range_start = cmaps[i].range_start;
+        cmap.range_length = cmaps[i].range_length;
+        cmap.glyph_id_start = cmaps[i].glyph_id_start;
+        cmap.list_length = cmaps[i].list_length;
+        cmap.type = static_cast<lv_font_fmt_txt_cmap_type_t>(cmaps[i].type);
+        if (cmaps[i].unicode_list_offset != 0) {
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                in_range(cmaps[i].unicode_list_offset, cmap.list_length * sizeof(uint16_t)), false,
+                "Invalid unicode list"
+            );
+            cmap.unicode_list = reinterpret_cast<const uint16_t *>(data + cmaps[i].unicode_list_offset);
+        }
+        if (cmaps[i].glyph_id_ofs_list_offset != 0) {
+            size_t ofs_size = (cmap.type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) ? sizeof(uint16_t) : sizeof(uint8_t);
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                in_range(cmaps[i].glyph_id_ofs_list_offset, cmap.list_length * ofs_size), false,
+                "Invalid glyph ID list"
+            );
+            cmap.glyph_id_ofs_list = data + cmaps[i].glyph_id_ofs_list_offset;
+        }
+    }
+
+    // Kerning
+    switch (header.kern_type) {
+    case ESP_BROOKESIA_LV_ASSETS_KERN_NONE:
+        break;
+    case ESP_BROOKESIA_LV_ASSETS_KERN_PAIRS: {
+        esp_brookesia_lv_assets_kern_pairs_t pairs = {};
+        ESP_UTILS_CHECK_FALSE_RETURN(in_range(header.kern_offset, sizeof(pairs)), false, "Invalid kerning");
+        memcpy(&pairs, data + header.kern_offset, sizeof(pairs));
+        size_t id_size = (pairs.glyph_ids_size == 0) ? sizeof(uint8_t) : sizeof(uint16_t);
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            in_range(pairs.glyph_ids_offset, pairs.pair_cnt * 2 * id_size) &&
+            in_range(pairs.values_offset, pairs.pair_cnt), false, "Invalid kerning pairs"
+        );
+        font.kern_pairs.glyph_ids = data + pairs.glyph_ids_offset;
+        font.kern_pairs.values = reinterpret_cast<const int8_t *>(data + pairs.values_offset);
+        font.kern_pairs.pair_cnt = pairs.pair_cnt;
+        font.kern_pairs.glyph_ids_size = pairs.glyph_ids_size;
+        font.dsc.kern_dsc = &font.kern_pairs;
+        font.dsc.kern_classes = 0;
+        break;
+    }
+    case ESP_BROOKESIA_LV_ASSETS_KERN_CLASSES: {
+        esp_brookesia_lv_assets_kern_classes_t classes = {};
+        ESP_UTILS_CHECK_FALSE_RETURN(in_range(header.kern_offset, sizeof(classes)), false, "Invalid kerning");
+        memcpy(&classes, data + header.kern_offset, sizeof(classes));
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            in_range(classes.class_pair_values_offset, classes.left_class_cnt * classes.right_class_cnt) &&
+            in_range(classes.left_class_mapping_offset, header.glyph_num) &&
+            in_range(classes.right_class_mapping_offset, header.glyph_num), false, "Invalid kerning classes"
+        );
+        font.kern_classes.class_pair_values =
+            reinterpret_cast<const int8_t *>(data + classes.class_pair_values_offset);
+        font.kern_classes.left_class_mapping = data + classes.left_class_mapping_offset;
+        font.kern_classes.right_class_mapping = data + classes.right_class_mapping_offset;
+        font.kern_classes.left_class_cnt = classes.left_class_cnt;
+        font.kern_classes.right_class_cnt = classes.right_class_cnt;
+        font.dsc.kern_dsc = &font.kern_classes;
+        font.dsc.kern_classes = 1;
+        break;
+    }
+    default:
+        ESP_UTILS_LOGE("Invalid kerning type(%d)", header.kern_type);
+        return false;
+    }
+
+    font.dsc.glyph_bitmap = data + header.glyph_bitmap_offset;
+    font.dsc.cmaps = font.cmaps.data();
+    font.dsc.kern_scale = header.kern_scale;
+    font.dsc.cmap_num = header.cmap_num;
+    font.dsc.bpp = header.bpp;
+    font.dsc.bitmap_format = header.bitmap_format;
+
+    font.font.get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+    font.font.get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
+    font.font.line_height = header.line_height;
+    font.font.base_line = header.base_line;
+    font.font.subpx = LV_FONT_SUBPX_NONE;
+    font.font.underline_position = header.underline_position;
+    font.font.underline_thickness = header.underline_thickness;
+    font.font.dsc = &font.dsc;
+    font.font.fallback = nullptr;
+
+    return true;
+}
+
+} // namespace esp_brookesia::gui
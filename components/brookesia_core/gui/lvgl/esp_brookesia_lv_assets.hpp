@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "lvgl.h"
+#include "esp_mmap_assets.h"
+#include "esp_brookesia_lv_assets_format.h"
+
+namespace esp_brookesia::gui {
+
+struct LvAssetsPartitionConfig {
+    const char *partition_label;
+    int max_files;
+    uint32_t checksum;          /*!< Checksum of the generated `mmap_generate_<label>.h`, 0 to skip the check */
+};
+
+/**
+ * @brief Images and fonts packed by `tools/lv_assets_packer.py` into an assets partition, resolved by name (the file
+ *        name without its extension). The partition is memory mapped, so the pixels of the images and the glyphs of
+ *        the fonts are used in place, only their descriptors are created in RAM on the first request.
+ *
+ *        The descriptors stay valid until `del()`, so they can be given to LVGL like the compiled-in ones.
+ *
+ * @note  The functions are thread-safe, the descriptors should only be used by LVGL with its lock held
+ */
+class LvAssets {
+public:
+    struct Stats {
+        size_t file_num;
+        size_t image_num;           /*!< Requested images */
+        size_t font_num;            /*!< Requested fonts */
+        size_t mapped_size;         /*!< Size of the requested assets used in place */
+        size_t copied_size;         /*!< Size of the requested assets copied into RAM, e.g. because misaligned */
+    };
+
+    LvAssets(const LvAssets &) = delete;
+    LvAssets &operator=(const LvAssets &) = delete;
+
+    /**
+     * @brief Memory map an assets partition and index its files. Nothing is done if it's already added
+     */
+    bool addPartition(const LvAssetsPartitionConfig &config);
+    /**
+     * @brief Add an asset already in memory (e.g. read from the SD card), used in place. The data should stay valid
+     *        until `del()`
+     */
+    bool addMemory(const char *name, const void *data, size_t size);
+    bool hasPartition(const char *partition_label) const;
+    /**
+     * @brief Release the descriptors and unmap the partitions. Nothing should use the assets anymore
+     */
+    bool del();
+
+    /**
+     * @brief Get the descriptor of an image, created on the first request
+     *
+     * @return The descriptor, or nullptr if not found or not an image
+     */
+    const lv_image_dsc_t *getImage(const char *name);
+    /**
+     * @brief Get a font, created on the first request
+     *
+     * @return The font, or nullptr if not found or not a font
+     */
+    const lv_font_t *getFont(const char *name);
+    /**
+     * @brief Get the data of any file, e.g. a binary watchface
+     */
+    const uint8_t *getFile(const char *name, size_t *size = nullptr);
+
+    Stats getStats() const;
+    void dump() const;
+
+    static LvAssets &getInstance();
+
+private:
+    struct File {
+        const uint8_t *data;
+        size_t size;
+    };
+
+    struct Image {
+        lv_image_dsc_t dsc;
+        std::unique_ptr<uint8_t[]> copy;
+    };
+
+    struct Font {
+        lv_font_t font;
+        lv_font_fmt_txt_dsc_t dsc;
+        std::vector<lv_font_fmt_txt_cmap_t> cmaps;
+        lv_font_fmt_txt_kern_pair_t kern_pairs;
+        lv_font_fmt_txt_kern_classes_t kern_classes;
+        std::vector<lv_font_fmt_txt_glyph_dsc_t> glyph_dsc;  /*!< Only if the layout differs from the file */
+        std::unique_ptr<uint8_t[]> copy;
+    };
+
+    LvAssets() = default;
+    ~LvAssets();
+
+    const File *findFile(const char *name) const;
+    const uint8_t *alignData(const File &file, std::unique_ptr<uint8_t[]> &copy);
+    bool createImage(const File &file, Image &image);
+    bool createFont(const File &file, Font &font);
+
+    mutable std::recursive_mutex _mutex;
+    std::vector<std::pair<std::string, mmap_assets_handle_t>> _partitions;
+    std::unordered_map<std::string, File> _files;
+    std::unordered_map<std::string, std::unique_ptr<Image>> _images;
+    std::unordered_map<std::string, std::unique_ptr<Font>> _fonts;
+    size_t _mapped_size = 0;
+    size_t _copied_size = 0;
+};
+
+} // namespace esp_brookesia::gui
@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+/**
+ * @brief Binary font format of the assets partition, shared with `tools/lv_assets_packer.py`
+ *
+ * An image is stored in the binary format of LVGL: a `lv_image_header_t`, followed by the data (with the header of
+ * `lv_image_compressed_t` if compressed).
+ *
+ * A font is the data of a `lv_font_fmt_txt_dsc_t` without any pointer: a header, followed by sections referenced by
+ * their offsets. All the fields are little-endian, the offsets are relative to the start of the font and the sections
+ * are aligned to 4 bytes, so the glyph bitmaps and descriptors can be used in place once memory mapped.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ESP_BROOKESIA_LV_ASSETS_FONT_MAGIC      (0x31544642)    /*!< "BFT1" */
+#define ESP_BROOKESIA_LV_ASSETS_FONT_VERSION    (1)
+
+typedef enum {
+    ESP_BROOKESIA_LV_ASSETS_KERN_NONE = 0,
+    ESP_BROOKESIA_LV_ASSETS_KERN_PAIRS,             /*!< `esp_brookesia_lv_assets_kern_pairs_t` */
+    ESP_BROOKESIA_LV_ASSETS_KERN_CLASSES,           /*!< `esp_brookesia_lv_assets_kern_classes_t` */
+} esp_brookesia_lv_assets_kern_type_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t line_height;
+    int16_t base_line;
+    int8_t underline_position;
+    int8_t underline_thickness;
+    uint8_t bpp;
+    uint8_t bitmap_format;      /*!< `lv_font_fmt_txt_bitmap_format_t` */
+    uint8_t kern_type;          /*!< `esp_brookesia_lv_assets_kern_type_t` */
+    uint8_t reserved;
+    uint16_t kern_scale;
+    uint16_t cmap_num;
+    uint32_t glyph_num;
+    uint32_t glyph_dsc_offset;  /*!< `glyph_num` x `esp_brookesia_lv_assets_glyph_dsc_t` */
+    uint32_t glyph_bitmap_offset;
+    uint32_t cmap_offset;       /*!< `cmap_num` x `esp_brookesia_lv_assets_cmap_t` */
+    uint32_t kern_offset;       /*!< Depends on `kern_type`, 0 if none */
+    uint32_t size;              /*!< Size of the whole font */
+} esp_brookesia_lv_assets_font_header_t;
+
+/**
+ * @brief Same layout as `lv_font_fmt_txt_glyph_dsc_t` with `LV_FONT_FMT_TXT_LARGE` enabled
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t bitmap_index;
+    uint32_t adv_w;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+} esp_brookesia_lv_assets_glyph_dsc_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    uint16_t list_length;
+    uint8_t type;               /*!< `lv_font_fmt_txt_cmap_type_t` */
+    uint8_t reserved;
+    uint32_t unicode_list_offset;       /*!< `list_length` x `uint16_t`, 0 if none */
+    uint32_t glyph_id_ofs_list_offset;  /*!< `list_length` x `uint8_t` or `uint16_t` depending on `type`, 0 if none */
+} esp_brookesia_lv_assets_cmap_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t pair_cnt;
+    uint8_t glyph_ids_size;     /*!< 0: `uint8_t` glyph IDs, 1: `uint16_t` glyph IDs */
+    uint8_t reserved[3];
+    uint32_t glyph_ids_offset;  /*!< `pair_cnt` x 2 glyph IDs */
+    uint32_t values_offset;     /*!< `pair_cnt` x `int8_t` */
+} esp_brookesia_lv_assets_kern_pairs_t;
+
+typedef struct __attribute__((packed)) {
+    uint8_t left_class_cnt;
+    uint8_t right_class_cnt;
+    uint8_t reserved[2];
+    uint32_t class_pair_values_offset;  /*!< `left_class_cnt` x `right_class_cnt` x `int8_t` */
+    uint32_t left_class_mapping_offset; /*!< `glyph_num` x `uint8_t` */
+    uint32_t right_class_mapping_offset;
+} esp_brookesia_lv_assets_kern_classes_t;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,266 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include "esp_timer.h"
+#include "esp_brookesia_gui_internal.h"
+#if !ESP_BROOKESIA_LVGL_LATENCY_MONITOR_ENABLE_DEBUG_LOG
+#   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
+#endif
+#include "private/esp_brookesia_lv_utils.hpp"
+#include "esp_brookesia_lv_latency_monitor.hpp"
+
+namespace esp_brookesia::gui {
+
+LvLatencyMonitor &LvLatencyMonitor::getInstance()
+{
+    static LvLatencyMonitor s_instance;
+    return s_instance;
+}
+
+bool LvLatencyMonitor::begin(const Config &config, lv_display_t *display)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isRunning(), false, "Already running");
+    ESP_UTILS_CHECK_NULL_RETURN(display, false, "Invalid display");
+    ESP_UTILS_CHECK_FALSE_RETURN(config.history_size > 0, false, "Invalid history size");
+
+    _config = config;
+    for (auto &history : _histories) {
+        ESP_UTILS_CHECK_EXCEPTION_RETURN(
+            history.records.resize(_config.history_size), false, "Allocate history failed"
+        );
+    }
+    reset();
+
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_INVALIDATE_AREA, this);
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_RENDER_START, this);
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_RENDER_READY, this);
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_REFR_READY, this);
+    _display = display;
+
+    return true;
+}
+
+bool LvLatencyMonitor::del()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    if (_display != nullptr) {
+        lv_display_remove_event_cb_with_user_data(_display, onDisplayEventCallback, this);
+        _display = nullptr;
+    }
+    for (auto &history : _histories) {
+        history = {};
+    }
+    _probe = {};
+
+    return true;
+}
+
+void LvLatencyMonitor::beginProbe(int64_t irq_us, int64_t read_us)
+{
+    if (!isRunning() || (_probe.is_active && (_probe.stage >= Stage::Invalidate))) {
+        return;
+    }
+
+    _probe = {};
+    _probe.is_active = true;
+    _probe.stage = Stage::Read;
+    _probe.irq_us = std::min(irq_us, read_us);
+    _probe.record[static_cast<size_t>(Stage::Read)] = static_cast<uint32_t>(read_us - _probe.irq_us);
+}
+
+void LvLatencyMonitor::markDispatch(Interaction interaction)
+{
+    if (!_probe.is_active || (_probe.stage != Stage::Read)) {
+        return;
+    }
+
+    _probe.interaction = interaction;
+    markStage(Stage::Dispatch);
+}
+
+void LvLatencyMonitor::setInteraction(Interaction interaction)
+{
+    if (!_probe.is_active || (_probe.stage < Stage::Dispatch)) {
+        return;
+    }
+
+    _probe.interaction = interaction;
+}
+
+bool LvLatencyMonitor::getPercentiles(Interaction interaction, Stage stage, Percentiles &percentiles) const
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(interaction < Interaction::Max, false, "Invalid interaction");
+    ESP_UTILS_CHECK_FALSE_RETURN(stage < Stage::Max, false, "Invalid stage");
+
+    percentiles = {};
+
+    auto &history = _histories[static_cast<size_t>(interaction)];
+    if (history.count == 0) {
+        return true;
+    }
+
+    std::vector<uint32_t> latencies;
+    ESP_UTILS_CHECK_EXCEPTION_RETURN(latencies.reserve(history.count), false, "Allocate latencies failed");
+    for (size_t i = 0; i < history.count; i++) {
+        latencies.push_back(history.records[i][static_cast<size_t>(stage)]);
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    // Nearest rank, so a percentile is always one of the measured latencies
+    auto get_percentile = [&latencies](size_t percent) {
+        size_t rank = (percent * latencies.size() + 99) / 100;
+        return latencies[std::max<size_t>(rank, 1) - 1];
+    };
+    percentiles.count = latencies.size();
+    percentiles.p50_us = get_percentile(50);
+    percentiles.p90_us = get_percentile(90);
+    percentiles.p99_us = get_percentile(99);
+    percentiles.max_us = latencies.back();
+
+    return true;
+}
+
+void LvLatencyMonitor::reset()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    for (auto &history : _histories) {
+        history.head = 0;
+        history.count = 0;
+    }
+    _probe = {};
+}
+
+void LvLatencyMonitor::dump() const
+{
+    for (size_t i = 0; i < _histories.size(); i++) {
+        auto interaction = static_cast<Interaction>(i);
+        Percentiles total = {};
+        if (!getPercentiles(interaction, Stage::Flush, total) || (total.count == 0)) {
+            continue;
+        }
+
+        ESP_UTILS_LOGI(
+            "{Latency(%s)}: %d samples, touch to photon p50(%dus), p90(%dus), p99(%dus), max(%dus)",
+            getInteractionName(interaction), static_cast<int>(total.count), static_cast<int>(total.p50_us),
+            static_cast<int>(total.p90_us), static_cast<int>(total.p99_us), static_cast<int>(total.max_us)
+        );
+        for (size_t j = static_cast<size_t>(Stage::Read); j < static_cast<size_t>(Stage::Max); j++) {
+            auto stage = static_cast<Stage>(j);
+            Percentiles stage_percentiles = {};
+            if (!getPercentiles(interaction, stage, stage_percentiles)) {
+                continue;
+            }
+            ESP_UTILS_LOGI(
+                "\t-%-12s p50(%dus), p90(%dus), p99(%dus)", getStageName(stage),
+                static_cast<int>(stage_percentiles.p50_us), static_cast<int>(stage_percentiles.p90_us),
+                static_cast<int>(stage_percentiles.p99_us)
+            );
+        }
+    }
+}
+
+const char *LvLatencyMonitor::getStageName(Stage stage)
+{
+    switch (stage) {
+    case Stage::Irq:
+        return "irq";
+    case Stage::Read:
+        return "read";
+    case Stage::Dispatch:
+        return "dispatch";
+    case Stage::Invalidate:
+        return "invalidate";
+    case Stage::RenderStart:
+        return "render_start";
+    case Stage::RenderEnd:
+        return "render_end";
+    case Stage::Flush:
+        return "flush";
+    default:
+        return "unknown";
+    }
+}
+
+const char *LvLatencyMonitor::getInteractionName(Interaction interaction)
+{
+    switch (interaction) {
+    case Interaction::Tap:
+        return "tap";
+    case Interaction::Swipe:
+        return "swipe";
+    case Interaction::RecentsDrag:
+        return "recents_drag";
+    case Interaction::AppSwitch:
+        return "app_switch";
+    default:
+        return "unknown";
+    }
+}
+
+void LvLatencyMonitor::markStage(Stage stage)
+{
+    _probe.record[static_cast<size_t>(stage)] = static_cast<uint32_t>(esp_timer_get_time() - _probe.irq_us);
+    _probe.stage = stage;
+}
+
+void LvLatencyMonitor::finishProbe()
+{
+    auto &history = _histories[static_cast<size_t>(_probe.interaction)];
+    history.records[history.head] = _probe.record;
+    history.head = (history.head + 1) % history.records.size();
+    history.count = std::min(history.count + 1, history.records.size());
+
+    ESP_UTILS_LOGD(
+        "%s latency: %dus", getInteractionName(_probe.interaction),
+        static_cast<int>(_probe.record[static_cast<size_t>(Stage::Flush)])
+    );
+    _probe = {};
+}
+
+void LvLatencyMonitor::onDisplayEventCallback(lv_event_t *event)
+{
+    auto monitor = static_cast<LvLatencyMonitor *>(lv_event_get_user_data(event));
+    ESP_UTILS_CHECK_NULL_EXIT(monitor, "Invalid monitor");
+
+    if (!monitor->_probe.is_active) {
+        return;
+    }
+
+    // Every stage only counts once it follows the previous one, so the unrelated refreshes are skipped
+    auto stage = monitor->_probe.stage;
+    switch (lv_event_get_code(event)) {
+    case LV_EVENT_INVALIDATE_AREA:
+        if (stage == Stage::Dispatch) {
+            monitor->markStage(Stage::Invalidate);
+        }
+        break;
+    case LV_EVENT_RENDER_START:
+        if (stage == Stage::Invalidate) {
+            monitor->markStage(Stage::RenderStart);
+        }
+        break;
+    case LV_EVENT_RENDER_READY:
+        if (stage == Stage::RenderStart) {
+            monitor->markStage(Stage::RenderEnd);
+        }
+        break;
+    case LV_EVENT_REFR_READY:
+        // The refresh is only ready once the last area has been flushed
+        if (stage == Stage::RenderEnd) {
+            monitor->markStage(Stage::Flush);
+            monitor->finishProbe();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+} // namespace esp_brookesia::gui
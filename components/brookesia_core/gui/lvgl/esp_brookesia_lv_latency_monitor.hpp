@@ -0,0 +1,120 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <vector>
+#include "lvgl.h"
+
+namespace esp_brookesia::gui {
+
+/**
+ * @brief Measure the touch-to-photon latency: a touch sample is followed through the driver read, the gesture
+ *        dispatch, the first invalidated area, the rendering and the end of the flushing of the frame showing it
+ *
+ * @note  Except `begin()` and `del()`, everything should be called with the LVGL lock held
+ */
+class LvLatencyMonitor {
+public:
+    enum class Stage : uint8_t {
+        Irq = 0,        /*!< The touch IRQ, or the start of the read for the samples polled while pressed */
+        Read,
+        Dispatch,
+        Invalidate,
+        RenderStart,
+        RenderEnd,
+        Flush,
+        Max,
+    };
+
+    enum class Interaction : uint8_t {
+        Tap = 0,
+        Swipe,
+        RecentsDrag,
+        AppSwitch,      /*!< From an app back to the home screen, the frame shows the home screen */
+        Max,
+    };
+
+    struct Config {
+        size_t history_size;    /*!< Number of latencies kept per interaction to compute the percentiles */
+    };
+
+    struct Percentiles {
+        uint32_t count;
+        uint32_t p50_us;
+        uint32_t p90_us;
+        uint32_t p99_us;
+        uint32_t max_us;
+    };
+
+    LvLatencyMonitor(const LvLatencyMonitor &) = delete;
+    LvLatencyMonitor &operator=(const LvLatencyMonitor &) = delete;
+
+    bool begin(const Config &config, lv_display_t *display);
+    bool del();
+
+    /**
+     * @brief Start following a touch sample. It's ignored while a previous sample has invalidated an area and waits
+     *        for its frame, as both are shown by the same frame. A previous sample which changed nothing is dropped
+     *
+     * @param[in] irq_us Time of the touch IRQ
+     * @param[in] read_us Time at which the sample has been read from the driver
+     */
+    void beginProbe(int64_t irq_us, int64_t read_us);
+    /**
+     * @brief Mark the sample as dispatched to the gesture handlers
+     */
+    void markDispatch(Interaction interaction);
+    /**
+     * @brief Refine the interaction of the dispatched sample, for the handlers knowing better (e.g. recents drag)
+     */
+    void setInteraction(Interaction interaction);
+
+    bool isRunning() const
+    {
+        return (_display != nullptr);
+    }
+    /**
+     * @brief Get the percentiles of the latency from the IRQ to a stage
+     */
+    bool getPercentiles(Interaction interaction, Stage stage, Percentiles &percentiles) const;
+    void reset();
+    void dump() const;
+
+    static const char *getStageName(Stage stage);
+    static const char *getInteractionName(Interaction interaction);
+    static LvLatencyMonitor &getInstance();
+
+private:
+    using Record = std::array<uint32_t, static_cast<size_t>(Stage::Max)>;
+
+    struct History {
+        std::vector<Record> records;
+        size_t head;
+        size_t count;
+    };
+
+    LvLatencyMonitor() = default;
+    ~LvLatencyMonitor() = default;
+
+    void markStage(Stage stage);
+    void finishProbe();
+
+    static void onDisplayEventCallback(lv_event_t *event);
+
+    Config _config = {};
+    lv_display_t *_display = nullptr;
+    struct {
+        bool is_active;
+        Stage stage;            /*!< Last reached stage */
+        Interaction interaction;
+        int64_t irq_us;
+        Record record;          /*!< Time since the IRQ of every stage */
+    } _probe = {};
+    std::array<History, static_cast<size_t>(Interaction::Max)> _histories = {};
+};
+
+} // namespace esp_brookesia::gui
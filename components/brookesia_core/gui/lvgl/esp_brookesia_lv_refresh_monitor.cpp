@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include "esp_timer.h"
+#include "esp_brookesia_gui_internal.h"
+#if !ESP_BROOKESIA_LVGL_REFRESH_MONITOR_ENABLE_DEBUG_LOG
+#   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
+#endif
+#include "private/esp_brookesia_lv_utils.hpp"
+#include "esp_brookesia_lv_refresh_monitor.hpp"
+
+namespace esp_brookesia::gui {
+
+LvRefreshMonitor::LvRefreshMonitor(lv_display_t *display)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_LOGD("Param: display(0x%p)", display);
+    ESP_UTILS_CHECK_NULL_EXIT(display, "Invalid display");
+
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_REFR_START, this);
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_FLUSH_START, this);
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_FLUSH_FINISH, this);
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_FLUSH_WAIT_START, this);
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_FLUSH_WAIT_FINISH, this);
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_REFR_READY, this);
+    _display = display;
+
+    reset();
+}
+
+LvRefreshMonitor::~LvRefreshMonitor()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    if (isValid()) {
+        lv_display_remove_event_cb_with_user_data(_display, onDisplayEventCallback, this);
+    }
+}
+
+void LvRefreshMonitor::reset()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    _frame = {};
+    _stats = {};
+    _stats.start_us = esp_timer_get_time();
+}
+
+uint32_t LvRefreshMonitor::getFlushedPixelsPerSecond() const
+{
+    auto elapsed_us = esp_timer_get_time() - _stats.start_us;
+    if (elapsed_us <= 0) {
+        return 0;
+    }
+
+    return static_cast<uint32_t>(_stats.flushed_px_total * 1000000 / elapsed_us);
+}
+
+uint32_t LvRefreshMonitor::getFramesPerSecondX100() const
+{
+    auto elapsed_us = esp_timer_get_time() - _stats.start_us;
+    if (elapsed_us <= 0) {
+        return 0;
+    }
+
+    return static_cast<uint32_t>(static_cast<uint64_t>(_stats.frame_count) * 100000000 / elapsed_us);
+}
+
+uint32_t LvRefreshMonitor::getOverlapPercent() const
+{
+    if (_stats.render_us_total == 0) {
+        return 0;
+    }
+
+    auto wait_us = std::min(_stats.flush_wait_us_total, _stats.render_us_total);
+    return static_cast<uint32_t>((_stats.render_us_total - wait_us) * 100 / _stats.render_us_total);
+}
+
+void LvRefreshMonitor::dump(const char *name) const
+{
+    ESP_UTILS_LOGI(
+        "{Refresh(%s)}:\n"
+        "\t-Frames(%d)\n"
+        "\t-Last(%dus, %dpx in %d areas)\n"
+        "\t-Render avg(%dus), max(%dus)\n"
+        "\t-Flush callback avg(%dus), wait avg(%dus), overlap(%d%%)\n"
+        "\t-Flushed(%dpx/s), fps(%d.%02d)",
+        (name != nullptr) ? name : "", static_cast<int>(_stats.frame_count), static_cast<int>(_stats.last.render_us),
+        static_cast<int>(_stats.last.flushed_px), static_cast<int>(_stats.last.flush_count),
+        static_cast<int>((_stats.frame_count > 0) ? (_stats.render_us_total / _stats.frame_count) : 0),
+        static_cast<int>(_stats.render_us_max),
+        static_cast<int>((_stats.frame_count > 0) ? (_stats.flush_cb_us_total / _stats.frame_count) : 0),
+        static_cast<int>((_stats.frame_count > 0) ? (_stats.flush_wait_us_total / _stats.frame_count) : 0),
+        static_cast<int>(getOverlapPercent()), static_cast<int>(getFlushedPixelsPerSecond()),
+        static_cast<int>(getFramesPerSecondX100() / 100), static_cast<int>(getFramesPerSecondX100() % 100)
+    );
+}
+
+void LvRefreshMonitor::onDisplayEventCallback(lv_event_t *event)
+{
+    auto monitor = static_cast<LvRefreshMonitor *>(lv_event_get_user_data(event));
+    ESP_UTILS_CHECK_NULL_EXIT(monitor, "Invalid monitor");
+
+    switch (lv_event_get_code(event)) {
+    case LV_EVENT_REFR_START:
+        monitor->_refresh_start_us = esp_timer_get_time();
+        monitor->_frame = {};
+        break;
+    case LV_EVENT_FLUSH_START: {
+        auto area = static_cast<const lv_area_t *>(lv_event_get_param(event));
+        if (area != nullptr) {
+            monitor->_frame.flushed_px += lv_area_get_size(area);
+            monitor->_frame.flush_count++;
+        }
+        monitor->_flush_start_us = esp_timer_get_time();
+        break;
+    }
+    case LV_EVENT_FLUSH_FINISH:
+        if (monitor->_flush_start_us != 0) {
+            monitor->_frame.flush_cb_us += static_cast<uint32_t>(esp_timer_get_time() - monitor->_flush_start_us);
+            monitor->_flush_start_us = 0;
+        }
+        break;
+    case LV_EVENT_FLUSH_WAIT_START:
+        monitor->_flush_wait_start_us = esp_timer_get_time();
+        break;
+    case LV_EVENT_FLUSH_WAIT_FINISH:
+        if (monitor->_flush_wait_start_us != 0) {
+            monitor->_frame.flush_wait_us +=
+                static_cast<uint32_t>(esp_timer_get_time() - monitor->_flush_wait_start_us);
+            monitor->_flush_wait_start_us = 0;
+        }
+        break;
+    case LV_EVENT_REFR_READY: {
+        // The refresh timer runs periodically, skip the ones without anything to draw
+        if (monitor->_frame.flush_count == 0) {
+            break;
+        }
+        auto &frame = monitor->_frame;
+        auto &stats = monitor->_stats;
+        frame.render_us = static_cast<uint32_t>(esp_timer_get_time() - monitor->_refresh_start_us);
+        stats.last = frame;
+        stats.frame_count++;
+        stats.render_us_max = std::max(stats.render_us_max, frame.render_us);
+        stats.render_us_total += frame.render_us;
+        stats.flushed_px_total += frame.flushed_px;
+        stats.flush_cb_us_total += frame.flush_cb_us;
+        stats.flush_wait_us_total += frame.flush_wait_us;
+        if (monitor->_frame_callback) {
+            monitor->_frame_callback(frame);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+} // namespace esp_brookesia::gui
@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <functional>
+#include <memory>
+#include "lvgl.h"
+
+namespace esp_brookesia::gui {
+
+/**
+ * @brief Measure the render time and the flushed area of every display refresh that actually draws something.
+ *
+ *        With two draw buffers, LVGL renders the next area while the previous one is being sent to the panel, and
+ *        only waits for the transfer when both buffers are in use. The time spent in the flush callback and waiting
+ *        for the transfers shows how much of the flushing is hidden behind the rendering.
+ */
+class LvRefreshMonitor {
+public:
+    struct Frame {
+        uint32_t render_us;     /*!< From the refresh start to the refresh ready, including the flushing */
+        uint32_t flushed_px;    /*!< Sum of the flushed areas */
+        uint32_t flush_count;   /*!< Number of flushed areas */
+        uint32_t flush_cb_us;   /*!< In the flush callback, e.g. swapping the bytes and queueing the transfer */
+        uint32_t flush_wait_us; /*!< Waiting for a transfer to free a draw buffer */
+    };
+
+    struct Stats {
+        Frame last;
+        uint32_t frame_count;
+        uint32_t render_us_max;
+        uint64_t render_us_total;
+        uint64_t flushed_px_total;
+        uint64_t flush_cb_us_total;
+        uint64_t flush_wait_us_total;
+        int64_t start_us;       /*!< Time of the last `reset()` */
+    };
+
+    using FrameCallback = std::function<void(const Frame &frame)>;
+
+    LvRefreshMonitor(lv_display_t *display);
+    ~LvRefreshMonitor();
+
+    LvRefreshMonitor(const LvRefreshMonitor &other) = delete;
+    LvRefreshMonitor &operator=(const LvRefreshMonitor &other) = delete;
+
+    void setFrameCallback(FrameCallback callback)
+    {
+        _frame_callback = callback;
+    }
+    void reset();
+
+    bool isValid() const
+    {
+        return (_display != nullptr);
+    }
+    const Stats &getStats() const
+    {
+        return _stats;
+    }
+    uint32_t getFlushedPixelsPerSecond() const;
+    /**
+     * @brief Get the frame rate since the last `reset()`, in hundredths of frames per second
+     */
+    uint32_t getFramesPerSecondX100() const;
+    /**
+     * @brief Get the share of the render time not spent waiting for the transfers, in percent. It's 100 when the
+     *        transfers are fully hidden behind the rendering, and drops with a single draw buffer
+     */
+    uint32_t getOverlapPercent() const;
+    void dump(const char *name) const;
+
+private:
+    static void onDisplayEventCallback(lv_event_t *event);
+
+    lv_display_t *_display = nullptr;
+    int64_t _refresh_start_us = 0;
+    int64_t _flush_start_us = 0;
+    int64_t _flush_wait_start_us = 0;
+    Frame _frame{};
+    Stats _stats{};
+    FrameCallback _frame_callback = nullptr;
+};
+
+using LvRefreshMonitorUniquePtr = std::unique_ptr<LvRefreshMonitor>;
+
+} // namespace esp_brookesia::gui
@@ -0,0 +1,662 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include <cstring>
+#include "esp_timer.h"
+#include "esp_brookesia_gui_internal.h"
+#if !ESP_BROOKESIA_LVGL_RENDER_PROFILER_ENABLE_DEBUG_LOG
+#   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
+#endif
+#include "private/esp_brookesia_lv_utils.hpp"
+#include "esp_brookesia_lv_render_profiler.hpp"
+
+#define OVERLAY_PERIOD_MS           (1000)
+#define FRAME_OBJECT_NUM_DEFAULT    (64)
+#define OWNER_NAME_SCREEN           "Screen"
+#define OWNER_NAME_TOP_LAYER        "TopLayer"
+#define OWNER_NAME_OTHER            "Other"
+
+namespace esp_brookesia::gui {
+
+LvRenderProfiler &LvRenderProfiler::getInstance()
+{
+    static LvRenderProfiler s_instance;
+    return s_instance;
+}
+
+bool LvRenderProfiler::begin(const Config &config, lv_display_t *display)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isRunning(), false, "Already running");
+    ESP_UTILS_CHECK_NULL_RETURN(display, false, "Invalid display");
+    ESP_UTILS_CHECK_FALSE_RETURN(config.frame_num > 0, false, "Invalid frame num");
+    ESP_UTILS_CHECK_FALSE_RETURN(config.top_num > 0, false, "Invalid top num");
+
+    _config = config;
+    ESP_UTILS_CHECK_EXCEPTION_RETURN(_frames.resize(_config.frame_num), false, "Allocate frames failed");
+    for (auto &frame : _frames) {
+        ESP_UTILS_CHECK_EXCEPTION_RETURN(
+            frame.objects.reserve(_config.top_num), false, "Allocate frame objects failed"
+        );
+    }
+    ESP_UTILS_CHECK_EXCEPTION_RETURN(
+        _frame_objects.reserve(FRAME_OBJECT_NUM_DEFAULT), false, "Allocate objects failed"
+    );
+    reset();
+
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_INVALIDATE_AREA, this);
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_REFR_START, this);
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_FLUSH_START, this);
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_FLUSH_FINISH, this);
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_FLUSH_WAIT_START, this);
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_FLUSH_WAIT_FINISH, this);
+    lv_display_add_event_cb(display, onDisplayEventCallback, LV_EVENT_REFR_READY, this);
+    _display = display;
+
+    // The automatic owners are added on the first refresh
+    for (auto &owner : _owners) {
+        hookTree(owner.root);
+    }
+
+    return true;
+}
+
+bool LvRenderProfiler::del()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    setOverlayCallback(nullptr);
+    if (_display != nullptr) {
+        lv_display_remove_event_cb_with_user_data(_display, onDisplayEventCallback, this);
+        _display = nullptr;
+    }
+
+    // Keep the owners registered by the widgets, they are hooked again by the next `begin()`
+    for (auto it = _owners.begin(); it != _owners.end();) {
+        unhookTree(it->root);
+        if (it->is_auto) {
+            lv_obj_remove_event_cb_with_user_data(it->root, onOwnerDeleteCallback, this);
+            it = _owners.erase(it);
+        } else {
+            it++;
+        }
+    }
+
+    _frames = {};
+    _frame_objects = {};
+    _draw_stack = {};
+    _frame_head = 0;
+    _frame_count = 0;
+    _is_refreshing = false;
+
+    return true;
+}
+
+void LvRenderProfiler::addOwner(lv_obj_t *root, const char *name)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_LOGD("Param: root(0x%p), name(%s)", root, name);
+    ESP_UTILS_CHECK_NULL_EXIT(root, "Invalid root");
+    ESP_UTILS_CHECK_NULL_EXIT(name, "Invalid name");
+
+    auto it = std::find_if(_owners.begin(), _owners.end(), [root](const Owner & owner) {
+        return owner.root == root;
+    });
+    if (it != _owners.end()) {
+        it->name = name;
+        it->is_auto = false;
+        return;
+    }
+
+    ESP_UTILS_CHECK_EXCEPTION_EXIT(_owners.push_back({root, name, false}), "Add owner failed");
+    lv_obj_add_event_cb(root, onOwnerDeleteCallback, LV_EVENT_DELETE, this);
+    if (isRunning()) {
+        hookTree(root);
+    }
+}
+
+void LvRenderProfiler::removeOwner(lv_obj_t *root)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    auto it = std::find_if(_owners.begin(), _owners.end(), [root](const Owner & owner) {
+        return owner.root == root;
+    });
+    if (it == _owners.end()) {
+        return;
+    }
+
+    lv_obj_remove_event_cb_with_user_data(root, onOwnerDeleteCallback, this);
+    _owners.erase(it);
+    if (!isRunning()) {
+        return;
+    }
+
+    // The tree may contain other owners or be part of one, so hook them again
+    unhookTree(root);
+    for (auto &owner : _owners) {
+        hookTree(owner.root);
+    }
+}
+
+bool LvRenderProfiler::setOverlayCallback(OverlayCallback callback)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    if (callback == nullptr) {
+        if (_overlay_timer != nullptr) {
+            lv_timer_delete(_overlay_timer);
+            _overlay_timer = nullptr;
+        }
+        _overlay_callback = nullptr;
+        return true;
+    }
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isRunning(), false, "Not running");
+
+    if (_overlay_timer == nullptr) {
+        _overlay_timer = lv_timer_create([](lv_timer_t *timer) {
+            auto profiler = static_cast<LvRenderProfiler *>(lv_timer_get_user_data(timer));
+            ESP_UTILS_CHECK_NULL_EXIT(profiler, "Invalid profiler");
+            profiler->updateOverlay();
+        }, OVERLAY_PERIOD_MS, this);
+        ESP_UTILS_CHECK_NULL_RETURN(_overlay_timer, false, "Create overlay timer failed");
+    }
+    _overlay_callback = callback;
+    _overlay_frame_total = _frame_total;
+
+    return true;
+}
+
+const LvRenderProfiler::Frame *LvRenderProfiler::getFrame(size_t index) const
+{
+    if (index >= _frame_count) {
+        return nullptr;
+    }
+
+    return &_frames[(_frame_head + _frames.size() - _frame_count + index) % _frames.size()];
+}
+
+void LvRenderProfiler::reset()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    _frame_head = 0;
+    _frame_count = 0;
+    _frame_total = 0;
+    _overlay_frame_total = 0;
+    _pending_invalidated_px = 0;
+    _pending_invalidated_count = 0;
+}
+
+void LvRenderProfiler::dump() const
+{
+    if (_frame_count == 0) {
+        ESP_UTILS_LOGI("{RenderProfiler}: No frame");
+        return;
+    }
+
+    struct OwnerCost {
+        const char *name;
+        uint64_t draw_us;
+    };
+    std::vector<OwnerCost> owner_costs;
+    uint64_t refresh_us_total = 0;
+    uint64_t flush_us_total = 0;
+    uint64_t invalidated_px_total = 0;
+    uint32_t refresh_us_max = 0;
+    for (size_t i = 0; i < _frame_count; i++) {
+        auto frame = getFrame(i);
+        refresh_us_total += frame->refresh_us;
+        flush_us_total += frame->flush_us;
+        invalidated_px_total += frame->invalidated_px;
+        refresh_us_max = std::max(refresh_us_max, frame->refresh_us);
+        for (auto &object : frame->objects) {
+            auto it = std::find_if(owner_costs.begin(), owner_costs.end(), [&object](const OwnerCost & cost) {
+                return strcmp(cost.name, object.owner) == 0;
+            });
+            if (it == owner_costs.end()) {
+                owner_costs.push_back({object.owner, object.draw_us});
+            } else {
+                it->draw_us += object.draw_us;
+            }
+        }
+    }
+    std::sort(owner_costs.begin(), owner_costs.end(), [](const OwnerCost & a, const OwnerCost & b) {
+        return a.draw_us > b.draw_us;
+    });
+
+    ESP_UTILS_LOGI(
+        "{RenderProfiler}:\n"
+        "\t-Frames(%d)\n"
+        "\t-Refresh avg(%dus), max(%dus)\n"
+        "\t-Flush avg(%dus)\n"
+        "\t-Invalidated avg(%dpx)",
+        static_cast<int>(_frame_count), static_cast<int>(refresh_us_total / _frame_count),
+        static_cast<int>(refresh_us_max), static_cast<int>(flush_us_total / _frame_count),
+        static_cast<int>(invalidated_px_total / _frame_count)
+    );
+    for (auto &cost : owner_costs) {
+        ESP_UTILS_LOGI(
+            "\t-%-16s draw avg(%dus)", cost.name, static_cast<int>(cost.draw_us / _frame_count)
+        );
+    }
+}
+
+bool LvRenderProfiler::dumpTrace(FILE *file) const
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_NULL_RETURN(file, false, "Invalid file");
+
+    // One track per rank, so the objects of a frame never overlap on a track
+    fprintf(file, "{\"traceEvents\":[\n");
+    fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"refresh\"}}");
+    for (size_t i = 0; i < _config.top_num; i++) {
+        fprintf(
+            file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"top %d\"}}",
+            static_cast<int>(i + 2), static_cast<int>(i + 1)
+        );
+    }
+    for (size_t i = 0; i < _frame_count; i++) {
+        auto frame = getFrame(i);
+        fprintf(
+            file, ",\n{\"name\":\"refresh\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%lld,\"dur\":%d,"
+            "\"args\":{\"flush_us\":%d,\"invalidated_px\":%d,\"invalidated_count\":%d,\"flushed_px\":%d}}",
+            static_cast<long long>(frame->start_us), static_cast<int>(frame->refresh_us),
+            static_cast<int>(frame->flush_us), static_cast<int>(frame->invalidated_px),
+            static_cast<int>(frame->invalidated_count), static_cast<int>(frame->flushed_px)
+        );
+        fprintf(
+            file, ",\n{\"name\":\"invalidated_px\",\"ph\":\"C\",\"pid\":1,\"ts\":%lld,\"args\":{\"px\":%d}}",
+            static_cast<long long>(frame->start_us), static_cast<int>(frame->invalidated_px)
+        );
+        for (size_t j = 0; j < frame->objects.size(); j++) {
+            auto &object = frame->objects[j];
+            fprintf(
+                file, ",\n{\"name\":\"%s/%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%lld,\"dur\":%d,"
+                "\"args\":{\"obj\":\"%p\",\"draw_count\":%d}}",
+                object.owner, getClassName(object.class_p), static_cast<int>(j + 2),
+                static_cast<long long>(object.start_us), static_cast<int>(object.draw_us), object.obj,
+                static_cast<int>(object.draw_count)
+            );
+        }
+    }
+    fprintf(file, "\n]}\n");
+    fflush(file);
+
+    ESP_UTILS_CHECK_FALSE_RETURN(ferror(file) == 0, false, "Write trace failed");
+
+    return true;
+}
+
+const char *LvRenderProfiler::getClassName(const lv_obj_class_t *class_p)
+{
+    static const struct {
+        const lv_obj_class_t *class_p;
+        const char *name;
+    } classes[] = {
+        {&lv_obj_class, "obj"},
+#if LV_USE_LABEL
+        {&lv_label_class, "label"},
+#endif
+#if LV_USE_IMAGE
+        {&lv_image_class, "image"},
+#endif
+#if LV_USE_BUTTON
+        {&lv_button_class, "button"},
+#endif
+#if LV_USE_CANVAS
+        {&lv_canvas_class, "canvas"},
+#endif
+#if LV_USE_ARC
+        {&lv_arc_class, "arc"},
+#endif
+#if LV_USE_BAR
+        {&lv_bar_class, "bar"},
+#endif
+#if LV_USE_SLIDER
+        {&lv_slider_class, "slider"},
+#endif
+#if LV_USE_SWITCH
+        {&lv_switch_class, "switch"},
+#endif
+#if LV_USE_LINE
+        {&lv_line_class, "line"},
+#endif
+#if LV_USE_TEXTAREA
+        {&lv_textarea_class, "textarea"},
+#endif
+#if LV_USE_ROLLER
+        {&lv_roller_class, "roller"},
+#endif
+#if LV_USE_DROPDOWN
+        {&lv_dropdown_class, "dropdown"},
+#endif
+#if LV_USE_SPINNER
+        {&lv_spinner_class, "spinner"},
+#endif
+#if LV_USE_IMAGEBUTTON
+        {&lv_imagebutton_class, "imagebutton"},
+#endif
+#if LV_USE_CHART
+        {&lv_chart_class, "chart"},
+#endif
+#if LV_USE_SCALE
+        {&lv_scale_class, "scale"},
+#endif
+    };
+
+    for (auto &entry : classes) {
+        if (entry.class_p == class_p) {
+            return entry.name;
+        }
+    }
+
+    return "custom";
+}
+
+void LvRenderProfiler::hookTree(lv_obj_t *root)
+{
+    lv_obj_tree_walk(root, [](lv_obj_t *obj, void *user_data) {
+        static_cast<LvRenderProfiler *>(user_data)->hookObject(obj);
+        return LV_OBJ_TREE_WALK_NEXT;
+    }, this);
+}
+
+void LvRenderProfiler::unhookTree(lv_obj_t *root)
+{
+    lv_obj_tree_walk(root, [](lv_obj_t *obj, void *user_data) {
+        lv_obj_remove_event_cb_with_user_data(obj, onObjectEventCallback, user_data);
+        return LV_OBJ_TREE_WALK_NEXT;
+    }, this);
+}
+
+bool LvRenderProfiler::hookObject(lv_obj_t *obj)
+{
+    // The trees of the owners may overlap, so only hook once
+    auto event_count = lv_obj_get_event_count(obj);
+    for (uint32_t i = 0; i < event_count; i++) {
+        auto dsc = lv_obj_get_event_dsc(obj, i);
+        if ((lv_event_dsc_get_cb(dsc) == onObjectEventCallback) && (lv_event_dsc_get_user_data(dsc) == this)) {
+            return false;
+        }
+    }
+
+    // A single callback for all the events, since every descriptor costs RAM on every object
+    lv_obj_add_event_cb(obj, onObjectEventCallback, LV_EVENT_ALL, this);
+
+    return true;
+}
+
+void LvRenderProfiler::hookAutoOwners()
+{
+    lv_obj_t *roots[] = {lv_display_get_screen_active(_display), lv_display_get_layer_top(_display)};
+    const char *names[] = {OWNER_NAME_SCREEN, OWNER_NAME_TOP_LAYER};
+
+    for (size_t i = 0; i < sizeof(roots) / sizeof(roots[0]); i++) {
+        auto root = roots[i];
+        if (root == nullptr) {
+            continue;
+        }
+        auto it = std::find_if(_owners.begin(), _owners.end(), [root](const Owner & owner) {
+            return owner.root == root;
+        });
+        if (it != _owners.end()) {
+            continue;
+        }
+
+        ESP_UTILS_LOGD("Add automatic owner(%s): 0x%p", names[i], root);
+        ESP_UTILS_CHECK_EXCEPTION_EXIT(_owners.push_back({root, names[i], true}), "Add owner failed");
+        lv_obj_add_event_cb(root, onOwnerDeleteCallback, LV_EVENT_DELETE, this);
+        hookTree(root);
+    }
+}
+
+const char *LvRenderProfiler::findOwner(const lv_obj_t *obj) const
+{
+    // The innermost owner wins, e.g. the status bar over the screen it's on
+    for (auto parent = obj; parent != nullptr; parent = lv_obj_get_parent(parent)) {
+        for (auto &owner : _owners) {
+            if (owner.root == parent) {
+                return owner.name;
+            }
+        }
+    }
+
+    return OWNER_NAME_OTHER;
+}
+
+void LvRenderProfiler::beginDraw(const lv_obj_t *obj)
+{
+    ESP_UTILS_CHECK_EXCEPTION_EXIT(
+        _draw_stack.push_back({obj, esp_timer_get_time(), 0}), "Push draw scope failed"
+    );
+}
+
+void LvRenderProfiler::endDraw(const lv_obj_t *obj)
+{
+    if (_draw_stack.empty() || (_draw_stack.back().obj != obj)) {
+        ESP_UTILS_LOGD("Unbalanced draw of 0x%p, drop the scopes", obj);
+        _draw_stack.clear();
+        return;
+    }
+
+    auto scope = _draw_stack.back();
+    _draw_stack.pop_back();
+
+    auto inclusive_us = static_cast<uint32_t>(esp_timer_get_time() - scope.start_us);
+    if (!_draw_stack.empty()) {
+        _draw_stack.back().children_us += inclusive_us;
+    }
+
+    auto it = _frame_objects.find(obj);
+    if (it == _frame_objects.end()) {
+        ObjectCost cost = {obj, lv_obj_get_class(obj), findOwner(obj), scope.start_us, 0, 0};
+        ESP_UTILS_CHECK_EXCEPTION_EXIT(
+            it = _frame_objects.emplace(obj, cost).first, "Add object cost failed"
+        );
+    }
+    it->second.draw_us += inclusive_us - std::min(inclusive_us, scope.children_us);
+    it->second.draw_count++;
+}
+
+void LvRenderProfiler::finishFrame()
+{
+    auto &slot = _frames[_frame_head];
+    auto objects = std::move(slot.objects);
+    slot = _frame;
+    slot.refresh_us = static_cast<uint32_t>(esp_timer_get_time() - _frame.start_us);
+
+    // Keep the top objects with a min-heap, then sort them from the most costly
+    auto is_cheaper = [](const ObjectCost & a, const ObjectCost & b) {
+        return a.draw_us > b.draw_us;
+    };
+    objects.clear();
+    for (auto &[obj, cost] : _frame_objects) {
+        if (objects.size() < _config.top_num) {
+            objects.push_back(cost);
+            std::push_heap(objects.begin(), objects.end(), is_cheaper);
+        } else if (cost.draw_us > objects.front().draw_us) {
+            std::pop_heap(objects.begin(), objects.end(), is_cheaper);
+            objects.back() = cost;
+            std::push_heap(objects.begin(), objects.end(), is_cheaper);
+        }
+    }
+    std::sort_heap(objects.begin(), objects.end(), is_cheaper);
+    slot.objects = std::move(objects);
+
+    _frame_head = (_frame_head + 1) % _frames.size();
+    _frame_count = std::min(_frame_count + 1, _frames.size());
+    _frame_total++;
+
+    ESP_UTILS_LOGD(
+        "Frame: refresh(%dus), flush(%dus), invalidated(%dpx), objects(%d)", static_cast<int>(slot.refresh_us),
+        static_cast<int>(slot.flush_us), static_cast<int>(slot.invalidated_px),
+        static_cast<int>(_frame_objects.size())
+    );
+}
+
+void LvRenderProfiler::updateOverlay()
+{
+    if ((_overlay_callback == nullptr) || !isRunning()) {
+        return;
+    }
+
+    // The overlay also causes a frame, which is counted by the next update
+    auto frame_num = static_cast<size_t>(std::min<uint64_t>(_frame_total - _overlay_frame_total, _frame_count));
+    _overlay_frame_total = _frame_total;
+
+    uint64_t refresh_us_total = 0;
+    uint64_t flush_us_total = 0;
+    const ObjectCost *top_object = nullptr;
+    for (size_t i = _frame_count - frame_num; i < _frame_count; i++) {
+        auto frame = getFrame(i);
+        refresh_us_total += frame->refresh_us;
+        flush_us_total += frame->flush_us;
+        if (!frame->objects.empty() &&
+                ((top_object == nullptr) || (frame->objects.front().draw_us > top_object->draw_us))) {
+            top_object = &frame->objects.front();
+        }
+    }
+
+    char text[96] = {};
+    int refresh_us_avg = (frame_num > 0) ? static_cast<int>(refresh_us_total / frame_num) : 0;
+    int flush_us_avg = (frame_num > 0) ? static_cast<int>(flush_us_total / frame_num) : 0;
+    int length = snprintf(
+        text, sizeof(text), "%d fps, render %d.%dms, flush %d.%dms",
+        static_cast<int>(frame_num * 1000 / OVERLAY_PERIOD_MS), refresh_us_avg / 1000, (refresh_us_avg % 1000) / 100,
+        flush_us_avg / 1000, (flush_us_avg % 1000) / 100
+    );
+    if ((top_object != nullptr) && (length > 0) && (static_cast<size_t>(length) < sizeof(text))) {
+        snprintf(
+            text + length, sizeof(text) - length, "\n%s/%s %dus", top_object->owner,
+            getClassName(top_object->class_p), static_cast<int>(top_object->draw_us)
+        );
+    }
+    _overlay_callback(text);
+}
+
+void LvRenderProfiler::onDisplayEventCallback(lv_event_t *event)
+{
+    auto profiler = static_cast<LvRenderProfiler *>(lv_event_get_user_data(event));
+    ESP_UTILS_CHECK_NULL_EXIT(profiler, "Invalid profiler");
+
+    auto &frame = profiler->_frame;
+    switch (lv_event_get_code(event)) {
+    case LV_EVENT_INVALIDATE_AREA: {
+        // The layout is updated after the refresh starts, so its invalidations belong to the current frame
+        auto area = static_cast<const lv_area_t *>(lv_event_get_param(event));
+        if (area == nullptr) {
+            break;
+        }
+        if (profiler->_is_refreshing) {
+            frame.invalidated_px += lv_area_get_size(area);
+            frame.invalidated_count++;
+        } else {
+            profiler->_pending_invalidated_px += lv_area_get_size(area);
+            profiler->_pending_invalidated_count++;
+        }
+        break;
+    }
+    case LV_EVENT_REFR_START:
+        profiler->hookAutoOwners();
+        frame = {};
+        frame.start_us = esp_timer_get_time();
+        frame.invalidated_px = profiler->_pending_invalidated_px;
+        frame.invalidated_count = profiler->_pending_invalidated_count;
+        profiler->_pending_invalidated_px = 0;
+        profiler->_pending_invalidated_count = 0;
+        profiler->_frame_objects.clear();
+        profiler->_draw_stack.clear();
+        profiler->_is_refreshing = true;
+        break;
+    case LV_EVENT_FLUSH_START: {
+        if (!profiler->_is_refreshing) {
+            break;
+        }
+        auto area = static_cast<const lv_area_t *>(lv_event_get_param(event));
+        if (area != nullptr) {
+            frame.flushed_px += lv_area_get_size(area);
+        }
+        profiler->_flush_start_us = esp_timer_get_time();
+        break;
+    }
+    case LV_EVENT_FLUSH_WAIT_START:
+        if (profiler->_is_refreshing) {
+            profiler->_flush_start_us = esp_timer_get_time();
+        }
+        break;
+    case LV_EVENT_FLUSH_FINISH:
+    case LV_EVENT_FLUSH_WAIT_FINISH:
+        if (profiler->_is_refreshing && (profiler->_flush_start_us != 0)) {
+            frame.flush_us += static_cast<uint32_t>(esp_timer_get_time() - profiler->_flush_start_us);
+            profiler->_flush_start_us = 0;
+        }
+        break;
+    case LV_EVENT_REFR_READY:
+        if (!profiler->_is_refreshing) {
+            break;
+        }
+        profiler->_is_refreshing = false;
+        // The refresh timer also runs when nothing is invalid, skip these
+        if (frame.flushed_px > 0) {
+            profiler->finishFrame();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void LvRenderProfiler::onObjectEventCallback(lv_event_t *event)
+{
+    auto profiler = static_cast<LvRenderProfiler *>(lv_event_get_user_data(event));
+    ESP_UTILS_CHECK_NULL_EXIT(profiler, "Invalid profiler");
+
+    auto code = lv_event_get_code(event);
+    auto obj = static_cast<lv_obj_t *>(lv_event_get_current_target(event));
+    switch (code) {
+    case LV_EVENT_DRAW_MAIN_BEGIN:
+    case LV_EVENT_DRAW_POST_END:
+        // Skip the bubbled events and the snapshots, which are drawn outside of the refreshes
+        if (!profiler->_is_refreshing || (lv_event_get_target(event) != obj)) {
+            break;
+        }
+        if (code == LV_EVENT_DRAW_MAIN_BEGIN) {
+            profiler->beginDraw(obj);
+        } else {
+            profiler->endDraw(obj);
+        }
+        break;
+    case LV_EVENT_CHILD_CREATED: {
+        // The children of the new object are created by its constructor, before it's added to the parent
+        auto child = static_cast<lv_obj_t *>(lv_event_get_param(event));
+        if (profiler->isRunning() && (child != nullptr) && (lv_obj_get_parent(child) == obj)) {
+            profiler->hookTree(child);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void LvRenderProfiler::onOwnerDeleteCallback(lv_event_t *event)
+{
+    auto profiler = static_cast<LvRenderProfiler *>(lv_event_get_user_data(event));
+    ESP_UTILS_CHECK_NULL_EXIT(profiler, "Invalid profiler");
+
+    auto root = static_cast<lv_obj_t *>(lv_event_get_current_target(event));
+    auto &owners = profiler->_owners;
+    owners.erase(std::remove_if(owners.begin(), owners.end(), [root](const Owner & owner) {
+        return owner.root == root;
+    }), owners.end());
+}
+
+} // namespace esp_brookesia::gui
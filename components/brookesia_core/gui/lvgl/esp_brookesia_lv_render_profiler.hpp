@@ -0,0 +1,158 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "lvgl.h"
+
+namespace esp_brookesia::gui {
+
+/**
+ * @brief Profile the display refreshes: render and flush time, invalidated area and the objects costing the most
+ *        to draw, attributed to their owner widget (e.g. StatusBar, AppLauncher, RecentsScreen). The frames are kept
+ *        in a ring buffer, which can be dumped as a Chrome trace (`chrome://tracing` or Perfetto).
+ *
+ *        The draw time of an object is measured from its `LV_EVENT_DRAW_MAIN_BEGIN` to its `LV_EVENT_DRAW_POST_END`,
+ *        minus the time of its children. With a draw thread, the draw tasks may be rendered after the object is done,
+ *        so its cost is the creation of the tasks only. While running, an event callback is added to every object of
+ *        the profiled trees.
+ *
+ * @note  Except `getInstance()`, everything should be called with the LVGL lock held
+ */
+class LvRenderProfiler {
+public:
+    struct Config {
+        size_t frame_num;       /*!< Number of frames kept in the ring buffer */
+        size_t top_num;         /*!< Number of objects kept per frame, by draw time */
+    };
+
+    struct ObjectCost {
+        const lv_obj_t *obj;    /*!< Only used as an ID, the object may be deleted */
+        const lv_obj_class_t *class_p;
+        const char *owner;
+        int64_t start_us;       /*!< Start of its first draw in the frame */
+        uint32_t draw_us;       /*!< Without the children */
+        uint32_t draw_count;    /*!< Once per refreshed area covering it */
+    };
+
+    struct Frame {
+        int64_t start_us;
+        uint32_t refresh_us;    /*!< From the refresh start to the refresh ready */
+        uint32_t flush_us;      /*!< In the flush callback and waiting for the flushing to finish */
+        uint32_t invalidated_px;        /*!< Sum of the invalidated areas, before they are joined */
+        uint32_t invalidated_count;
+        uint32_t flushed_px;
+        std::vector<ObjectCost> objects;    /*!< Top objects by draw time */
+    };
+
+    using OverlayCallback = std::function<void(const char *text)>;
+
+    LvRenderProfiler(const LvRenderProfiler &) = delete;
+    LvRenderProfiler &operator=(const LvRenderProfiler &) = delete;
+
+    bool begin(const Config &config, lv_display_t *display);
+    bool del();
+
+    /**
+     * @brief Attribute the objects of a tree to an owner. The widgets register their main object when created, even
+     *        if the profiler isn't running. The objects of the active screen and the top layer without a more specific
+     *        owner are attributed to "Screen" and "TopLayer"
+     *
+     * @param[in] root Root of the tree, unregistered once deleted
+     * @param[in] name Name of the owner, should be a string literal
+     */
+    void addOwner(lv_obj_t *root, const char *name);
+    void removeOwner(lv_obj_t *root);
+
+    /**
+     * @brief Show a summary of the last frames every second, e.g. in the memory label of the recents screen. Note
+     *        that updating the overlay costs a frame every second
+     *
+     * @param[in] callback Callback receiving the text, `nullptr` to stop
+     */
+    bool setOverlayCallback(OverlayCallback callback);
+
+    bool isRunning() const
+    {
+        return (_display != nullptr);
+    }
+    size_t getFrameNum() const
+    {
+        return _frame_count;
+    }
+    /**
+     * @brief Get a frame, from the oldest (0) to the newest (`getFrameNum() - 1`)
+     */
+    const Frame *getFrame(size_t index) const;
+    void reset();
+    void dump() const;
+    /**
+     * @brief Write the frames as Chrome trace JSON
+     *
+     * @param[in] file File to write, e.g. `stdout` or a file on the SD card
+     */
+    bool dumpTrace(FILE *file) const;
+
+    static const char *getClassName(const lv_obj_class_t *class_p);
+    static LvRenderProfiler &getInstance();
+
+private:
+    struct Owner {
+        lv_obj_t *root;
+        const char *name;
+        bool is_auto;           /*!< Registered by the profiler itself */
+    };
+
+    struct DrawScope {
+        const lv_obj_t *obj;
+        int64_t start_us;
+        uint32_t children_us;
+    };
+
+    LvRenderProfiler() = default;
+    ~LvRenderProfiler() = default;
+
+    void hookTree(lv_obj_t *root);
+    void unhookTree(lv_obj_t *root);
+    bool hookObject(lv_obj_t *obj);
+    void hookAutoOwners();
+    const char *findOwner(const lv_obj_t *obj) const;
+    void beginDraw(const lv_obj_t *obj);
+    void endDraw(const lv_obj_t *obj);
+    void finishFrame();
+    void updateOverlay();
+
+    static void onDisplayEventCallback(lv_event_t *event);
+    static void onObjectEventCallback(lv_event_t *event);
+    static void onOwnerDeleteCallback(lv_event_t *event);
+
+    Config _config = {};
+    lv_display_t *_display = nullptr;
+    std::vector<Owner> _owners;
+    // Current frame
+    bool _is_refreshing = false;
+    int64_t _flush_start_us = 0;
+    Frame _frame = {};
+    uint32_t _pending_invalidated_px = 0;   /*!< Invalidated before the refresh starts */
+    uint32_t _pending_invalidated_count = 0;
+    std::vector<DrawScope> _draw_stack;
+    std::unordered_map<const lv_obj_t *, ObjectCost> _frame_objects;
+    // Ring buffer
+    std::vector<Frame> _frames;
+    size_t _frame_head = 0;
+    size_t _frame_count = 0;
+    // Overlay
+    OverlayCallback _overlay_callback = nullptr;
+    lv_timer_t *_overlay_timer = nullptr;
+    uint64_t _overlay_frame_total = 0;      /*!< Value of `_frame_total` at the last overlay update */
+    uint64_t _frame_total = 0;              /*!< Frames recorded since the start */
+};
+
+} // namespace esp_brookesia::gui
@@ -0,0 +1,242 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "esp_timer.h"
+#include "esp_brookesia_gui_internal.h"
+#if !ESP_BROOKESIA_LVGL_SCHEDULER_ENABLE_DEBUG_LOG
+#   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
+#endif
+#include "private/esp_brookesia_lv_utils.hpp"
+#include "esp_brookesia_lv_lock.hpp"
+#include "esp_brookesia_lv_scheduler.hpp"
+
+namespace esp_brookesia::gui {
+
+LvScheduler &LvScheduler::getInstance()
+{
+    static LvScheduler s_instance;
+    return s_instance;
+}
+
+bool LvScheduler::begin(const Config &config, lv_display_t *display)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isRunning(), false, "Already running");
+    ESP_UTILS_CHECK_NULL_RETURN(display, false, "Invalid display");
+
+    _config = config;
+    _display = display;
+    _need_exit = false;
+    _is_paused = false;
+    _is_invalidated = true;
+
+    {
+        LvLockGuard gui_guard;
+        // The tick is read from the system timer on demand, so no periodic tick interrupt is needed
+        lv_tick_set_cb(getTick);
+        lv_display_add_event_cb(_display, onInvalidateAreaEventCallback, LV_EVENT_INVALIDATE_AREA, this);
+    }
+    resetStats();
+
+    {
+        esp_utils::thread_config_guard thread_config(esp_utils::ThreadConfig{
+            .name = _config.task_name,
+            .core_id = _config.task_affinity,
+            .priority = static_cast<size_t>(_config.task_priority),
+            .stack_size = static_cast<size_t>(_config.task_stack),
+            .stack_in_ext = _config.task_stack_in_ext,
+        });
+        _thread = boost::thread([this]() {
+            _task_handle = xTaskGetCurrentTaskHandle();
+            run();
+            _task_handle = nullptr;
+        });
+    }
+
+    return true;
+}
+
+bool LvScheduler::del()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    if (_thread.joinable()) {
+        _need_exit = true;
+        notify();
+        _thread.join();
+    }
+    if (_display != nullptr) {
+        LvLockGuard gui_guard;
+        lv_display_remove_event_cb_with_user_data(_display, onInvalidateAreaEventCallback, this);
+        _display = nullptr;
+    }
+
+    return true;
+}
+
+bool LvScheduler::pause()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    _is_paused = true;
+    notify();
+
+    return true;
+}
+
+bool LvScheduler::resume()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    _is_paused = false;
+    notify();
+
+    return true;
+}
+
+void LvScheduler::notify()
+{
+    TaskHandle_t task_handle = _task_handle;
+    if ((task_handle == nullptr) || (task_handle == xTaskGetCurrentTaskHandle())) {
+        return;
+    }
+    xTaskNotifyGive(task_handle);
+}
+
+void LvScheduler::requestRefresh(lv_display_t *display)
+{
+    auto refr_timer = lv_display_get_refr_timer(display);
+    ESP_UTILS_CHECK_NULL_EXIT(refr_timer, "Invalid refresh timer");
+
+    // Otherwise the refresh timer is parked again before it runs
+    if (display == _display) {
+        _is_invalidated = true;
+    }
+    lv_timer_resume(refr_timer);
+    lv_timer_ready(refr_timer);
+    notify();
+}
+
+void IRAM_ATTR LvScheduler::notifyFromISR()
+{
+    TaskHandle_t task_handle = _task_handle;
+    if (task_handle == nullptr) {
+        return;
+    }
+
+    BaseType_t need_yield = pdFALSE;
+    vTaskNotifyGiveFromISR(task_handle, &need_yield);
+    if (need_yield == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+void LvScheduler::resetStats()
+{
+    std::lock_guard<std::mutex> lock(_stats_mutex);
+    _stats = {};
+    _stats.start_us = esp_timer_get_time();
+}
+
+uint32_t LvScheduler::getWakeupsPerSecond() const
+{
+    auto stats = getStats();
+    auto elapsed_us = esp_timer_get_time() - stats.start_us;
+    if (elapsed_us <= 0) {
+        return 0;
+    }
+
+    uint64_t wakeups = 0;
+    for (auto count : stats.wakeups) {
+        wakeups += count;
+    }
+
+    return static_cast<uint32_t>(wakeups * 1000000 / elapsed_us);
+}
+
+void LvScheduler::dumpStats() const
+{
+    auto stats = getStats();
+    auto elapsed_ms = static_cast<int>((esp_timer_get_time() - stats.start_us) / 1000);
+
+    ESP_UTILS_LOGI(
+        "{LVGL scheduler}:\n"
+        "\t-Elapsed(%dms)\n"
+        "\t-Wakeups: timer(%d), notify(%d), %d/s\n"
+        "\t-Handler(%dms)",
+        elapsed_ms, static_cast<int>(stats.wakeups[static_cast<size_t>(WakeupReason::Timer)]),
+        static_cast<int>(stats.wakeups[static_cast<size_t>(WakeupReason::Notify)]),
+        static_cast<int>(getWakeupsPerSecond()), static_cast<int>(stats.handler_us / 1000)
+    );
+}
+
+void LvScheduler::run()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    while (!_need_exit) {
+        uint32_t delay_ms = LV_NO_TIMER_READY;
+        if (!_is_paused && LvLock::getInstance().lock()) {
+            int64_t start_us = esp_timer_get_time();
+            delay_ms = lv_timer_handler();
+            // The refresh timer may get parked after the handler computed its delay, so compute it again
+            if (updateRefreshTimer()) {
+                delay_ms = lv_timer_get_time_until_next();
+            }
+            auto handler_us = esp_timer_get_time() - start_us;
+            LvLock::getInstance().unlock();
+            std::lock_guard<std::mutex> lock(_stats_mutex);
+            _stats.handler_us += handler_us;
+        }
+
+        TickType_t wait_ticks = portMAX_DELAY;
+        if (delay_ms != LV_NO_TIMER_READY) {
+            wait_ticks = std::max<TickType_t>(pdMS_TO_TICKS(delay_ms), 1);
+        }
+        if ((_config.max_sleep_ms > 0) && !_is_paused) {
+            wait_ticks = std::min<TickType_t>(wait_ticks, pdMS_TO_TICKS(_config.max_sleep_ms));
+        }
+
+        auto reason = (ulTaskNotifyTake(pdTRUE, wait_ticks) > 0) ? WakeupReason::Notify : WakeupReason::Timer;
+        std::lock_guard<std::mutex> lock(_stats_mutex);
+        _stats.wakeups[static_cast<size_t>(reason)]++;
+    }
+}
+
+bool LvScheduler::updateRefreshTimer()
+{
+    // LVGL keeps the refresh timer running at its period even when nothing is invalidated, park it instead
+    auto refr_timer = lv_display_get_refr_timer(_display);
+    if ((refr_timer == nullptr) || lv_timer_get_paused(refr_timer)) {
+        return false;
+    }
+    if (_is_invalidated || (lv_anim_count_running() > 0)) {
+        _is_invalidated = false;
+        return false;
+    }
+    lv_timer_pause(refr_timer);
+
+    return true;
+}
+
+uint32_t LvScheduler::getTick()
+{
+    return static_cast<uint32_t>(esp_timer_get_time() / 1000);
+}
+
+void LvScheduler::onInvalidateAreaEventCallback(lv_event_t *event)
+{
+    auto scheduler = static_cast<LvScheduler *>(lv_event_get_user_data(event));
+    ESP_UTILS_CHECK_NULL_EXIT(scheduler, "Invalid scheduler");
+
+    scheduler->_is_invalidated = true;
+    auto refr_timer = lv_display_get_refr_timer(scheduler->_display);
+    if (refr_timer != nullptr) {
+        lv_timer_resume(refr_timer);
+    }
+}
+
+} // namespace esp_brookesia::gui
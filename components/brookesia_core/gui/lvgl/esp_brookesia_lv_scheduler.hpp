@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "boost/thread.hpp"
+#include "lvgl.h"
+
+namespace esp_brookesia::gui {
+
+/**
+ * @brief Tickless LVGL task: it blocks until the next LVGL timer is due or until it is notified (input, button,
+ *        sensor, or an LVGL operation from another task), instead of waking up periodically
+ *
+ * @note  The LVGL lock registered with `LvLock` is used around `lv_timer_handler()`
+ */
+class LvScheduler {
+public:
+    enum class WakeupReason : uint8_t {
+        Timer = 0,
+        Notify,
+        Max,
+    };
+
+    struct Config {
+        const char *task_name;
+        int task_priority;
+        int task_stack;
+        int task_affinity;
+        bool task_stack_in_ext;
+        uint32_t max_sleep_ms;      /*!< 0 means sleeping until the next timer or notification, however long */
+    };
+
+    struct Stats {
+        std::array<uint32_t, static_cast<size_t>(WakeupReason::Max)> wakeups;
+        uint64_t handler_us;        /*!< Time spent in `lv_timer_handler()` */
+        int64_t start_us;
+    };
+
+    LvScheduler(const LvScheduler &) = delete;
+    LvScheduler &operator=(const LvScheduler &) = delete;
+
+    bool begin(const Config &config, lv_display_t *display);
+    bool del();
+
+    bool pause();
+    bool resume();
+
+    /**
+     * @brief Wake up the scheduler to run `lv_timer_handler()` immediately, it's a no-op from the scheduler itself
+     */
+    void notify();
+    void notifyFromISR();
+    /**
+     * @brief Refresh the display at the next run even if nothing is invalidated, for the work done on
+     *        `LV_EVENT_REFR_START`. Works whether the scheduler is running or not, with the LVGL lock held
+     */
+    void requestRefresh(lv_display_t *display);
+
+    bool isRunning() const
+    {
+        return _task_handle != nullptr;
+    }
+    bool isPaused() const
+    {
+        return _is_paused;
+    }
+    Stats getStats() const
+    {
+        std::lock_guard<std::mutex> lock(_stats_mutex);
+        return _stats;
+    }
+    void resetStats();
+    uint32_t getWakeupsPerSecond() const;
+    void dumpStats() const;
+
+    static LvScheduler &getInstance();
+
+private:
+    LvScheduler() = default;
+    ~LvScheduler() = default;
+
+    void run();
+    bool updateRefreshTimer();
+
+    static uint32_t getTick();
+    static void onInvalidateAreaEventCallback(lv_event_t *event);
+
+    Config _config = {};
+    lv_display_t *_display = nullptr;
+    boost::thread _thread;
+    std::atomic<TaskHandle_t> _task_handle = nullptr;
+    std::atomic<bool> _need_exit = false;
+    std::atomic<bool> _is_paused = false;
+    bool _is_invalidated = true;
+    mutable std::mutex _stats_mutex;    /*!< The stats are updated by the task, and read or reset by others */
+    Stats _stats = {};
+};
+
+} // namespace esp_brookesia::gui
@@ -0,0 +1,115 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include "esp_timer.h"
+#include "esp_brookesia_gui_internal.h"
+#if !ESP_BROOKESIA_LVGL_TILED_SNAPSHOT_ENABLE_DEBUG_LOG
+#   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
+#endif
+#include "private/esp_brookesia_lv_utils.hpp"
+#include "esp_brookesia_lv_helper.hpp"
+#include "esp_brookesia_lv_tiled_snapshot.hpp"
+
+namespace esp_brookesia::gui {
+
+LvTiledSnapshot::~LvTiledSnapshot()
+{
+    del();
+}
+
+bool LvTiledSnapshot::begin(lv_obj_t *obj, lv_color_format_t color_format)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isRunning(), false, "Already running");
+    ESP_UTILS_CHECK_FALSE_RETURN((obj != nullptr) && lv_obj_is_valid(obj), false, "Invalid object");
+
+    // Same area as `lv_snapshot_take()`
+    lv_area_t area = {};
+    int32_t ext_size = lv_obj_get_ext_draw_size(obj);
+    lv_obj_get_coords(obj, &area);
+    lv_area_increase(&area, ext_size, ext_size);
+
+    _buffer = lv_draw_buf_create(lv_area_get_width(&area), lv_area_get_height(&area), color_format, LV_STRIDE_AUTO);
+    ESP_UTILS_CHECK_NULL_RETURN(_buffer, false, "Create buffer failed");
+
+    _obj = obj;
+    _color_format = color_format;
+    _area = area;
+    _next_y = area.y1;
+    _render_us = 0;
+
+    return true;
+}
+
+void LvTiledSnapshot::del()
+{
+    if (_buffer != nullptr) {
+        lv_draw_buf_destroy(_buffer);
+        _buffer = nullptr;
+    }
+    _obj = nullptr;
+}
+
+bool LvTiledSnapshot::renderNext(int32_t rows)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(isRunning(), false, "Not running");
+    ESP_UTILS_CHECK_FALSE_RETURN(lv_obj_is_valid(_obj), false, "Object has been deleted");
+    if (isDone()) {
+        return true;
+    }
+
+    int64_t start_us = esp_timer_get_time();
+    lv_area_t band = {
+        _area.x1, _next_y, _area.x2, (rows <= 0) ? _area.y2 : std::min(_area.y2, _next_y + rows - 1)
+    };
+    lv_area_t buffer_band = band;
+    lv_area_move(&buffer_band, -_area.x1, -_area.y1);
+    lv_draw_buf_clear(_buffer, &buffer_band);
+
+    // As `lv_snapshot_take_to_draw_buf()`, with the clip area limited to the band
+    lv_layer_t layer = {};
+    layer.draw_buf = _buffer;
+    layer.buf_area = _area;
+    layer.color_format = _color_format;
+    layer._clip_area = band;
+    layer.phy_clip_area = band;
+
+    lv_display_t *display_old = lv_refr_get_disp_refreshing();
+    lv_display_t *display = lv_obj_get_display(_obj);
+    lv_layer_t *layer_old = display->layer_head;
+    display->layer_head = &layer;
+    lv_refr_set_disp_refreshing(display);
+
+    lv_obj_redraw(&layer, _obj);
+    while (layer.draw_task_head != nullptr) {
+        lv_draw_dispatch_wait_for_request();
+        lv_draw_dispatch();
+    }
+
+    display->layer_head = layer_old;
+    lv_refr_set_disp_refreshing(display_old);
+
+    _next_y = band.y2 + 1;
+    _render_us += static_cast<uint32_t>(esp_timer_get_time() - start_us);
+    ESP_UTILS_LOGD("Rendered rows %d-%d of %d", static_cast<int>(band.y1 - _area.y1),
+                   static_cast<int>(band.y2 - _area.y1), static_cast<int>(lv_area_get_height(&_area)));
+
+    return true;
+}
+
+lv_draw_buf_t *LvTiledSnapshot::release()
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(isDone(), nullptr, "Not done");
+
+    auto buffer = _buffer;
+    _buffer = nullptr;
+    _obj = nullptr;
+
+    return buffer;
+}
+
+} // namespace esp_brookesia::gui
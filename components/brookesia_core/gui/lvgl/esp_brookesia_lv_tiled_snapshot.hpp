@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "lvgl.h"
+
+namespace esp_brookesia::gui {
+
+/**
+ * @brief Snapshot of an object rendered band by band, like `lv_snapshot_take()` but split into steps which can be
+ *        spread across idle frames. The object should not change until the snapshot is done, otherwise the bands
+ *        show different states of it
+ *
+ * @note  Everything should be called with the LVGL lock held
+ */
+class LvTiledSnapshot {
+public:
+    LvTiledSnapshot() = default;
+    ~LvTiledSnapshot();
+
+    LvTiledSnapshot(const LvTiledSnapshot &) = delete;
+    LvTiledSnapshot &operator=(const LvTiledSnapshot &) = delete;
+
+    /**
+     * @brief Create the buffer of the snapshot, nothing is rendered yet
+     */
+    bool begin(lv_obj_t *obj, lv_color_format_t color_format);
+    /**
+     * @brief Release the buffer if it has not been taken by `release()`
+     */
+    void del();
+
+    /**
+     * @brief Render the next band of the object
+     *
+     * @param[in] rows Rows of the band, <= 0 to render everything left
+     */
+    bool renderNext(int32_t rows);
+    /**
+     * @brief Take the buffer of the finished snapshot, to be destroyed by the caller with `lv_draw_buf_destroy()`
+     *
+     * @return The buffer, or nullptr if not finished
+     */
+    lv_draw_buf_t *release();
+
+    bool isRunning() const
+    {
+        return (_buffer != nullptr);
+    }
+    bool isDone() const
+    {
+        return isRunning() && (_next_y > _area.y2);
+    }
+    lv_obj_t *getObject() const
+    {
+        return _obj;
+    }
+    /**
+     * @brief Time spent rendering the bands so far
+     */
+    uint32_t getRenderTimeUs() const
+    {
+        return _render_us;
+    }
+
+private:
+    lv_obj_t *_obj = nullptr;
+    lv_draw_buf_t *_buffer = nullptr;
+    lv_color_format_t _color_format = LV_COLOR_FORMAT_UNKNOWN;
+    lv_area_t _area = {};
+    int32_t _next_y = 0;
+    uint32_t _render_us = 0;
+};
+
+} // namespace esp_brookesia::gui
@@ -0,0 +1,266 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include "esp_timer.h"
+#include "esp_sleep.h"
+#include "esp_brookesia_gui_internal.h"
+#if !ESP_BROOKESIA_LVGL_TOUCH_INPUT_ENABLE_DEBUG_LOG
+#   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
+#endif
+#include "private/esp_brookesia_lv_utils.hpp"
+#include "esp_brookesia_lv_latency_monitor.hpp"
+#include "esp_brookesia_lv_lock.hpp"
+#include "esp_brookesia_lv_touch_input.hpp"
+
+namespace esp_brookesia::gui {
+
+LvTouchInput::~LvTouchInput()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_EXIT(del(), "Delete failed");
+}
+
+bool LvTouchInput::begin(const Config &config, lv_display_t *display)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isBegun(), false, "Already begun");
+    ESP_UTILS_CHECK_NULL_RETURN(display, false, "Invalid display");
+    ESP_UTILS_CHECK_FALSE_RETURN(config.read_cb != nullptr, false, "Invalid read callback");
+    ESP_UTILS_CHECK_FALSE_RETURN(GPIO_IS_VALID_GPIO(config.irq_gpio), false, "Invalid IRQ GPIO");
+
+    esp_utils::function_guard del_guard([this]() {
+        ESP_UTILS_CHECK_FALSE_EXIT(del(), "Delete failed");
+    });
+
+    _config = config;
+    _need_exit = false;
+    _last_sample = {};
+
+    {
+        LvLockGuard gui_guard;
+        _indev = lv_indev_create();
+        ESP_UTILS_CHECK_NULL_RETURN(_indev, false, "Create input device failed");
+        lv_indev_set_type(_indev, LV_INDEV_TYPE_POINTER);
+        lv_indev_set_display(_indev, display);
+        lv_indev_set_driver_data(_indev, this);
+        lv_indev_set_read_cb(_indev, onIndevReadCallback);
+        // Read only when the input task gets a new sample, this also deletes the read timer
+        lv_indev_set_mode(_indev, LV_INDEV_MODE_EVENT);
+    }
+
+    {
+        esp_utils::thread_config_guard thread_config(esp_utils::ThreadConfig{
+            .name = _config.task_name,
+            .core_id = _config.task_affinity,
+            .priority = static_cast<size_t>(_config.task_priority),
+            .stack_size = static_cast<size_t>(_config.task_stack),
+            .stack_in_ext = _config.task_stack_in_ext,
+        });
+        _thread = boost::thread([this]() {
+            _task_handle = xTaskGetCurrentTaskHandle();
+            run();
+            _task_handle = nullptr;
+        });
+    }
+
+    ESP_UTILS_CHECK_FALSE_RETURN(initIrq(), false, "Init IRQ failed");
+
+    del_guard.release();
+
+    return true;
+}
+
+bool LvTouchInput::del()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    deinitIrq();
+
+    if (_thread.joinable()) {
+        _need_exit = true;
+        TaskHandle_t task_handle = _task_handle;
+        if (task_handle != nullptr) {
+            xTaskNotifyGive(task_handle);
+        }
+        _thread.join();
+    }
+
+    if (_indev != nullptr) {
+        LvLockGuard gui_guard;
+        lv_indev_delete(_indev);
+        _indev = nullptr;
+    }
+
+    return true;
+}
+
+void IRAM_ATTR LvTouchInput::notifyFromISR()
+{
+    TaskHandle_t task_handle = _task_handle;
+    if (task_handle == nullptr) {
+        return;
+    }
+
+    BaseType_t need_yield = pdFALSE;
+    vTaskNotifyGiveFromISR(task_handle, &need_yield);
+    if (need_yield == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+LvTouchInput::Sample LvTouchInput::getLastSample()
+{
+    std::lock_guard<std::mutex> lock(_sample_mutex);
+
+    return _last_sample;
+}
+
+bool LvTouchInput::getLastSample(lv_indev_t *indev, Sample &sample)
+{
+    if ((indev == nullptr) || (lv_indev_get_read_cb(indev) != onIndevReadCallback)) {
+        return false;
+    }
+
+    auto touch_input = static_cast<LvTouchInput *>(lv_indev_get_driver_data(indev));
+    ESP_UTILS_CHECK_NULL_RETURN(touch_input, false, "Invalid touch input");
+
+    sample = touch_input->getLastSample();
+
+    return true;
+}
+
+void LvTouchInput::run()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    bool is_pressed = false;
+    bool is_polling = false;
+    while (!_need_exit) {
+        TickType_t wait_ticks = portMAX_DELAY;
+        if (is_polling) {
+            wait_ticks = std::max<TickType_t>(pdMS_TO_TICKS(_config.sample_period_ms), 1);
+        }
+        ulTaskNotifyTake(pdTRUE, wait_ticks);
+        if (_need_exit) {
+            break;
+        }
+
+        // The samples polled while pressed have no IRQ, they start with the read
+        int64_t irq_us = is_polling ? esp_timer_get_time() : _irq_timestamp_us.load();
+        Sample sample = {};
+        sample.pressed = _config.read_cb(sample.x, sample.y);
+        sample.timestamp_us = esp_timer_get_time();
+
+        // Only report the samples while pressed and the release, a spurious IRQ is ignored
+        if (sample.pressed || is_pressed) {
+            {
+                std::lock_guard<std::mutex> lock(_sample_mutex);
+                if (!sample.pressed) {
+                    // The driver doesn't report the point on release, keep the last one like LVGL does
+                    sample.x = _last_sample.x;
+                    sample.y = _last_sample.y;
+                }
+                _last_sample = sample;
+            }
+            {
+                LvLockGuard gui_guard;
+                LvLatencyMonitor::getInstance().beginProbe(irq_us, sample.timestamp_us);
+                lv_indev_read(_indev);
+            }
+            _sample_signal(sample);
+            is_pressed = sample.pressed;
+        }
+
+        // Keep reading until the finger is lifted, then wait for the next IRQ
+        is_polling = is_pressed || isIrqActive();
+        if (!is_polling) {
+            gpio_intr_enable(_config.irq_gpio);
+        }
+    }
+}
+
+bool LvTouchInput::initIrq()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    // The ISR service may have been installed by the BSP already
+    auto ret = gpio_install_isr_service(0);
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (ret == ESP_OK) || (ret == ESP_ERR_INVALID_STATE), false, "Install GPIO ISR service failed"
+    );
+
+    auto gpio = _config.irq_gpio;
+    // Level triggered and disabled in the ISR until the finger is lifted, so a pressed panel can't flood the CPU
+    gpio_config_t io_conf = {
+        .pin_bit_mask = BIT64(gpio),
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = _config.irq_active_low ? GPIO_PULLUP_ENABLE : GPIO_PULLUP_DISABLE,
+        .pull_down_en = _config.irq_active_low ? GPIO_PULLDOWN_DISABLE : GPIO_PULLDOWN_ENABLE,
+        .intr_type = _config.irq_active_low ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL,
+    };
+    ESP_UTILS_CHECK_ERROR_RETURN(gpio_config(&io_conf), false, "Config GPIO(%d) failed", static_cast<int>(gpio));
+    if (_config.irq_sleep_wakeup) {
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            gpio_wakeup_enable(gpio, _config.irq_active_low ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL), false,
+            "Enable GPIO(%d) wakeup failed", static_cast<int>(gpio)
+        );
+        ESP_UTILS_CHECK_ERROR_RETURN(esp_sleep_enable_gpio_wakeup(), false, "Enable GPIO wakeup failed");
+    }
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        gpio_isr_handler_add(gpio, onIrqIsr, this), false, "Add GPIO(%d) ISR handler failed", static_cast<int>(gpio)
+    );
+    _is_irq_inited = true;
+
+    return true;
+}
+
+void LvTouchInput::deinitIrq()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    if (!_is_irq_inited) {
+        return;
+    }
+
+    gpio_isr_handler_remove(_config.irq_gpio);
+    if (_config.irq_sleep_wakeup) {
+        gpio_wakeup_disable(_config.irq_gpio);
+    }
+    _is_irq_inited = false;
+}
+
+bool LvTouchInput::isIrqActive() const
+{
+    return (gpio_get_level(_config.irq_gpio) == (_config.irq_active_low ? 0 : 1));
+}
+
+void IRAM_ATTR LvTouchInput::onIrqIsr(void *arg)
+{
+    auto touch_input = static_cast<LvTouchInput *>(arg);
+    if (touch_input->_task_handle == nullptr) {
+        return;
+    }
+
+    // Re-enabled by the input task once the finger is lifted
+    gpio_intr_disable(touch_input->_config.irq_gpio);
+    touch_input->_irq_timestamp_us.store(esp_timer_get_time());
+    touch_input->notifyFromISR();
+}
+
+void LvTouchInput::onIndevReadCallback(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    auto touch_input = static_cast<LvTouchInput *>(lv_indev_get_driver_data(indev));
+    ESP_UTILS_CHECK_NULL_EXIT(touch_input, "Invalid touch input");
+
+    auto sample = touch_input->getLastSample();
+    data->point.x = sample.x;
+    data->point.y = sample.y;
+    data->state = sample.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+} // namespace esp_brookesia::gui
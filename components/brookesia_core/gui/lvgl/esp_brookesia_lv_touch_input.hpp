@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/gpio.h"
+#include "boost/thread.hpp"
+#include "boost/signals2.hpp"
+#include "lvgl.h"
+
+namespace esp_brookesia::gui {
+
+/**
+ * @brief Interrupt driven touch input: the touch IRQ wakes up an input task which reads the touch driver, timestamps
+ *        the sample and feeds it to an LVGL pointer device in event mode. Nothing is polled while untouched, the driver
+ *        is only read every `sample_period_ms` while a finger is down
+ */
+class LvTouchInput {
+public:
+    struct Sample {
+        int16_t x;
+        int16_t y;
+        bool pressed;
+        int64_t timestamp_us;   /*!< Time at which the point has been read from the driver */
+    };
+
+    /**
+     * @brief Read the first touch point from the driver, return true if pressed. Called from the input task
+     */
+    using ReadCallback = std::function<bool(int16_t &x, int16_t &y)>;
+    using SampleSignal = boost::signals2::signal<void(const Sample &sample)>;
+
+    struct Config {
+        const char *task_name;
+        int task_priority;
+        int task_stack;
+        int task_affinity;
+        bool task_stack_in_ext;
+        gpio_num_t irq_gpio;
+        bool irq_active_low;
+        bool irq_sleep_wakeup;      /*!< Also use the IRQ as a light sleep wakeup source */
+        uint32_t sample_period_ms;  /*!< Read period while pressed */
+        ReadCallback read_cb;
+    };
+
+    LvTouchInput() = default;
+    ~LvTouchInput();
+
+    LvTouchInput(const LvTouchInput &other) = delete;
+    LvTouchInput &operator=(const LvTouchInput &other) = delete;
+
+    bool begin(const Config &config, lv_display_t *display);
+    bool del();
+
+    void notifyFromISR();
+
+    boost::signals2::connection connectSampleSignal(SampleSignal::slot_type slot)
+    {
+        return _sample_signal.connect(slot);
+    }
+
+    bool isBegun() const
+    {
+        return (_indev != nullptr);
+    }
+    lv_indev_t *getIndev() const
+    {
+        return _indev;
+    }
+    Sample getLastSample();
+
+    /**
+     * @brief Get the last sample of a pointer device created by `LvTouchInput`
+     *
+     * @return false if the device isn't driven by `LvTouchInput`
+     */
+    static bool getLastSample(lv_indev_t *indev, Sample &sample);
+
+private:
+    void run();
+    bool initIrq();
+    void deinitIrq();
+    bool isIrqActive() const;
+
+    static void onIrqIsr(void *arg);
+    static void onIndevReadCallback(lv_indev_t *indev, lv_indev_data_t *data);
+
+    Config _config = {};
+    lv_indev_t *_indev = nullptr;
+    boost::thread _thread;
+    std::atomic<TaskHandle_t> _task_handle = nullptr;
+    std::atomic<bool> _need_exit = false;
+    bool _is_irq_inited = false;
+    // Written by the ISR before notifying the input task, a plain 64-bit access could be torn on the 32-bit target
+    std::atomic<int64_t> _irq_timestamp_us = 0;
+
+    std::mutex _sample_mutex;
+    Sample _last_sample = {};
+    SampleSignal _sample_signal;
+};
+
+using LvTouchInputUniquePtr = std::unique_ptr<LvTouchInput>;
+
+} // namespace esp_brookesia::gui
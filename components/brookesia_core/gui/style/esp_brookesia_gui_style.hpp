@@ -157,6 +157,37 @@ struct StyleSize {
         };
     }
 
+    /**
+    * @brief Resolve the percentages of the parent size to pixels at compile time, as `calibrate()` does. Nothing is
+    *        checked here, the sizes in pixels are still checked by `calibrate()` at runtime.
+    *
+    * @param parent The parent size in pixels
+    *
+    * @return The size in pixels, without the percent flags
+    */
+    constexpr StyleSize resolve(const StyleSize &parent) const
+    {
+        StyleSize size = *this;
+
+        if (flags.enable_width_percent && !flags.enable_width_auto) {
+            size.width = (parent.width != LENGTH_AUTO) ? (parent.width * width_percent) / 100 : LENGTH_AUTO;
+            size.flags.enable_width_percent = false;
+        }
+        if (flags.enable_height_percent && !flags.enable_height_auto) {
+            size.height = (parent.height != LENGTH_AUTO) ? (parent.height * height_percent) / 100 : LENGTH_AUTO;
+            size.flags.enable_height_percent = false;
+        }
+        if (flags.enable_square || flags.enable_circle) {
+            size.width = (size.width < size.height) ? size.width : size.height;
+            size.height = size.width;
+        }
+        if (flags.enable_circle) {
+            size.radius = RADIUS_CIRCLE;
+        }
+
+        return size;
+    }
+
     bool calibrate(const StyleSize &parent);
     bool calibrate(const StyleSize &parent, bool check_width, bool check_height);
     bool calibrate(const StyleSize &parent, bool allow_zero);
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <memory>
+#include <new>
 #include <string>
 #include <list>
 #include <map>
@@ -161,7 +162,8 @@ bool StylesheetManager<T>::activateStylesheet(const StyleSize &screen_size,
     }
     // ESP_UTILS_LOGD("Activate stylesheet(%dx%d)", calibrate_size.width, calibrate_size.height);
 
-    std::shared_ptr<T> calibration_stylesheet = std::make_shared<T>(stylesheet);
+    // Not stored, so only a temporary copy is calibrated, the active stylesheet is kept if it fails
+    std::unique_ptr<T> calibration_stylesheet(new (std::nothrow) T(stylesheet));
     // ESP_UTILS_CHECK_NULL_RETURN(calibration_stylesheet, false, "Create stylesheet failed");
     if (calibration_stylesheet == nullptr) {
         return false;
@@ -0,0 +1,704 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_brookesia_gui_internal.h"
+#if !ESP_BROOKESIA_WATCHFACE_ENABLE_DEBUG_LOG
+#   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
+#endif
+#include "private/esp_brookesia_watchface_utils.hpp"
+#include "lvgl/esp_brookesia_lv_helper.hpp"
+#include "esp_brookesia_watchface.hpp"
+
+#define WATCHFACE_SIZE_MAX          (1024)
+#define WATCHFACE_TEXT_SIZE_MAX     (16)
+
+namespace esp_brookesia::gui {
+
+static const char *const WEEKDAY_NAMES[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+static const char *const MONTH_NAMES[] = {
+    "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+};
+
+static uint8_t *allocBuffer(size_t size)
+{
+    // Prefer PSRAM, the internal RAM is kept for the draw buffers
+    auto buf = heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (buf == nullptr) {
+        buf = heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, size, MALLOC_CAP_DEFAULT);
+    }
+
+    return static_cast<uint8_t *>(buf);
+}
+
+static bool intersectArea(const lv_area_t &a, const lv_area_t &b, lv_area_t &result)
+{
+    result.x1 = std::max(a.x1, b.x1);
+    result.y1 = std::max(a.y1, b.y1);
+    result.x2 = std::min(a.x2, b.x2);
+    result.y2 = std::min(a.y2, b.y2);
+
+    return (result.x1 <= result.x2) && (result.y1 <= result.y2);
+}
+
+static void joinArea(lv_area_t &a, const lv_area_t &b)
+{
+    a.x1 = std::min(a.x1, b.x1);
+    a.y1 = std::min(a.y1, b.y1);
+    a.x2 = std::max(a.x2, b.x2);
+    a.y2 = std::max(a.y2, b.y2);
+}
+
+Watchface::~Watchface()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    if (isBegun()) {
+        ESP_UTILS_CHECK_FALSE_EXIT(del(), "Failed to delete watchface");
+    }
+    unload();
+}
+
+bool Watchface::loadFromMemory(const void *data, size_t size)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_LOGD("Param: data(0x%p), size(%d)", data, static_cast<int>(size));
+    ESP_UTILS_CHECK_NULL_RETURN(data, false, "Invalid data");
+
+    unload();
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        compile(static_cast<const uint8_t *>(data), size), false, "Failed to compile face"
+    );
+    _name = "memory";
+
+    return true;
+}
+
+bool Watchface::loadFromFile(const char *path)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_NULL_RETURN(path, false, "Invalid path");
+    ESP_UTILS_LOGD("Param: path(%s)", path);
+
+    unload();
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    ESP_UTILS_CHECK_FALSE_RETURN(file.is_open(), false, "Failed to open file: %s", path);
+
+    auto size = static_cast<size_t>(file.tellg());
+    ESP_UTILS_CHECK_FALSE_RETURN(size > 0, false, "Empty file: %s", path);
+
+    _file_data = static_cast<uint8_t *>(heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    ESP_UTILS_CHECK_NULL_RETURN(_file_data, false, "Failed to allocate file data(%d)", static_cast<int>(size));
+
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char *>(_file_data), size)) {
+        ESP_UTILS_LOGE("Failed to read file: %s", path);
+        unload();
+        return false;
+    }
+    if (!compile(_file_data, size)) {
+        ESP_UTILS_LOGE("Failed to compile face: %s", path);
+        unload();
+        return false;
+    }
+    _name = path;
+
+    return true;
+}
+
+void Watchface::unload()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    _ops.clear();
+    _bg_op_num = 0;
+    _data = nullptr;
+    _data_size = 0;
+    _name.clear();
+    if (_file_data != nullptr) {
+        heap_caps_free(_file_data);
+        _file_data = nullptr;
+    }
+}
+
+bool Watchface::begin(const LvObject *parent)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_NULL_RETURN(parent, false, "Invalid parent");
+    ESP_UTILS_CHECK_FALSE_RETURN(!isBegun(), false, "Already begun");
+
+    ESP_UTILS_CHECK_EXCEPTION_RETURN(
+        _canvas = std::make_unique<LvCanvas>(parent), false, "Failed to create canvas"
+    );
+    ESP_UTILS_CHECK_FALSE_GOTO(_canvas->isValid(), err, "Invalid canvas");
+    lv_obj_remove_flag(_canvas->getNativeHandle(), LV_OBJ_FLAG_CLICKABLE);
+    _is_bg_dirty = true;
+
+    return true;
+
+err:
+    ESP_UTILS_CHECK_FALSE_RETURN(del(), false, "Failed to delete");
+
+    return false;
+}
+
+bool Watchface::del()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    _canvas.reset();
+    if (_canvas_buf != nullptr) {
+        heap_caps_free(_canvas_buf);
+        _canvas_buf = nullptr;
+    }
+    if (_bg_buf != nullptr) {
+        heap_caps_free(_bg_buf);
+        _bg_buf = nullptr;
+    }
+    _buf_size = 0;
+    _buf_stride = 0;
+    _dirty_area_num = 0;
+    _is_bg_dirty = false;
+
+    return true;
+}
+
+bool Watchface::update(const struct tm &time)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(isBegun(), false, "Not begun");
+    ESP_UTILS_CHECK_FALSE_RETURN(isLoaded(), false, "Not loaded");
+
+    auto start_us = esp_timer_get_time();
+
+    _dirty_area_num = 0;
+    if (_is_bg_dirty) {
+        ESP_UTILS_CHECK_FALSE_RETURN(updateBuffers(), false, "Failed to update buffers");
+        renderBackground();
+        for (auto &op : _ops) {
+            op.is_drawn = false;
+        }
+        addDirtyArea({0, 0, _width - 1, _height - 1});
+        _is_bg_dirty = false;
+    }
+
+    for (size_t i = _bg_op_num; i < _ops.size(); i++) {
+        auto &op = _ops[i];
+        // The static layers above the dynamic ones are only redrawn with the background or their value
+        if (op.cadence == Cadence::Static) {
+            if (!op.is_drawn) {
+                op.is_drawn = true;
+                addDirtyArea(op.drawn_area);
+            }
+            continue;
+        }
+        auto key = getKey(op, time);
+        if (op.is_drawn && (key == op.key)) {
+            continue;
+        }
+        if (op.is_drawn) {
+            addDirtyArea(op.drawn_area);
+        }
+        op.key = key;
+        op.is_drawn = true;
+        getDrawnArea(op, op.drawn_area);
+        addDirtyArea(op.drawn_area);
+    }
+
+    lv_area_t canvas_coords = {};
+    lv_obj_get_coords(_canvas->getNativeHandle(), &canvas_coords);
+    for (size_t i = 0; i < _dirty_area_num; i++) {
+        auto &area = _dirty_areas[i];
+        restoreBackground(area);
+
+        lv_layer_t layer = {};
+        lv_canvas_init_layer(_canvas->getNativeHandle(), &layer);
+        layer._clip_area = area;
+        lv_area_t clip_area = {};
+        for (size_t j = _bg_op_num; j < _ops.size(); j++) {
+            if (!intersectArea(_ops[j].drawn_area, area, clip_area)) {
+                continue;
+            }
+            draw(&layer, _ops[j]);
+            _stats.draw_op_count++;
+        }
+        finishLayer(&layer);
+
+        // Invalidate the redrawn area only, instead of the whole canvas
+        lv_area_t invalidated_area = {
+            area.x1 + canvas_coords.x1, area.y1 + canvas_coords.y1, area.x2 + canvas_coords.x1,
+            area.y2 + canvas_coords.y1
+        };
+        lv_obj_invalidate_area(_canvas->getNativeHandle(), &invalidated_area);
+        _stats.redraw_px += lv_area_get_size(&area);
+    }
+
+    auto update_us = static_cast<uint32_t>(esp_timer_get_time() - start_us);
+    _stats.update_count++;
+    _stats.update_us_total += update_us;
+    _stats.update_us_max = std::max(_stats.update_us_max, update_us);
+
+    return true;
+}
+
+void Watchface::setComplicationValue(uint8_t id, uint8_t value)
+{
+    value = std::min<uint8_t>(value, 100);
+    if (_complication_values[id] == value) {
+        return;
+    }
+    _complication_values[id] = value;
+
+    // The dynamic complications pick it up by their key
+    for (size_t i = 0; i < _ops.size(); i++) {
+        auto &op = _ops[i];
+        if ((op.type != ESP_BROOKESIA_WATCHFACE_LAYER_COMPLICATION) || (op.source != id) ||
+                (op.cadence != Cadence::Static)) {
+            continue;
+        }
+        if (i < _bg_op_num) {
+            _is_bg_dirty = isBegun();
+        } else {
+            op.is_drawn = false;
+        }
+    }
+}
+
+void Watchface::dump() const
+{
+    ESP_UTILS_LOGI(
+        "{Watchface(%s)}: %dx%d, %d draw ops, %d updates, avg(%dus), max(%dus), %d ops redrawn, %d px redrawn",
+        _name.c_str(), static_cast<int>(_width), static_cast<int>(_height), static_cast<int>(_ops.size()),
+        static_cast<int>(_stats.update_count),
+        static_cast<int>(_stats.update_us_total / std::max<uint32_t>(_stats.update_count, 1)),
+        static_cast<int>(_stats.update_us_max), static_cast<int>(_stats.draw_op_count),
+        static_cast<int>(_stats.redraw_px)
+    );
+}
+
+bool Watchface::compile(const uint8_t *data, size_t size)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    esp_brookesia_watchface_header_t header = {};
+    ESP_UTILS_CHECK_FALSE_RETURN(size >= sizeof(header), false, "Invalid size(%d)", static_cast<int>(size));
+    memcpy(&header, data, sizeof(header));
+
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        header.magic == ESP_BROOKESIA_WATCHFACE_MAGIC, false, "Invalid magic(0x%08x)",
+        static_cast<unsigned>(header.magic)
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        header.version == ESP_BROOKESIA_WATCHFACE_VERSION, false, "Unsupported version(%d)",
+        static_cast<int>(header.version)
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (header.size <= size) &&
+        (sizeof(header) + header.layer_num * sizeof(esp_brookesia_watchface_layer_t) <= header.size), false,
+        "Invalid size(%d/%d), layer_num(%d)", static_cast<int>(header.size), static_cast<int>(size),
+        static_cast<int>(header.layer_num)
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (header.width > 0) && (header.width <= WATCHFACE_SIZE_MAX) && (header.height > 0) &&
+        (header.height <= WATCHFACE_SIZE_MAX), false, "Invalid resolution(%dx%d)", static_cast<int>(header.width),
+        static_cast<int>(header.height)
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(header.layer_num > 0, false, "No layer");
+
+    std::vector<DrawOp> ops(header.layer_num);
+    auto layers = data + sizeof(header);
+    for (int i = 0; i < header.layer_num; i++) {
+        esp_brookesia_watchface_layer_t layer = {};
+        memcpy(&layer, layers + i * sizeof(layer), sizeof(layer));
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            compileLayer(data, header.size, layer, ops[i]), false, "Failed to compile layer(%d)", i
+        );
+    }
+
+    // The static layers above a dynamic one are drawn with the dynamic ones, to keep the order of the layers
+    size_t bg_op_num = 0;
+    while ((bg_op_num < ops.size()) && (ops[bg_op_num].cadence == Cadence::Static)) {
+        bg_op_num++;
+    }
+    for (size_t i = bg_op_num; i < ops.size(); i++) {
+        if (ops[i].cadence == Cadence::Static) {
+            getDrawnArea(ops[i], ops[i].drawn_area);
+        }
+    }
+
+    _width = header.width;
+    _height = header.height;
+    _bg_color = lv_color_hex(header.bg_color);
+    _data = data;
+    _data_size = header.size;
+    _ops = std::move(ops);
+    _bg_op_num = bg_op_num;
+    _is_bg_dirty = isBegun();
+
+    ESP_UTILS_LOGD(
+        "Compiled face: %dx%d, %d layers, %d bytes", static_cast<int>(_width), static_cast<int>(_height),
+        static_cast<int>(_ops.size()), static_cast<int>(_data_size)
+    );
+
+    return true;
+}
+
+bool Watchface::compileLayer(
+    const uint8_t *data, size_t size, const esp_brookesia_watchface_layer_t &layer, DrawOp &op
+)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(layer.type < ESP_BROOKESIA_WATCHFACE_LAYER_MAX, false, "Invalid type(%d)", layer.type);
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        layer.cadence < ESP_BROOKESIA_WATCHFACE_CADENCE_MAX, false, "Invalid cadence(%d)", layer.cadence
+    );
+
+    op = {};
+    op.type = static_cast<esp_brookesia_watchface_layer_type_t>(layer.type);
+    op.cadence = static_cast<Cadence>(layer.cadence);
+    op.source = layer.source;
+    op.opa = layer.opa;
+    op.color = lv_color_hex(layer.color);
+    op.area = {layer.x, layer.y, layer.x + layer.w - 1, layer.y + layer.h - 1};
+    op.param = layer.param;
+
+    switch (op.type) {
+    case ESP_BROOKESIA_WATCHFACE_LAYER_IMAGE: {
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            (layer.data_offset <= size) && (layer.data_size <= size - layer.data_offset), false,
+            "Invalid image data(%d, %d)", static_cast<int>(layer.data_offset), static_cast<int>(layer.data_size)
+        );
+
+        lv_color_format_t cf = LV_COLOR_FORMAT_UNKNOWN;
+        uint32_t px_size = 0;
+        uint32_t stride = 0;
+        switch (layer.source) {
+        case ESP_BROOKESIA_WATCHFACE_IMAGE_RGB565:
+            cf = LV_COLOR_FORMAT_RGB565;
+            px_size = 2;
+            stride = layer.w * 2;
+            break;
+        case ESP_BROOKESIA_WATCHFACE_IMAGE_RGB565A8:
+            cf = LV_COLOR_FORMAT_RGB565A8;
+            px_size = 3;
+            stride = layer.w * 2;
+            break;
+        case ESP_BROOKESIA_WATCHFACE_IMAGE_A8:
+            cf = LV_COLOR_FORMAT_A8;
+            px_size = 1;
+            stride = layer.w;
+            break;
+        default:
+            ESP_UTILS_CHECK_FALSE_RETURN(false, false, "Invalid image format(%d)", layer.source);
+        }
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            layer.data_size == static_cast<uint32_t>(layer.w) * layer.h * px_size, false,
+            "Invalid image size(%d), should be %dx%dx%d", static_cast<int>(layer.data_size), layer.w, layer.h,
+            static_cast<int>(px_size)
+        );
+
+        op.image.header.magic = LV_IMAGE_HEADER_MAGIC;
+        op.image.header.cf = cf;
+        op.image.header.w = layer.w;
+        op.image.header.h = layer.h;
+        op.image.header.stride = stride;
+        op.image.data = data + layer.data_offset;
+        op.image.data_size = layer.data_size;
+        break;
+    }
+    case ESP_BROOKESIA_WATCHFACE_LAYER_HAND:
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            layer.source < ESP_BROOKESIA_WATCHFACE_HAND_MAX, false, "Invalid hand(%d)", layer.source
+        );
+        op.width = std::max(static_cast<int>(layer.w), 1);
+        op.length = layer.h;
+        break;
+    case ESP_BROOKESIA_WATCHFACE_LAYER_TEXT:
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            layer.source < ESP_BROOKESIA_WATCHFACE_TEXT_MAX, false, "Invalid text(%d)", layer.source
+        );
+        // Drawn with another font, the text wouldn't fit the layout of the face
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            (layer.param <= UINT8_MAX) && getLvInternalFontBySize(layer.param, &op.font), false,
+            "Font size(%d) not built, enable `CONFIG_LV_FONT_MONTSERRAT_%d`", layer.param, layer.param
+        );
+        break;
+    default:
+        break;
+    }
+
+    // The static layers are drawn in the background, and the dynamic ones without a value are drawn once
+    op.drawn_area = op.area;
+
+    return true;
+}
+
+bool Watchface::updateBuffers()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    auto stride = lv_draw_buf_width_to_stride(_width, LV_COLOR_FORMAT_NATIVE);
+    size_t size = stride * _height;
+    if (size != _buf_size) {
+        if (_canvas_buf != nullptr) {
+            heap_caps_free(_canvas_buf);
+        }
+        if (_bg_buf != nullptr) {
+            heap_caps_free(_bg_buf);
+        }
+        _canvas_buf = allocBuffer(size);
+        _bg_buf = allocBuffer(size);
+        _buf_size = ((_canvas_buf != nullptr) && (_bg_buf != nullptr)) ? size : 0;
+        ESP_UTILS_CHECK_FALSE_RETURN(_buf_size > 0, false, "Failed to allocate buffers(%d)", static_cast<int>(size));
+    }
+    _buf_stride = stride;
+
+    ESP_UTILS_CHECK_FALSE_RETURN(_canvas->setBuffer(_canvas_buf, _width, _height), false, "Failed to set buffer");
+    lv_obj_center(_canvas->getNativeHandle());
+
+    return true;
+}
+
+void Watchface::renderBackground()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    lv_canvas_fill_bg(_canvas->getNativeHandle(), _bg_color, LV_OPA_COVER);
+
+    lv_layer_t layer = {};
+    lv_canvas_init_layer(_canvas->getNativeHandle(), &layer);
+    for (size_t i = 0; i < _bg_op_num; i++) {
+        draw(&layer, _ops[i]);
+    }
+    finishLayer(&layer);
+
+    memcpy(_bg_buf, _canvas_buf, _buf_size);
+}
+
+void Watchface::finishLayer(lv_layer_t *layer)
+{
+    // The canvas invalidates itself entirely, the callers invalidate what they redrew
+    auto display = lv_obj_get_display(_canvas->getNativeHandle());
+    lv_display_enable_invalidation(display, false);
+    lv_canvas_finish_layer(_canvas->getNativeHandle(), layer);
+    lv_display_enable_invalidation(display, true);
+}
+
+void Watchface::restoreBackground(const lv_area_t &area)
+{
+    auto px_size = lv_color_format_get_size(LV_COLOR_FORMAT_NATIVE);
+    size_t offset = area.y1 * _buf_stride + area.x1 * px_size;
+    size_t row_size = lv_area_get_width(&area) * px_size;
+    for (int32_t y = area.y1; y <= area.y2; y++) {
+        memcpy(_canvas_buf + offset, _bg_buf + offset, row_size);
+        offset += _buf_stride;
+    }
+}
+
+void Watchface::draw(lv_layer_t *layer, const DrawOp &op) const
+{
+    switch (op.type) {
+    case ESP_BROOKESIA_WATCHFACE_LAYER_FILL: {
+        lv_draw_rect_dsc_t dsc;
+        lv_draw_rect_dsc_init(&dsc);
+        dsc.bg_color = op.color;
+        dsc.bg_opa = op.opa;
+        dsc.radius = op.param;
+        lv_draw_rect(layer, &dsc, &op.area);
+        break;
+    }
+    case ESP_BROOKESIA_WATCHFACE_LAYER_IMAGE: {
+        lv_draw_image_dsc_t dsc;
+        lv_draw_image_dsc_init(&dsc);
+        dsc.src = &op.image;
+        dsc.opa = op.opa;
+        // The A8 images are drawn with the recolor
+        dsc.recolor = op.color;
+        dsc.recolor_opa = (op.image.header.cf == LV_COLOR_FORMAT_A8) ? LV_OPA_COVER : LV_OPA_TRANSP;
+        lv_draw_image(layer, &dsc, &op.area);
+        break;
+    }
+    case ESP_BROOKESIA_WATCHFACE_LAYER_HAND: {
+        lv_point_t start = {};
+        lv_point_t end = {};
+        getHandPoints(op, start, end);
+
+        lv_draw_line_dsc_t dsc;
+        lv_draw_line_dsc_init(&dsc);
+        dsc.color = op.color;
+        dsc.opa = op.opa;
+        dsc.width = op.width;
+        dsc.round_start = 1;
+        dsc.round_end = 1;
+        dsc.p1.x = start.x;
+        dsc.p1.y = start.y;
+        dsc.p2.x = end.x;
+        dsc.p2.y = end.y;
+        lv_draw_line(layer, &dsc);
+        break;
+    }
+    case ESP_BROOKESIA_WATCHFACE_LAYER_TEXT: {
+        char text[WATCHFACE_TEXT_SIZE_MAX] = {};
+        getText(op, text, sizeof(text));
+
+        lv_draw_label_dsc_t dsc;
+        lv_draw_label_dsc_init(&dsc);
+        dsc.color = op.color;
+        dsc.opa = op.opa;
+        dsc.font = op.font;
+        dsc.align = LV_TEXT_ALIGN_CENTER;
+        dsc.text = text;
+        // The text is drawn once the layer is finished
+        dsc.text_local = 1;
+        lv_area_t coords = op.area;
+        coords.y1 += (lv_area_get_height(&op.area) - lv_font_get_line_height(op.font)) / 2;
+        lv_draw_label(layer, &dsc, &coords);
+        break;
+    }
+    case ESP_BROOKESIA_WATCHFACE_LAYER_COMPLICATION: {
+        auto value = (op.cadence == Cadence::Static) ? _complication_values[op.source] : op.key;
+        if (value <= 0) {
+            break;
+        }
+
+        lv_draw_arc_dsc_t dsc;
+        lv_draw_arc_dsc_init(&dsc);
+        dsc.color = op.color;
+        dsc.opa = op.opa;
+        dsc.width = op.param;
+        dsc.rounded = 1;
+        dsc.center.x = (op.area.x1 + op.area.x2) / 2;
+        dsc.center.y = (op.area.y1 + op.area.y2) / 2;
+        dsc.radius = std::min(lv_area_get_width(&op.area), lv_area_get_height(&op.area)) / 2;
+        // 0 degree is at 3 o'clock, start from 12 o'clock
+        dsc.start_angle = 270;
+        dsc.end_angle = 270 + value * 360 / 100;
+        lv_draw_arc(layer, &dsc);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void Watchface::addDirtyArea(const lv_area_t &area)
+{
+    lv_area_t clipped_area = {};
+    if (!intersectArea(area, {0, 0, _width - 1, _height - 1}, clipped_area)) {
+        return;
+    }
+
+    for (size_t i = 0; i < _dirty_area_num; i++) {
+        lv_area_t overlap = {};
+        if (intersectArea(_dirty_areas[i], clipped_area, overlap)) {
+            joinArea(_dirty_areas[i], clipped_area);
+            return;
+        }
+    }
+    if (_dirty_area_num < _dirty_areas.size()) {
+        _dirty_areas[_dirty_area_num++] = clipped_area;
+    } else {
+        joinArea(_dirty_areas[_dirty_area_num - 1], clipped_area);
+    }
+}
+
+int32_t Watchface::getKey(const DrawOp &op, const struct tm &time) const
+{
+    // The layers updated every minute ignore the seconds
+    int32_t second = (op.cadence == Cadence::Second) ? time.tm_sec : 0;
+
+    switch (op.type) {
+    case ESP_BROOKESIA_WATCHFACE_LAYER_HAND: {
+        // Angle in 0.1 degree
+        switch (op.source) {
+        case ESP_BROOKESIA_WATCHFACE_HAND_HOUR:
+            return ((time.tm_hour % 12) * 3600 + time.tm_min * 60 + second) / 12;
+        case ESP_BROOKESIA_WATCHFACE_HAND_MINUTE:
+            return time.tm_min * 60 + second;
+        default:
+            return second * 60;
+        }
+    }
+    case ESP_BROOKESIA_WATCHFACE_LAYER_TEXT:
+        switch (op.source) {
+        case ESP_BROOKESIA_WATCHFACE_TEXT_TIME:
+            return time.tm_hour * 60 + time.tm_min;
+        case ESP_BROOKESIA_WATCHFACE_TEXT_SECOND:
+            return second;
+        case ESP_BROOKESIA_WATCHFACE_TEXT_DATE:
+            return (time.tm_wday << 16) | (time.tm_mday << 8) | time.tm_mon;
+        default:
+            return time.tm_wday;
+        }
+    case ESP_BROOKESIA_WATCHFACE_LAYER_COMPLICATION:
+        return _complication_values[op.source];
+    default:
+        return 0;
+    }
+}
+
+void Watchface::getDrawnArea(const DrawOp &op, lv_area_t &area) const
+{
+    if (op.type != ESP_BROOKESIA_WATCHFACE_LAYER_HAND) {
+        area = op.area;
+        return;
+    }
+
+    lv_point_t start = {};
+    lv_point_t end = {};
+    getHandPoints(op, start, end);
+
+    // Cover the round ends and the anti-aliasing
+    int32_t margin = op.width / 2 + 2;
+    area.x1 = std::min(start.x, end.x) - margin;
+    area.y1 = std::min(start.y, end.y) - margin;
+    area.x2 = std::max(start.x, end.x) + margin;
+    area.y2 = std::max(start.y, end.y) + margin;
+}
+
+void Watchface::getHandPoints(const DrawOp &op, lv_point_t &start, lv_point_t &end) const
+{
+    // Clockwise from 12 o'clock
+    float angle = op.key * static_cast<float>(M_PI) / 1800;
+    float dx = sinf(angle);
+    float dy = -cosf(angle);
+
+    start.x = op.area.x1 - lroundf(dx * op.param);
+    start.y = op.area.y1 - lroundf(dy * op.param);
+    end.x = op.area.x1 + lroundf(dx * op.length);
+    end.y = op.area.y1 + lroundf(dy * op.length);
+}
+
+void Watchface::getText(const DrawOp &op, char *text, size_t size) const
+{
+    int32_t key = op.key;
+
+    switch (op.source) {
+    case ESP_BROOKESIA_WATCHFACE_TEXT_TIME:
+        snprintf(text, size, "%02d:%02d", static_cast<int>(key / 60), static_cast<int>(key % 60));
+        break;
+    case ESP_BROOKESIA_WATCHFACE_TEXT_SECOND:
+        snprintf(text, size, "%02d", static_cast<int>(key));
+        break;
+    case ESP_BROOKESIA_WATCHFACE_TEXT_DATE:
+        snprintf(
+            text, size, "%s %02d %s", WEEKDAY_NAMES[(key >> 16) % 7], static_cast<int>((key >> 8) & 0xff),
+            MONTH_NAMES[(key & 0xff) % 12]
+        );
+        break;
+    default:
+        snprintf(text, size, "%s", WEEKDAY_NAMES[key % 7]);
+        break;
+    }
+}
+
+} // namespace esp_brookesia::gui
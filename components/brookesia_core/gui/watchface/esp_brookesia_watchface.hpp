@@ -0,0 +1,164 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <vector>
+#include "lvgl.h"
+#include "lvgl/esp_brookesia_lv_canvas.hpp"
+#include "esp_brookesia_watchface_format.h"
+
+namespace esp_brookesia::gui {
+
+/**
+ * @brief Watchface described by a binary face (see `esp_brookesia_watchface_format.h`), compiled at load time into a
+ *        flat list of draw operations and rendered on a canvas.
+ *
+ *        The static layers below the first dynamic one are drawn once into a background cache. On every update, only
+ *        the layers whose cadence is due and whose content changed are redrawn: their old and new areas are restored
+ *        from the background, then the layers above it crossing them are drawn again in order, clipped to these
+ *        areas. So a static layer above the dynamic ones (e.g. a cap over the hands) keeps its place.
+ *
+ * @note  Except the loading functions, everything should be called with the LVGL lock held
+ */
+class Watchface {
+public:
+    enum class Cadence : uint8_t {
+        Static = ESP_BROOKESIA_WATCHFACE_CADENCE_STATIC,
+        Minute = ESP_BROOKESIA_WATCHFACE_CADENCE_MINUTE,
+        Second = ESP_BROOKESIA_WATCHFACE_CADENCE_SECOND,
+        Max = ESP_BROOKESIA_WATCHFACE_CADENCE_MAX,
+    };
+
+    struct Stats {
+        uint32_t update_count;
+        uint32_t draw_op_count;     /*!< Draw operations run by the updates */
+        uint32_t redraw_px;         /*!< Area restored and redrawn by the updates */
+        uint32_t update_us_total;
+        uint32_t update_us_max;
+    };
+
+    Watchface() = default;
+    ~Watchface();
+
+    Watchface(const Watchface &) = delete;
+    Watchface &operator=(const Watchface &) = delete;
+
+    /**
+     * @brief Load a face from memory, used in place (e.g. a face of an assets partition resolved by `LvAssets`). The
+     *        data should stay valid until the face is unloaded
+     */
+    bool loadFromMemory(const void *data, size_t size);
+    /**
+     * @brief Load a face from a file (e.g. on the SD card), read into PSRAM since it can't be memory mapped
+     */
+    bool loadFromFile(const char *path);
+    void unload();
+
+    /**
+     * @brief Create the canvas showing the face, centered on the parent. The face can be loaded before or after, the
+     *        canvas is redrawn on the next update
+     */
+    bool begin(const LvObject *parent);
+    bool del();
+
+    /**
+     * @brief Redraw the layers due at this time
+     */
+    bool update(const struct tm &time);
+    /**
+     * @brief Set the value shown by the complications with this ID, from 0 to 100. It's shown by the next update,
+     *        the static complications are redrawn for it as well
+     */
+    void setComplicationValue(uint8_t id, uint8_t value);
+
+    bool isLoaded() const
+    {
+        return !_ops.empty();
+    }
+    bool isBegun() const
+    {
+        return (_canvas != nullptr);
+    }
+    LvCanvas *getCanvas() const
+    {
+        return _canvas.get();
+    }
+    const std::string &getName() const
+    {
+        return _name;
+    }
+    const Stats &getStats() const
+    {
+        return _stats;
+    }
+    void resetStats()
+    {
+        _stats = {};
+    }
+    void dump() const;
+
+private:
+    static constexpr size_t DIRTY_AREA_NUM_MAX = 8;
+
+    struct DrawOp {
+        esp_brookesia_watchface_layer_type_t type;
+        Cadence cadence;
+        uint8_t source;
+        lv_opa_t opa;
+        lv_color_t color;
+        lv_area_t area;             /*!< Layer area, the hands only use its top left corner as pivot */
+        uint16_t param;
+        uint16_t width;             /*!< Width of the hands */
+        uint16_t length;            /*!< Length of the hands */
+        lv_image_dsc_t image;
+        const lv_font_t *font;
+        // State of the dynamic operations
+        bool is_drawn;
+        int32_t key;                /*!< Shown value, e.g. angle or time */
+        lv_area_t drawn_area;       /*!< Area covered by the shown value */
+    };
+
+    bool compile(const uint8_t *data, size_t size);
+    bool compileLayer(const uint8_t *data, size_t size, const esp_brookesia_watchface_layer_t &layer, DrawOp &op);
+    bool updateBuffers();
+    void renderBackground();
+    void finishLayer(lv_layer_t *layer);
+    void restoreBackground(const lv_area_t &area);
+    void draw(lv_layer_t *layer, const DrawOp &op) const;
+    void addDirtyArea(const lv_area_t &area);
+
+    int32_t getKey(const DrawOp &op, const struct tm &time) const;
+    void getDrawnArea(const DrawOp &op, lv_area_t &area) const;
+    void getHandPoints(const DrawOp &op, lv_point_t &start, lv_point_t &end) const;
+    void getText(const DrawOp &op, char *text, size_t size) const;
+
+    std::string _name;
+    const uint8_t *_data = nullptr;
+    size_t _data_size = 0;
+    uint8_t *_file_data = nullptr;
+    int32_t _width = 0;
+    int32_t _height = 0;
+    lv_color_t _bg_color = {};
+    std::vector<DrawOp> _ops;
+    size_t _bg_op_num = 0;          /*!< Static layers below the first dynamic one, drawn in the background */
+    std::array<uint8_t, UINT8_MAX + 1> _complication_values = {};
+
+    std::unique_ptr<LvCanvas> _canvas;
+    uint8_t *_canvas_buf = nullptr;
+    uint8_t *_bg_buf = nullptr;
+    size_t _buf_size = 0;
+    uint32_t _buf_stride = 0;
+    bool _is_bg_dirty = false;
+    std::array<lv_area_t, DIRTY_AREA_NUM_MAX> _dirty_areas = {};
+    size_t _dirty_area_num = 0;
+    Stats _stats = {};
+};
+
+} // namespace esp_brookesia::gui
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+/**
+ * @brief Binary watchface format, shared with the host tools packing the faces
+ *
+ * A face is a header, followed by `layer_num` layers drawn in order, followed by the data of the layers (e.g. image
+ * pixels). All the fields are little-endian and the offsets are relative to the start of the face, so a face can be
+ * used in place once memory mapped.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ESP_BROOKESIA_WATCHFACE_MAGIC       (0x31465742)    /*!< "BWF1" */
+#define ESP_BROOKESIA_WATCHFACE_VERSION     (1)
+
+typedef enum {
+    ESP_BROOKESIA_WATCHFACE_LAYER_FILL = 0,         /*!< Rectangle, `param` is the radius */
+    ESP_BROOKESIA_WATCHFACE_LAYER_IMAGE,            /*!< Image, `source` is the format of the data */
+    ESP_BROOKESIA_WATCHFACE_LAYER_HAND,             /*!< Hand around (`x`, `y`), `h` is its length, `w` its width and
+                                                     *   `param` the length of its tail. `source` is the time unit */
+    ESP_BROOKESIA_WATCHFACE_LAYER_TEXT,             /*!< Text centered in the layer, `source` is the text field and
+                                                     *   `param` the font size. It must be the size of a Montserrat
+                                                     *   font built in LVGL (`CONFIG_LV_FONT_MONTSERRAT_<size>`, even
+                                                     *   sizes from 8 to 48), otherwise the face fails to load */
+    ESP_BROOKESIA_WATCHFACE_LAYER_COMPLICATION,     /*!< Arc gauge from 0 to 100, `source` is the complication ID and
+                                                     *   `param` the arc width */
+    ESP_BROOKESIA_WATCHFACE_LAYER_MAX,
+} esp_brookesia_watchface_layer_type_t;
+
+/**
+ * @brief How often a layer is redrawn. The static layers are drawn once in the background
+ */
+typedef enum {
+    ESP_BROOKESIA_WATCHFACE_CADENCE_STATIC = 0,
+    ESP_BROOKESIA_WATCHFACE_CADENCE_MINUTE,
+    ESP_BROOKESIA_WATCHFACE_CADENCE_SECOND,
+    ESP_BROOKESIA_WATCHFACE_CADENCE_MAX,
+} esp_brookesia_watchface_cadence_t;
+
+typedef enum {
+    ESP_BROOKESIA_WATCHFACE_IMAGE_RGB565 = 0,
+    ESP_BROOKESIA_WATCHFACE_IMAGE_RGB565A8,         /*!< RGB565 plane followed by the alpha plane */
+    ESP_BROOKESIA_WATCHFACE_IMAGE_A8,               /*!< Alpha only, drawn with the layer color */
+    ESP_BROOKESIA_WATCHFACE_IMAGE_MAX,
+} esp_brookesia_watchface_image_format_t;
+
+typedef enum {
+    ESP_BROOKESIA_WATCHFACE_HAND_HOUR = 0,
+    ESP_BROOKESIA_WATCHFACE_HAND_MINUTE,
+    ESP_BROOKESIA_WATCHFACE_HAND_SECOND,
+    ESP_BROOKESIA_WATCHFACE_HAND_MAX,
+} esp_brookesia_watchface_hand_t;
+
+typedef enum {
+    ESP_BROOKESIA_WATCHFACE_TEXT_TIME = 0,          /*!< "HH:MM" */
+    ESP_BROOKESIA_WATCHFACE_TEXT_SECOND,            /*!< "SS" */
+    ESP_BROOKESIA_WATCHFACE_TEXT_DATE,              /*!< "Mon 01 Jan" */
+    ESP_BROOKESIA_WATCHFACE_TEXT_WEEKDAY,           /*!< "Mon" */
+    ESP_BROOKESIA_WATCHFACE_TEXT_MAX,
+} esp_brookesia_watchface_text_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t layer_num;
+    uint16_t width;
+    uint16_t height;
+    uint32_t bg_color;          /*!< 0xRRGGBB */
+    uint32_t size;              /*!< Size of the whole face */
+} esp_brookesia_watchface_header_t;
+
+typedef struct __attribute__((packed)) {
+    uint8_t type;               /*!< `esp_brookesia_watchface_layer_type_t` */
+    uint8_t cadence;            /*!< `esp_brookesia_watchface_cadence_t` */
+    uint8_t source;             /*!< Depends on the type, see `esp_brookesia_watchface_layer_type_t` */
+    uint8_t opa;
+    int16_t x;
+    int16_t y;
+    uint16_t w;
+    uint16_t h;
+    uint32_t color;             /*!< 0xRRGGBB */
+    uint16_t param;             /*!< Depends on the type, see `esp_brookesia_watchface_layer_type_t` */
+    uint16_t reserved;
+    uint32_t data_offset;
+    uint32_t data_size;
+} esp_brookesia_watchface_layer_t;
+
+#ifdef __cplusplus
+}
+#endif
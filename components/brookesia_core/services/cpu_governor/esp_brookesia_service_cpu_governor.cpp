@@ -0,0 +1,310 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include "private/esp_brookesia_service_cpu_governor_utils.hpp"
+#include "lvgl/esp_brookesia_lv_lock.hpp"
+#include "esp_brookesia_service_cpu_governor.hpp"
+
+#define PM_LOCK_CPU_FREQ_NAME               "bs_governor"
+#define RELEASE_TIMER_NAME                  "bs_governor"
+
+namespace esp_brookesia::services {
+
+CpuGovernor::BoostGuard::BoostGuard(BoostSource source):
+    _source(source)
+{
+    CpuGovernor::requestInstance().requestBoost(_source, true);
+}
+
+CpuGovernor::BoostGuard::~BoostGuard()
+{
+    CpuGovernor::requestInstance().requestBoost(_source, false);
+}
+
+CpuGovernor::~CpuGovernor()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    if (_is_begun) {
+        del();
+    }
+}
+
+bool CpuGovernor::begin(const Config &config, lv_display_t *display)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!_is_begun, false, "Already begun");
+    ESP_UTILS_CHECK_NULL_RETURN(display, false, "Invalid display");
+
+    esp_utils::function_guard del_guard([this]() {
+        ESP_UTILS_CHECK_FALSE_EXIT(del(), "Delete failed");
+    });
+
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    _config = config;
+    _display = display;
+
+#if CONFIG_PM_ENABLE
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, PM_LOCK_CPU_FREQ_NAME, &_cpu_freq_lock), false,
+        "Create CPU frequency lock failed"
+    );
+#else
+    ESP_UTILS_LOGW("Power management is disabled (CONFIG_PM_ENABLE), only the residency is recorded");
+#endif
+
+    esp_timer_create_args_t timer_args = {
+        .callback = onReleaseTimerCallback,
+        .arg = this,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = RELEASE_TIMER_NAME,
+        .skip_unhandled_events = true,
+    };
+    ESP_UTILS_CHECK_ERROR_RETURN(esp_timer_create(&timer_args, &_release_timer), false, "Create timer failed");
+
+    {
+        gui::LvLockGuard gui_guard;
+        lv_display_add_event_cb(_display, onDisplayRefreshStartEventCallback, LV_EVENT_REFR_START, this);
+    }
+
+    _is_begun = true;
+    resetResidency();
+    del_guard.release();
+
+    return true;
+}
+
+bool CpuGovernor::del()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    if (_display != nullptr) {
+        gui::LvLockGuard gui_guard;
+        lv_display_remove_event_cb_with_user_data(_display, onDisplayRefreshStartEventCallback, this);
+        _display = nullptr;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    if (_release_timer != nullptr) {
+        esp_timer_stop(_release_timer);
+        esp_timer_delete(_release_timer);
+        _release_timer = nullptr;
+    }
+    if (_cpu_freq_lock != nullptr) {
+        if (_is_locked) {
+            esp_pm_lock_release(_cpu_freq_lock);
+        }
+        esp_pm_lock_delete(_cpu_freq_lock);
+        _cpu_freq_lock = nullptr;
+    }
+    _boost_refs = {};
+    _is_animation_boosted = false;
+    _is_locked = false;
+    _is_release_pending = false;
+    _is_begun = false;
+
+    return true;
+}
+
+bool CpuGovernor::requestBoost(BoostSource source, bool boost)
+{
+    ESP_UTILS_LOGD("Param: source(%s), boost(%d)", getBoostSourceName(source), boost);
+    ESP_UTILS_CHECK_FALSE_RETURN(source < BoostSource::Max, false, "Invalid source");
+
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    if (!_is_begun) {
+        return true;
+    }
+
+    auto &refs = _boost_refs[static_cast<size_t>(source)];
+    if (boost) {
+        refs++;
+        _residency.boost_count[static_cast<size_t>(source)]++;
+    } else if (refs > 0) {
+        refs--;
+    } else {
+        ESP_UTILS_LOGW("Unbalanced boost release from %s", getBoostSourceName(source));
+    }
+    updateLock();
+
+    return true;
+}
+
+bool CpuGovernor::isBoosted()
+{
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    return _is_locked;
+}
+
+CpuGovernor::Residency CpuGovernor::getResidency()
+{
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    updateResidency(esp_timer_get_time());
+
+    return _residency;
+}
+
+void CpuGovernor::resetResidency()
+{
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    _residency = {};
+#if CONFIG_PM_ENABLE
+    esp_pm_config_t pm_config = {};
+    if (esp_pm_get_configuration(&pm_config) == ESP_OK) {
+        _residency.max_freq_mhz = pm_config.max_freq_mhz;
+        _residency.min_freq_mhz = pm_config.min_freq_mhz;
+    }
+#else
+    _residency.max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+    _residency.min_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+#endif
+    _residency_last_us = esp_timer_get_time();
+}
+
+void CpuGovernor::dumpResidency()
+{
+    auto residency = getResidency();
+    auto total_us = std::max<uint64_t>(residency.boosted_us + residency.idle_us, 1);
+
+    ESP_UTILS_LOGI(
+        "{CPU residency}:\n"
+        "\t-%dMHz: %dms (%d%%)\n"
+        "\t-%dMHz: %dms (%d%%)\n"
+        "\t-Boosts: gesture(%d), animation(%d), anim_player(%d), sensor(%d), other(%d)",
+        residency.max_freq_mhz, static_cast<int>(residency.boosted_us / 1000),
+        static_cast<int>(residency.boosted_us * 100 / total_us),
+        residency.min_freq_mhz, static_cast<int>(residency.idle_us / 1000),
+        static_cast<int>(residency.idle_us * 100 / total_us),
+        static_cast<int>(residency.boost_count[static_cast<size_t>(BoostSource::Gesture)]),
+        static_cast<int>(residency.boost_count[static_cast<size_t>(BoostSource::Animation)]),
+        static_cast<int>(residency.boost_count[static_cast<size_t>(BoostSource::AnimPlayer)]),
+        static_cast<int>(residency.boost_count[static_cast<size_t>(BoostSource::Sensor)]),
+        static_cast<int>(residency.boost_count[static_cast<size_t>(BoostSource::Other)])
+    );
+#if CONFIG_PM_PROFILING
+    // The governor only knows its own lock, the profiler also accounts for the locks of the drivers
+    esp_pm_dump_locks(stdout);
+#endif
+}
+
+const char *CpuGovernor::getBoostSourceName(BoostSource source)
+{
+    switch (source) {
+    case BoostSource::Gesture:
+        return "Gesture";
+    case BoostSource::Animation:
+        return "Animation";
+    case BoostSource::AnimPlayer:
+        return "AnimPlayer";
+    case BoostSource::Sensor:
+        return "Sensor";
+    case BoostSource::Other:
+        return "Other";
+    default:
+        return "Unknown";
+    }
+}
+
+bool CpuGovernor::isBoostNeeded() const
+{
+    return std::any_of(_boost_refs.begin(), _boost_refs.end(), [](uint16_t refs) {
+        return refs > 0;
+    });
+}
+
+void CpuGovernor::updateLock()
+{
+    if (isBoostNeeded()) {
+        if (_is_release_pending) {
+            esp_timer_stop(_release_timer);
+            _is_release_pending = false;
+        }
+        if (!_is_locked) {
+            updateResidency(esp_timer_get_time());
+            if (_cpu_freq_lock != nullptr) {
+                esp_pm_lock_acquire(_cpu_freq_lock);
+            }
+            _is_locked = true;
+            ESP_UTILS_LOGD("Boost on");
+        }
+        return;
+    }
+
+    if (!_is_locked || _is_release_pending) {
+        return;
+    }
+    if (_config.release_delay_ms > 0) {
+        ESP_UTILS_CHECK_ERROR_EXIT(
+            esp_timer_start_once(_release_timer, static_cast<uint64_t>(_config.release_delay_ms) * 1000),
+            "Start release timer failed"
+        );
+        _is_release_pending = true;
+        return;
+    }
+
+    releaseLock();
+}
+
+void CpuGovernor::releaseLock()
+{
+    updateResidency(esp_timer_get_time());
+    if (_cpu_freq_lock != nullptr) {
+        esp_pm_lock_release(_cpu_freq_lock);
+    }
+    _is_locked = false;
+    ESP_UTILS_LOGD("Boost off");
+}
+
+void CpuGovernor::updateResidency(int64_t now_us)
+{
+    auto elapsed_us = static_cast<uint64_t>(std::max<int64_t>(now_us - _residency_last_us, 0));
+    if (_is_locked) {
+        _residency.boosted_us += elapsed_us;
+    } else {
+        _residency.idle_us += elapsed_us;
+    }
+    _residency_last_us = now_us;
+}
+
+void CpuGovernor::onReleaseTimerCallback(void *arg)
+{
+    auto governor = static_cast<CpuGovernor *>(arg);
+    ESP_UTILS_CHECK_NULL_EXIT(governor, "Invalid governor");
+
+    std::lock_guard<std::recursive_mutex> lock(governor->_mutex);
+
+    if (!governor->_is_release_pending) {
+        return;
+    }
+    governor->_is_release_pending = false;
+    // The delay is over, so release right away unless a request arrived after the timer expired. Going through
+    // `updateLock()` would only start the timer again
+    if (!governor->isBoostNeeded() && governor->_is_locked) {
+        governor->releaseLock();
+    }
+}
+
+void CpuGovernor::onDisplayRefreshStartEventCallback(lv_event_t *event)
+{
+    auto governor = static_cast<CpuGovernor *>(lv_event_get_user_data(event));
+    ESP_UTILS_CHECK_NULL_EXIT(governor, "Invalid governor");
+
+    // Runs in the LVGL task on every refresh period, so it costs no extra wakeup to follow the animation list
+    bool is_animating = (lv_anim_count_running() > 0);
+    if (is_animating != governor->_is_animation_boosted) {
+        governor->_is_animation_boosted = is_animating;
+        governor->requestBoost(BoostSource::Animation, is_animating);
+    }
+}
+
+} // namespace esp_brookesia::services
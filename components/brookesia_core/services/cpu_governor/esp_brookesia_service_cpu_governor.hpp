@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <mutex>
+#include "esp_pm.h"
+#include "esp_timer.h"
+#include "lvgl.h"
+
+namespace esp_brookesia::services {
+
+/**
+ * @brief Hold the CPU at the maximum frequency only while the UI is busy, otherwise let it drop to the minimum
+ *        frequency configured by `esp_pm_configure()`
+ */
+class CpuGovernor {
+public:
+    enum class BoostSource : uint8_t {
+        Gesture = 0,
+        Animation,      /*!< LVGL animations, tracked automatically from the display refresh */
+        AnimPlayer,
+        Sensor,
+        Other,
+        Max,
+    };
+
+    struct Config {
+        uint32_t release_delay_ms;  /*!< Keep boosting a little after the last request, avoid toggling per frame */
+    };
+
+    struct Residency {
+        int max_freq_mhz;
+        int min_freq_mhz;
+        uint64_t boosted_us;
+        uint64_t idle_us;
+        std::array<uint32_t, static_cast<size_t>(BoostSource::Max)> boost_count;
+    };
+
+    /**
+     * @brief Hold a boost request for the lifetime of the object, e.g. around a sensor burst read
+     */
+    class BoostGuard {
+    public:
+        BoostGuard(BoostSource source);
+        ~BoostGuard();
+
+        BoostGuard(const BoostGuard &) = delete;
+        BoostGuard &operator=(const BoostGuard &) = delete;
+
+    private:
+        BoostSource _source;
+    };
+
+    CpuGovernor(const CpuGovernor &) = delete;
+    CpuGovernor(CpuGovernor &&) = delete;
+    CpuGovernor &operator=(const CpuGovernor &) = delete;
+    CpuGovernor &operator=(CpuGovernor &&) = delete;
+
+    bool begin(const Config &config, lv_display_t *display);
+    bool del();
+
+    /**
+     * @brief Request or release a boost, requests from the same source are reference counted
+     */
+    bool requestBoost(BoostSource source, bool boost);
+
+    bool isBoosted();
+    Residency getResidency();
+    void resetResidency();
+    void dumpResidency();
+
+    static const char *getBoostSourceName(BoostSource source);
+
+    static CpuGovernor &requestInstance()
+    {
+        static CpuGovernor instance;
+        return instance;
+    }
+
+private:
+    CpuGovernor() = default;
+    ~CpuGovernor();
+
+    bool isBoostNeeded() const;
+    void updateLock();
+    void releaseLock();
+    void updateResidency(int64_t now_us);
+
+    static void onReleaseTimerCallback(void *arg);
+    static void onDisplayRefreshStartEventCallback(lv_event_t *event);
+
+    bool _is_begun = false;
+    Config _config = {};
+    lv_display_t *_display = nullptr;
+    esp_pm_lock_handle_t _cpu_freq_lock = nullptr;
+    esp_timer_handle_t _release_timer = nullptr;
+
+    std::recursive_mutex _mutex;
+    std::array<uint16_t, static_cast<size_t>(BoostSource::Max)> _boost_refs = {};
+    bool _is_animation_boosted = false;
+    bool _is_locked = false;
+    bool _is_release_pending = false;
+    int64_t _residency_last_us = 0;
+    Residency _residency = {};
+};
+
+} // namespace esp_brookesia::services
@@ -31,3 +31,45 @@
 #       endif
 #   endif
 #endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////// Power //////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(ESP_BROOKESIA_SERVICES_ENABLE_POWER)
+#   if defined(CONFIG_ESP_BROOKESIA_SERVICES_ENABLE_POWER)
+#       define ESP_BROOKESIA_SERVICES_ENABLE_POWER  CONFIG_ESP_BROOKESIA_SERVICES_ENABLE_POWER
+#   else
+#       define ESP_BROOKESIA_SERVICES_ENABLE_POWER  (0)
+#   endif
+#endif
+
+#if ESP_BROOKESIA_SERVICES_ENABLE_POWER
+#   if !defined(ESP_BROOKESIA_POWER_ENABLE_DEBUG_LOG)
+#       if defined(CONFIG_ESP_BROOKESIA_POWER_ENABLE_DEBUG_LOG)
+#           define ESP_BROOKESIA_POWER_ENABLE_DEBUG_LOG  CONFIG_ESP_BROOKESIA_POWER_ENABLE_DEBUG_LOG
+#       else
+#           define ESP_BROOKESIA_POWER_ENABLE_DEBUG_LOG  (0)
+#       endif
+#   endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////// CPU Governor ///////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(ESP_BROOKESIA_SERVICES_ENABLE_CPU_GOVERNOR)
+#   if defined(CONFIG_ESP_BROOKESIA_SERVICES_ENABLE_CPU_GOVERNOR)
+#       define ESP_BROOKESIA_SERVICES_ENABLE_CPU_GOVERNOR  CONFIG_ESP_BROOKESIA_SERVICES_ENABLE_CPU_GOVERNOR
+#   else
+#       define ESP_BROOKESIA_SERVICES_ENABLE_CPU_GOVERNOR  (0)
+#   endif
+#endif
+
+#if ESP_BROOKESIA_SERVICES_ENABLE_CPU_GOVERNOR
+#   if !defined(ESP_BROOKESIA_CPU_GOVERNOR_ENABLE_DEBUG_LOG)
+#       if defined(CONFIG_ESP_BROOKESIA_CPU_GOVERNOR_ENABLE_DEBUG_LOG)
+#           define ESP_BROOKESIA_CPU_GOVERNOR_ENABLE_DEBUG_LOG  CONFIG_ESP_BROOKESIA_CPU_GOVERNOR_ENABLE_DEBUG_LOG
+#       else
+#           define ESP_BROOKESIA_CPU_GOVERNOR_ENABLE_DEBUG_LOG  (0)
+#       endif
+#   endif
+#endif
@@ -0,0 +1,698 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include <limits>
+#include "esp_timer.h"
+#include "esp_sleep.h"
+#include "private/esp_brookesia_service_power_utils.hpp"
+#include "lvgl/esp_brookesia_lv_lock.hpp"
+#include "esp_brookesia_service_power.hpp"
+
+#define EVENT_THREAD_NAME                   "power"
+#define EVENT_THREAD_STACK_SIZE             (4 * 1024)
+#define EVENT_THREAD_STACK_CAPS_EXT         (false)
+#define EVENT_QUEUE_LENGTH                  (8)
+#define DIM_ACTIVITY_POLL_MS                (200)
+#define WAKEUP_GPIO_RELEASE_POLL_MS         (10)
+#define WAKEUP_GPIO_RELEASE_TIMEOUT_MS      (2000)
+#define WAKEUP_GPIO_RELEASE_TIMER_NAME      "bs_power_gpio"
+#define PM_LOCK_CPU_FREQ_NAME               "bs_power_cpu"
+#define PM_LOCK_NO_LIGHT_SLEEP_NAME         "bs_power_awake"
+
+namespace esp_brookesia::services {
+
+Power::~Power()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    if (_is_begun) {
+        del();
+    }
+}
+
+bool Power::begin(const Config &config, lv_display_t *display)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!_is_begun, false, "Already begun");
+    ESP_UTILS_CHECK_NULL_RETURN(display, false, "Invalid display");
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (config.timeout.dim_ms <= config.timeout.display_off_ms) &&
+        (config.timeout.display_off_ms <= config.timeout.light_sleep_ms), false, "Invalid timeouts"
+    );
+
+    esp_utils::function_guard del_guard([this]() {
+        ESP_UTILS_CHECK_FALSE_EXIT(del(), "Delete failed");
+    });
+
+    _config = config;
+    _display = display;
+    _state = State::Active;
+
+    _event_queue = xQueueCreate(EVENT_QUEUE_LENGTH, sizeof(Event));
+    ESP_UTILS_CHECK_NULL_RETURN(_event_queue, false, "Create event queue failed");
+
+    ESP_UTILS_CHECK_FALSE_RETURN(initPowerManagement(), false, "Init power management failed");
+    ESP_UTILS_CHECK_FALSE_RETURN(initWakeupGpios(), false, "Init wakeup GPIOs failed");
+
+    {
+        gui::LvLockGuard gui_guard;
+        lv_display_add_event_cb(_display, onDisplayRefreshReadyEventCallback, LV_EVENT_REFR_READY, this);
+    }
+
+    {
+        esp_utils::thread_config_guard thread_config(esp_utils::ThreadConfig{
+            .name = EVENT_THREAD_NAME,
+            .stack_size = EVENT_THREAD_STACK_SIZE,
+            .stack_in_ext = EVENT_THREAD_STACK_CAPS_EXT,
+        });
+        _event_thread = boost::thread([this]() {
+            ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+            Event event = {};
+            while (true) {
+                if (xQueueReceive(_event_queue, &event, getIdleWaitTicks()) != pdTRUE) {
+                    processIdleTimeout();
+                    continue;
+                }
+                if (event.type == EventType::Exit) {
+                    break;
+                }
+                processEvent(event);
+            }
+        });
+    }
+
+    _is_begun = true;
+    del_guard.release();
+
+    ESP_UTILS_LOGI(
+        "Power begun: dim(%dms), display off(%dms), light sleep(%dms)", static_cast<int>(_config.timeout.dim_ms),
+        static_cast<int>(_config.timeout.display_off_ms), static_cast<int>(_config.timeout.light_sleep_ms)
+    );
+
+    return true;
+}
+
+bool Power::del()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    if (_event_thread.joinable()) {
+        sendEvent({.type = EventType::Exit});
+        _event_thread.join();
+    }
+
+    deinitWakeupGpios();
+
+    if (_display != nullptr) {
+        gui::LvLockGuard gui_guard;
+        lv_display_remove_event_cb_with_user_data(_display, onDisplayRefreshReadyEventCallback, this);
+    }
+
+    if (_cpu_freq_lock != nullptr) {
+        if (_is_cpu_freq_locked.exchange(false)) {
+            esp_pm_lock_release(_cpu_freq_lock);
+        }
+        esp_pm_lock_delete(_cpu_freq_lock);
+        _cpu_freq_lock = nullptr;
+    }
+    if (_no_light_sleep_lock != nullptr) {
+        if (_is_no_light_sleep_locked) {
+            esp_pm_lock_release(_no_light_sleep_lock);
+        }
+        esp_pm_lock_delete(_no_light_sleep_lock);
+        _no_light_sleep_lock = nullptr;
+    }
+    _is_no_light_sleep_locked = false;
+
+    if (_event_queue != nullptr) {
+        vQueueDelete(_event_queue);
+        _event_queue = nullptr;
+    }
+
+    _display = nullptr;
+    _is_wake_latency_pending = false;
+    _is_begun = false;
+
+    return true;
+}
+
+bool Power::requestState(State state)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_LOGD("Param: state(%s)", getStateName(state));
+    ESP_UTILS_CHECK_FALSE_RETURN(state < State::Max, false, "Invalid state");
+
+    ESP_UTILS_CHECK_FALSE_RETURN(sendEvent({
+        .type = EventType::RequestState,
+        .state = state,
+        .source = WakeupSource::Software,
+        .timestamp_us = esp_timer_get_time(),
+    }), false, "Send request state event failed");
+
+    return true;
+}
+
+bool Power::setAlwaysOn(bool enable)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_LOGD("Param: enable(%d)", enable);
+
+    if (_is_always_on.exchange(enable) == enable) {
+        return true;
+    }
+    // Let the power task recalculate its timeout
+    if (_is_begun) {
+        ESP_UTILS_CHECK_FALSE_RETURN(sendEvent({.type = EventType::Update}), false, "Send update event failed");
+    }
+
+    return true;
+}
+
+bool Power::notifyWakeup(WakeupSource source)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    ESP_UTILS_LOGD("Param: source(%s)", getWakeupSourceName(source));
+
+    ESP_UTILS_CHECK_FALSE_RETURN(sendEvent({
+        .type = EventType::Wakeup,
+        .state = State::Active,
+        .source = source,
+        .timestamp_us = esp_timer_get_time(),
+    }), false, "Send wakeup event failed");
+
+    return true;
+}
+
+void IRAM_ATTR Power::notifyWakeupFromISR(WakeupSource source)
+{
+    if (_event_queue == nullptr) {
+        return;
+    }
+
+    Event event = {
+        .type = EventType::Wakeup,
+        .state = State::Active,
+        .source = source,
+        .timestamp_us = esp_timer_get_time(),
+    };
+    BaseType_t need_yield = pdFALSE;
+    xQueueSendFromISR(_event_queue, &event, &need_yield);
+    if (need_yield == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+Power::WakeLatency Power::getWakeLatency()
+{
+    std::lock_guard<std::mutex> lock(_wake_latency_mutex);
+
+    return _wake_latency;
+}
+
+void Power::dumpWakeLatency()
+{
+    auto latency = getWakeLatency();
+
+    ESP_UTILS_LOGI(
+        "{Wake to first frame}:\n"
+        "\t-Count(%d)\n"
+        "\t-Last(%dus, %s)\n"
+        "\t-Min(%dus)\n"
+        "\t-Max(%dus)\n"
+        "\t-Avg(%dus)",
+        static_cast<int>(latency.count), static_cast<int>(latency.last_us), getWakeupSourceName(latency.last_source),
+        static_cast<int>(latency.min_us), static_cast<int>(latency.max_us),
+        static_cast<int>((latency.count > 0) ? (latency.total_us / latency.count) : 0)
+    );
+}
+
+boost::signals2::connection Power::connectStateChangedSignal(StateChangedSignal::slot_type slot)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    return _state_changed_signal.connect(slot);
+}
+
+const char *Power::getStateName(State state)
+{
+    switch (state) {
+    case State::Active:
+        return "Active";
+    case State::Dim:
+        return "Dim";
+    case State::DisplayOff:
+        return "DisplayOff";
+    case State::LightSleep:
+        return "LightSleep";
+    default:
+        return "Unknown";
+    }
+}
+
+const char *Power::getWakeupSourceName(WakeupSource source)
+{
+    switch (source) {
+    case WakeupSource::None:
+        return "None";
+    case WakeupSource::Button:
+        return "Button";
+    case WakeupSource::Touch:
+        return "Touch";
+    case WakeupSource::RtcAlarm:
+        return "RtcAlarm";
+    case WakeupSource::Software:
+        return "Software";
+    default:
+        return "Unknown";
+    }
+}
+
+bool Power::initPowerManagement()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+#if CONFIG_PM_ENABLE
+    esp_pm_config_t pm_config = {
+        .max_freq_mhz = _config.cpu.max_freq_mhz,
+        .min_freq_mhz = _config.cpu.min_freq_mhz,
+#if CONFIG_FREERTOS_USE_TICKLESS_IDLE
+        .light_sleep_enable = true,
+#else
+        .light_sleep_enable = false,
+#endif
+    };
+    ESP_UTILS_CHECK_ERROR_RETURN(esp_pm_configure(&pm_config), false, "Configure power management failed");
+
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, PM_LOCK_CPU_FREQ_NAME, &_cpu_freq_lock), false,
+        "Create CPU frequency lock failed"
+    );
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, PM_LOCK_NO_LIGHT_SLEEP_NAME, &_no_light_sleep_lock), false,
+        "Create no light sleep lock failed"
+    );
+    // Start in the active state, the CPU frequency is only boosted while waking up
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        esp_pm_lock_acquire(_no_light_sleep_lock), false, "Acquire no light sleep lock failed"
+    );
+    _is_no_light_sleep_locked = true;
+#else
+    ESP_UTILS_LOGW("Power management is disabled (CONFIG_PM_ENABLE), only display states are available");
+#endif
+
+    return true;
+}
+
+bool Power::initWakeupGpios()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    if (_config.wakeup_gpios.empty()) {
+        return true;
+    }
+
+    // The ISR service may have been installed by the BSP already
+    auto ret = gpio_install_isr_service(0);
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (ret == ESP_OK) || (ret == ESP_ERR_INVALID_STATE), false, "Install GPIO ISR service failed"
+    );
+
+    // Reserve first, the ISR arguments point into this vector
+    _wakeup_gpio_contexts.reserve(_config.wakeup_gpios.size());
+    for (auto &wakeup_gpio : _config.wakeup_gpios) {
+        _wakeup_gpio_contexts.push_back({this, wakeup_gpio});
+    }
+
+    for (auto &context : _wakeup_gpio_contexts) {
+        auto gpio = context.gpio.gpio;
+        ESP_UTILS_LOGD(
+            "Init wakeup GPIO(%d): source(%s), active_low(%d)", static_cast<int>(gpio),
+            getWakeupSourceName(context.gpio.source), context.gpio.active_low
+        );
+        if (gpio == GPIO_NUM_NC) {
+            continue;
+        }
+
+        esp_timer_create_args_t timer_args = {
+            .callback = onWakeupGpioReleaseTimerCallback,
+            .arg = &context,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = WAKEUP_GPIO_RELEASE_TIMER_NAME,
+            .skip_unhandled_events = true,
+        };
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            esp_timer_create(&timer_args, &context.release_timer), false, "Create GPIO(%d) release timer failed",
+            static_cast<int>(gpio)
+        );
+
+        gpio_config_t io_conf = {
+            .pin_bit_mask = BIT64(gpio),
+            .mode = GPIO_MODE_INPUT,
+            .pull_up_en = context.gpio.active_low ? GPIO_PULLUP_ENABLE : GPIO_PULLUP_DISABLE,
+            .pull_down_en = context.gpio.active_low ? GPIO_PULLDOWN_DISABLE : GPIO_PULLDOWN_ENABLE,
+            .intr_type = GPIO_INTR_DISABLE,
+        };
+        ESP_UTILS_CHECK_ERROR_RETURN(gpio_config(&io_conf), false, "Config GPIO(%d) failed", static_cast<int>(gpio));
+        // Level triggered, so the same configuration also works as a light sleep wakeup source
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            gpio_wakeup_enable(gpio, context.gpio.active_low ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL), false,
+            "Enable GPIO(%d) wakeup failed", static_cast<int>(gpio)
+        );
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            gpio_isr_handler_add(gpio, onWakeupGpioIsr, &context), false, "Add GPIO(%d) ISR handler failed",
+            static_cast<int>(gpio)
+        );
+        // `gpio_wakeup_enable()` only sets the interrupt type, the interrupt itself is enabled here
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            gpio_intr_enable(gpio), false, "Enable GPIO(%d) interrupt failed", static_cast<int>(gpio)
+        );
+    }
+    ESP_UTILS_CHECK_ERROR_RETURN(esp_sleep_enable_gpio_wakeup(), false, "Enable GPIO wakeup failed");
+
+    return true;
+}
+
+void Power::deinitWakeupGpios()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    for (auto &context : _wakeup_gpio_contexts) {
+        if (context.gpio.gpio == GPIO_NUM_NC) {
+            continue;
+        }
+        if (context.release_timer != nullptr) {
+            esp_timer_stop(context.release_timer);
+            esp_timer_delete(context.release_timer);
+            context.release_timer = nullptr;
+        }
+        gpio_intr_disable(context.gpio.gpio);
+        gpio_isr_handler_remove(context.gpio.gpio);
+        gpio_wakeup_disable(context.gpio.gpio);
+    }
+    _wakeup_gpio_contexts.clear();
+}
+
+bool Power::sendEvent(const Event &event)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(_event_queue, false, "Not begun");
+    ESP_UTILS_CHECK_FALSE_RETURN(xQueueSend(_event_queue, &event, 0) == pdTRUE, false, "Event queue is full");
+
+    return true;
+}
+
+void Power::processEvent(const Event &event)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    auto state = _state.load();
+    switch (event.type) {
+    case EventType::Wakeup:
+        ESP_UTILS_LOGD("Wakeup from %s in state(%s)", getWakeupSourceName(event.source), getStateName(state));
+        if (_config.board.on_wakeup) {
+            _config.board.on_wakeup(event.source);
+        }
+        // The button toggles between awake and asleep, other sources only wake up
+        if ((event.source == WakeupSource::Button) && ((state == State::Active) || (state == State::Dim))) {
+            ESP_UTILS_CHECK_FALSE_EXIT(
+                applyState(State::LightSleep, event.timestamp_us, event.source), "Apply light sleep state failed"
+            );
+        } else if (state != State::Active) {
+            ESP_UTILS_CHECK_FALSE_EXIT(
+                applyState(State::Active, event.timestamp_us, event.source), "Apply active state failed"
+            );
+        }
+        rearmWakeupGpio(event.source);
+        break;
+    case EventType::RequestState:
+        ESP_UTILS_CHECK_FALSE_EXIT(
+            applyState(event.state, event.timestamp_us, event.source), "Apply state(%s) failed",
+            getStateName(event.state)
+        );
+        break;
+    default:
+        break;
+    }
+}
+
+bool Power::applyState(State state, int64_t wakeup_timestamp_us, WakeupSource source)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    auto last_state = _state.load();
+    if (state == last_state) {
+        return true;
+    }
+    ESP_UTILS_LOGI("State: %s -> %s", getStateName(last_state), getStateName(state));
+
+    auto &board = _config.board;
+    bool was_asleep = (last_state == State::LightSleep);
+    bool was_display_off = (last_state == State::DisplayOff) || was_asleep;
+
+    // Leave the light sleep first, so the following operations run at full speed
+    if (state != State::LightSleep) {
+        if ((_no_light_sleep_lock != nullptr) && !_is_no_light_sleep_locked) {
+            esp_pm_lock_acquire(_no_light_sleep_lock);
+            _is_no_light_sleep_locked = true;
+        }
+        if (was_asleep && board.set_gui_pause) {
+            ESP_UTILS_CHECK_FALSE_RETURN(board.set_gui_pause(false), false, "Resume GUI failed");
+        }
+    }
+    // Boost from the wakeup until the first frame is flushed, the rest of the time is up to the CPU governor
+    if (_cpu_freq_lock != nullptr) {
+        if (was_display_off && (state <= State::Dim) && !_is_cpu_freq_locked.exchange(true)) {
+            esp_pm_lock_acquire(_cpu_freq_lock);
+        } else if ((state >= State::DisplayOff) && _is_cpu_freq_locked.exchange(false)) {
+            esp_pm_lock_release(_cpu_freq_lock);
+        }
+    }
+
+    switch (state) {
+    case State::Active:
+    case State::Dim:
+        if (was_display_off) {
+            if (board.set_touch_sleep) {
+                ESP_UTILS_CHECK_FALSE_RETURN(board.set_touch_sleep(false), false, "Wake up touch failed");
+            }
+            if (board.set_panel_sleep) {
+                ESP_UTILS_CHECK_FALSE_RETURN(board.set_panel_sleep(false), false, "Wake up panel failed");
+            }
+            {
+                gui::LvLockGuard gui_guard;
+                // Make sure the next refresh flushes a complete frame, it is used to measure the wake latency
+                lv_obj_invalidate(lv_display_get_screen_active(_display));
+                lv_display_trigger_activity(_display);
+            }
+            _wake_start_us = wakeup_timestamp_us;
+            {
+                std::lock_guard<std::mutex> lock(_wake_latency_mutex);
+                _wake_latency.last_source = source;
+            }
+            _is_wake_latency_pending = true;
+        } else if (state == State::Active) {
+            gui::LvLockGuard gui_guard;
+            lv_display_trigger_activity(_display);
+        }
+        if (board.set_brightness) {
+            auto percent = (state == State::Active) ? _config.brightness.active_percent :
+                           _config.brightness.dim_percent;
+            ESP_UTILS_CHECK_FALSE_RETURN(board.set_brightness(percent), false, "Set brightness failed");
+        }
+        break;
+    case State::DisplayOff:
+    case State::LightSleep:
+        if (!was_display_off) {
+            if (board.set_panel_sleep) {
+                ESP_UTILS_CHECK_FALSE_RETURN(board.set_panel_sleep(true), false, "Sleep panel failed");
+            }
+            if (board.set_touch_sleep) {
+                ESP_UTILS_CHECK_FALSE_RETURN(board.set_touch_sleep(true), false, "Sleep touch failed");
+            }
+        }
+        if ((state == State::LightSleep) && !was_asleep) {
+            if (board.set_gui_pause) {
+                ESP_UTILS_CHECK_FALSE_RETURN(board.set_gui_pause(true), false, "Pause GUI failed");
+            }
+            // Nothing holds the CPU awake anymore, the automatic light sleep takes over when idle
+            if ((_no_light_sleep_lock != nullptr) && _is_no_light_sleep_locked) {
+                esp_pm_lock_release(_no_light_sleep_lock);
+                _is_no_light_sleep_locked = false;
+            }
+        }
+        break;
+    default:
+        ESP_UTILS_CHECK_FALSE_RETURN(false, false, "Invalid state(%d)", static_cast<int>(state));
+    }
+
+    _state = state;
+    _state_changed_signal(last_state, state);
+
+    return true;
+}
+
+TickType_t Power::getIdleWaitTicks()
+{
+    auto state = _state.load();
+    uint32_t timeout_ms = 0;
+    switch (state) {
+    case State::Active:
+        timeout_ms = _config.timeout.dim_ms;
+        break;
+    case State::Dim:
+        // Without the touch IRQ, poll for the touch activity so the screen lights up again without waiting
+        if (!hasWakeupSource(WakeupSource::Touch)) {
+            return pdMS_TO_TICKS(DIM_ACTIVITY_POLL_MS);
+        }
+        if (_is_always_on) {
+            return portMAX_DELAY;
+        }
+        timeout_ms = _config.timeout.display_off_ms;
+        break;
+    case State::DisplayOff:
+        timeout_ms = _config.timeout.light_sleep_ms;
+        break;
+    default:
+        return portMAX_DELAY;
+    }
+    if (_is_always_on && (state != State::Active)) {
+        return portMAX_DELAY;
+    }
+
+    uint32_t inactive_ms = 0;
+    {
+        gui::LvLockGuard gui_guard;
+        inactive_ms = lv_display_get_inactive_time(_display);
+    }
+    if (inactive_ms >= timeout_ms) {
+        return 0;
+    }
+
+    return pdMS_TO_TICKS(timeout_ms - inactive_ms);
+}
+
+void Power::processIdleTimeout()
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    uint32_t inactive_ms = 0;
+    {
+        gui::LvLockGuard gui_guard;
+        inactive_ms = lv_display_get_inactive_time(_display);
+    }
+
+    auto state = _state.load();
+    auto next_state = state;
+    if (inactive_ms >= _config.timeout.light_sleep_ms) {
+        next_state = State::LightSleep;
+    } else if (inactive_ms >= _config.timeout.display_off_ms) {
+        next_state = State::DisplayOff;
+    } else if (inactive_ms >= _config.timeout.dim_ms) {
+        next_state = State::Dim;
+    } else if (state == State::Dim) {
+        next_state = State::Active;
+    }
+
+    if (_is_always_on && (next_state > State::Dim)) {
+        next_state = State::Dim;
+    }
+
+    // Only move deeper on timeout, the way back is through the wakeup events
+    if ((next_state > state) || ((state == State::Dim) && (next_state == State::Active))) {
+        ESP_UTILS_CHECK_FALSE_EXIT(
+            applyState(next_state, esp_timer_get_time(), WakeupSource::None), "Apply state(%s) failed",
+            getStateName(next_state)
+        );
+    }
+}
+
+void Power::rearmWakeupGpio(WakeupSource source)
+{
+    ESP_UTILS_LOG_TRACE_GUARD_WITH_THIS();
+
+    for (auto &context : _wakeup_gpio_contexts) {
+        if ((context.gpio.source != source) || (context.gpio.gpio == GPIO_NUM_NC)) {
+            continue;
+        }
+        // Already waiting for the line to be released
+        if (esp_timer_is_active(context.release_timer)) {
+            continue;
+        }
+        // The level interrupt would fire again immediately while the line is held, so the timer re-arms it once
+        // released and the power task goes on with the other events
+        auto active_level = context.gpio.active_low ? 0 : 1;
+        if (gpio_get_level(context.gpio.gpio) != active_level) {
+            gpio_intr_enable(context.gpio.gpio);
+            continue;
+        }
+        context.release_wait_ms = 0;
+        if (esp_timer_start_periodic(context.release_timer, WAKEUP_GPIO_RELEASE_POLL_MS * 1000) != ESP_OK) {
+            ESP_UTILS_LOGE("Start GPIO(%d) release timer failed", static_cast<int>(context.gpio.gpio));
+        }
+    }
+}
+
+bool Power::hasWakeupSource(WakeupSource source) const
+{
+    return std::any_of(_wakeup_gpio_contexts.begin(), _wakeup_gpio_contexts.end(), [source](const auto & context) {
+        return context.gpio.source == source;
+    });
+}
+
+void IRAM_ATTR Power::onWakeupGpioIsr(void *arg)
+{
+    auto context = static_cast<WakeupGpioContext *>(arg);
+
+    // Re-enabled by the release timer once the line is released, see `rearmWakeupGpio()`
+    gpio_intr_disable(context->gpio.gpio);
+    context->power->notifyWakeupFromISR(context->gpio.source);
+}
+
+void Power::onWakeupGpioReleaseTimerCallback(void *arg)
+{
+    auto context = static_cast<WakeupGpioContext *>(arg);
+    ESP_UTILS_CHECK_NULL_EXIT(context, "Invalid context");
+
+    auto active_level = context->gpio.active_low ? 0 : 1;
+    context->release_wait_ms += WAKEUP_GPIO_RELEASE_POLL_MS;
+    if ((gpio_get_level(context->gpio.gpio) == active_level) &&
+            (context->release_wait_ms < WAKEUP_GPIO_RELEASE_TIMEOUT_MS)) {
+        return;
+    }
+    esp_timer_stop(context->release_timer);
+    gpio_intr_enable(context->gpio.gpio);
+}
+
+void Power::onDisplayRefreshReadyEventCallback(lv_event_t *event)
+{
+    auto power = static_cast<Power *>(lv_event_get_user_data(event));
+    ESP_UTILS_CHECK_NULL_EXIT(power, "Invalid power");
+
+    if (!power->_is_wake_latency_pending.exchange(false)) {
+        return;
+    }
+    if ((power->_cpu_freq_lock != nullptr) && power->_is_cpu_freq_locked.exchange(false)) {
+        esp_pm_lock_release(power->_cpu_freq_lock);
+    }
+
+    auto latency_us = static_cast<uint32_t>(esp_timer_get_time() - power->_wake_start_us);
+    {
+        std::lock_guard<std::mutex> lock(power->_wake_latency_mutex);
+        auto &latency = power->_wake_latency;
+        latency.min_us = (latency.count == 0) ? latency_us : std::min(latency.min_us, latency_us);
+        latency.max_us = std::max(latency.max_us, latency_us);
+        latency.last_us = latency_us;
+        latency.total_us += latency_us;
+        latency.count++;
+    }
+    ESP_UTILS_LOGI("Wake to first frame: %dus", static_cast<int>(latency_us));
+}
+
+} // namespace esp_brookesia::services
@@ -0,0 +1,190 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "driver/gpio.h"
+#include "esp_pm.h"
+#include "esp_timer.h"
+#include "lvgl.h"
+#include "boost/thread.hpp"
+#include "boost/signals2.hpp"
+
+namespace esp_brookesia::services {
+
+class Power {
+public:
+    enum class State : uint8_t {
+        Active = 0,
+        Dim,
+        DisplayOff,
+        LightSleep,
+        Max,
+    };
+
+    enum class WakeupSource : uint8_t {
+        None = 0,
+        Button,
+        Touch,
+        RtcAlarm,
+        Software,
+        Max,
+    };
+
+    struct WakeupGpio {
+        gpio_num_t gpio;        /*!< `GPIO_NUM_NC` if the IRQ is handled elsewhere and reported by `notifyWakeup()` */
+        WakeupSource source;
+        bool active_low;
+    };
+
+    /**
+     * @brief Board specific operations, all of them are optional and called from the power task
+     */
+    struct BoardCallbacks {
+        std::function<bool(int percent)> set_brightness;
+        std::function<bool(bool sleep)> set_panel_sleep;
+        std::function<bool(bool sleep)> set_touch_sleep;    /*!< The touch IC should keep asserting its IRQ when asleep */
+        std::function<bool(bool pause)> set_gui_pause;
+        std::function<void(WakeupSource source)> on_wakeup; /*!< e.g. clear the RTC alarm flag */
+    };
+
+    struct Config {
+        struct {
+            uint32_t dim_ms;
+            uint32_t display_off_ms;
+            uint32_t light_sleep_ms;
+        } timeout;
+        struct {
+            int active_percent;
+            int dim_percent;
+        } brightness;
+        struct {
+            int max_freq_mhz;
+            int min_freq_mhz;
+        } cpu;
+        std::vector<WakeupGpio> wakeup_gpios;
+        BoardCallbacks board;
+    };
+
+    struct WakeLatency {
+        uint32_t count;
+        uint32_t last_us;
+        uint32_t min_us;
+        uint32_t max_us;
+        uint64_t total_us;
+        WakeupSource last_source;
+    };
+
+    using StateChangedSignal = boost::signals2::signal<void(State from, State to)>;
+
+    Power(const Power &) = delete;
+    Power(Power &&) = delete;
+    Power &operator=(const Power &) = delete;
+    Power &operator=(Power &&) = delete;
+
+    bool begin(const Config &config, lv_display_t *display);
+    bool del();
+
+    bool requestState(State state);
+    /**
+     * @brief Keep the display on (at most dimmed) when idle, e.g. for an always-on watchface. The button and
+     *        `requestState()` still work as usual
+     */
+    bool setAlwaysOn(bool enable);
+    bool notifyWakeup(WakeupSource source);
+    void notifyWakeupFromISR(WakeupSource source);
+
+    State getState() const
+    {
+        return _state.load();
+    }
+    bool isAlwaysOn() const
+    {
+        return _is_always_on.load();
+    }
+    WakeLatency getWakeLatency();
+    void dumpWakeLatency();
+
+    boost::signals2::connection connectStateChangedSignal(StateChangedSignal::slot_type slot);
+
+    static const char *getStateName(State state);
+    static const char *getWakeupSourceName(WakeupSource source);
+
+    static Power &requestInstance()
+    {
+        static Power instance;
+        return instance;
+    }
+
+private:
+    enum class EventType : uint8_t {
+        Wakeup,
+        RequestState,
+        Update,
+        Exit,
+    };
+
+    struct Event {
+        EventType type;
+        State state;
+        WakeupSource source;
+        int64_t timestamp_us;
+    };
+
+    struct WakeupGpioContext {
+        Power *power;
+        WakeupGpio gpio;
+        esp_timer_handle_t release_timer = nullptr;  /*!< Polls the line until it is released to re-arm it */
+        uint32_t release_wait_ms = 0;
+    };
+
+    Power() = default;
+    ~Power();
+
+    bool initPowerManagement();
+    bool initWakeupGpios();
+    void deinitWakeupGpios();
+    bool sendEvent(const Event &event);
+    void processEvent(const Event &event);
+    bool applyState(State state, int64_t wakeup_timestamp_us, WakeupSource source);
+    TickType_t getIdleWaitTicks();
+    void processIdleTimeout();
+    void rearmWakeupGpio(WakeupSource source);
+    bool hasWakeupSource(WakeupSource source) const;
+
+    static void onWakeupGpioIsr(void *arg);
+    static void onWakeupGpioReleaseTimerCallback(void *arg);
+    static void onDisplayRefreshReadyEventCallback(lv_event_t *event);
+
+    bool _is_begun = false;
+    Config _config = {};
+    lv_display_t *_display = nullptr;
+    std::atomic<State> _state = State::Active;
+    std::atomic<bool> _is_always_on = false;
+
+    QueueHandle_t _event_queue = nullptr;
+    boost::thread _event_thread;
+    std::vector<WakeupGpioContext> _wakeup_gpio_contexts;
+
+    esp_pm_lock_handle_t _cpu_freq_lock = nullptr;
+    esp_pm_lock_handle_t _no_light_sleep_lock = nullptr;
+    std::atomic<bool> _is_cpu_freq_locked = false;
+    bool _is_no_light_sleep_locked = false;
+
+    std::atomic<bool> _is_wake_latency_pending = false;
+    int64_t _wake_start_us = 0;
+    std::mutex _wake_latency_mutex;
+    WakeLatency _wake_latency = {};
+
+    StateChangedSignal _state_changed_signal;
+};
+
+} // namespace esp_brookesia::services
@@ -13,8 +13,6 @@
 #include "esp_brookesia_base_context.hpp"
 #include "esp_brookesia_base_app.hpp"
 
-#define RESOURCE_LOOP_COUNT_MAX     (1000)
-
 #define LV_ANIM_LL_DEFAULT()        (LV_GLOBAL_DEFAULT()->anim_state.anim_ll)
 
 using namespace std;
@@ -102,7 +100,6 @@ bool App::startRecordResource(void)
 bool App::endRecordResource(void)
 {
     bool ret = true;
-    uint32_t resource_loop_count = 0;
     lv_display_t *disp = nullptr;
     lv_obj_t *screen = nullptr;
     lv_timer_t *timer_node = nullptr;
@@ -121,85 +118,70 @@ bool App::endRecordResource(void)
     ESP_UTILS_CHECK_NULL_RETURN(disp, false, "Invalid display");
 
     // Screen
-    resource_loop_count = 0;
-    for (int i = _resource_head_screen_index + 1; (i < (int)disp->screen_cnt) &&
-            (resource_loop_count++ <  RESOURCE_LOOP_COUNT_MAX); i++) {
+    for (int i = _resource_head_screen_index + 1; i < (int)disp->screen_cnt; i++) {
         screen = (lv_obj_t *)disp->screens[i];
         // Record or update the record information of the screen
-        _resource_screens_class_parent_map[screen] = {screen->class_p, (lv_obj_t *)screen->parent};
-        if (find(_resource_screens.begin(), _resource_screens.end(), screen) == _resource_screens.end()) {
-            // Only record the newest timer
-            _resource_screens.push_back(screen);
-            _resource_screen_count++;
-            // Move screens to visual area when loaded only if needed
-            if (_active_config.flags.enable_resize_visual_area) {
-                lv_obj_set_pos(screen, visual_area.x1, visual_area.y1);
-                lv_obj_add_event_cb(screen, onResizeScreenLoadedEventCallback, LV_EVENT_SCREEN_LOAD_START, this);
-                // Avoid resetting the position of the previous screen when using animations with `lv_scr_load_anim()`
-                lv_obj_add_event_cb(screen, onResizeScreenLoadedEventCallback, LV_EVENT_SCREEN_UNLOAD_START, this);
-            }
-        } else {
+        auto [screen_it, is_new] = _resource_screens.insert_or_assign(
+                                       screen, std::make_pair(screen->class_p, (lv_obj_t *)screen->parent)
+                                   );
+        if (!is_new) {
             ESP_UTILS_LOGD("Screen(@0x%p) is already recorded", screen);
+            continue;
+        }
+        // Move screens to visual area when loaded only if needed
+        if (_active_config.flags.enable_resize_visual_area) {
+            lv_obj_set_pos(screen, visual_area.x1, visual_area.y1);
+            lv_obj_add_event_cb(screen, onResizeScreenLoadedEventCallback, LV_EVENT_SCREEN_LOAD_START, this);
+            // Avoid resetting the position of the previous screen when using animations with `lv_scr_load_anim()`
+            lv_obj_add_event_cb(screen, onResizeScreenLoadedEventCallback, LV_EVENT_SCREEN_UNLOAD_START, this);
         }
     }
-    if ((_resource_head_screen_index >= (int)disp->screen_cnt) || (resource_loop_count >= RESOURCE_LOOP_COUNT_MAX)) {
+    if (_resource_head_screen_index >= (int)disp->screen_cnt) {
         _resource_screens.clear();
-        _resource_screens_class_parent_map.clear();
-        _resource_screen_count = 0;
         ret = false;
         ESP_UTILS_LOGE("record screen fail");
     } else {
-        ESP_UTILS_LOGD("record screen(%d): ", _resource_screen_count);
+        ESP_UTILS_LOGD("record screen(%d): ", (int)_resource_screens.size());
     }
 
-    // Timer
-    resource_loop_count = 0;
+    // Timer, the new ones are at the head of the list
     timer_node = lv_timer_get_next(nullptr);
-    while ((timer_node != nullptr) && (timer_node != _resource_head_timer) &&
-            (resource_loop_count++ < RESOURCE_LOOP_COUNT_MAX)) {
+    while ((timer_node != nullptr) && (timer_node != _resource_head_timer)) {
         // Record or update the record information of the timer
-        _resource_timers_cb_usr_map[timer_node] = {(lv_timer_cb_t)timer_node->timer_cb, timer_node->user_data};
-        if (find(_resource_timers.begin(), _resource_timers.end(), timer_node) == _resource_timers.end()) {
-            // Only record the newest timer
-            _resource_timers.push_back(timer_node);
-            _resource_timer_count++;
-        } else {
+        auto [timer_it, is_new] = _resource_timers.insert_or_assign(
+                                      timer_node,
+                                      std::make_pair((lv_timer_cb_t)timer_node->timer_cb, timer_node->user_data)
+                                  );
+        if (!is_new) {
             ESP_UTILS_LOGD("Timer(@0x%p) is already recorded", timer_node);
         }
         timer_node = lv_timer_get_next(timer_node);
     }
-    if (((timer_node == nullptr) && (_resource_head_timer != nullptr)) ||
-            (resource_loop_count >= RESOURCE_LOOP_COUNT_MAX)) {
+    if ((timer_node == nullptr) && (_resource_head_timer != nullptr)) {
         _resource_timers.clear();
-        _resource_timers_cb_usr_map.clear();
-        _resource_timer_count = 0;
         ret = false;
         ESP_UTILS_LOGE("record timer fail");
     } else {
-        ESP_UTILS_LOGD("record timer(%d): ", _resource_timer_count);
+        ESP_UTILS_LOGD("record timer(%d): ", (int)_resource_timers.size());
     }
 
-    // Animation
+    // Animation, the new ones are at the head of the list
     anim_node = (lv_anim_t *)_lv_ll_get_head(&LV_ANIM_LL_DEFAULT());
     while ((anim_node != nullptr) && (anim_node != _resource_head_anim)) {
         // Record or update the record information of the animation
-        _resource_anims_var_exec_map[anim_node] = {anim_node->var, anim_node->exec_cb};
-        if (find(_resource_anims.begin(), _resource_anims.end(), anim_node) == _resource_anims.end()) {
-            // Only record the newest timer
-            _resource_anims.push_back(anim_node);
-            _resource_anim_count++;
-        } else {
+        auto [anim_it, is_new] = _resource_anims.insert_or_assign(
+                                     anim_node, std::make_pair(anim_node->var, anim_node->exec_cb)
+                                 );
+        if (!is_new) {
             ESP_UTILS_LOGD("Animation(@0x%p) is already recorded", anim_node);
         }
         anim_node = (lv_anim_t *)_lv_ll_get_next(&LV_ANIM_LL_DEFAULT(), anim_node);
     }
     if ((anim_node == nullptr) && (_resource_head_anim != nullptr)) {
         _resource_anims.clear();
-        _resource_anims_var_exec_map.clear();
-        _resource_anim_count = 0;
         ESP_UTILS_LOGE("record animation fail");
     } else {
-        ESP_UTILS_LOGD("record animation(%d): ", _resource_anim_count);
+        ESP_UTILS_LOGD("record animation(%d): ", (int)_resource_anims.size());
     }
 
     if (_active_config.flags.enable_resize_visual_area) {
@@ -217,126 +199,94 @@ bool App::cleanRecordResource(void)
     ESP_UTILS_CHECK_FALSE_RETURN(checkInitialized(), false, "Not initialized");
     ESP_UTILS_LOGD("App(%s: %d) clean resource", getName(), _id);
 
-    bool ret = true;
-    bool do_clean = false;
-    int resource_loop_count = 0;
+    int resource_record_count = 0;
     int resource_clean_count = 0;
     lv_display_t *disp = nullptr;
-    lv_obj_t *screen_node = nullptr;
     lv_timer_t *timer_node = nullptr;
     lv_anim_t *anim_node = nullptr;
 
     disp = _system_context->getDisplayDevice();
     ESP_UTILS_CHECK_NULL_RETURN(disp, false, "Invalid display");
 
-    // Screen
-    resource_loop_count = 0;
+    // Screen. Deleting a screen only moves the next ones in the array, so it's walked backwards in a single pass. It's
+    // walked again only if the delete event of a screen has deleted other screens
+    resource_record_count = _resource_screens.size();
     resource_clean_count = 0;
-    for (int i = 0; (i < (int)disp->screen_cnt) && (resource_loop_count++ <  RESOURCE_LOOP_COUNT_MAX);) {
-        do_clean = false;
-        screen_node = (lv_obj_t *)disp->screens[i];
-        auto screen_it = find(_resource_screens.begin(), _resource_screens.end(), screen_node);
-        if (screen_it != _resource_screens.end()) {
-            auto screen_map_it = _resource_screens_class_parent_map.find(screen_node);
-            if (screen_map_it == _resource_screens_class_parent_map.end()) {
-                ESP_UTILS_LOGE("Screen class parent map not found");
-            } else {
-                if ((screen_node->class_p == screen_map_it->second.first) &&
-                        (screen_node->parent == screen_map_it->second.second)) {
-                    lv_obj_del(screen_node);
-                    do_clean = true;
-                    resource_clean_count++;
-                } else {
-                    ESP_UTILS_LOGD("Screen(@0x%p) information is not matched, skip", screen_node);
-                }
-                _resource_screens.erase(screen_it);
-                _resource_screens_class_parent_map.erase(screen_map_it);
+    for (bool is_cascaded = true; is_cascaded && !_resource_screens.empty();) {
+        is_cascaded = false;
+        for (uint32_t i = disp->screen_cnt; (i > 0) && !_resource_screens.empty();) {
+            lv_obj_t *screen_node = disp->screens[--i];
+            auto screen_it = _resource_screens.find(screen_node);
+            if (screen_it == _resource_screens.end()) {
+                continue;
+            }
+            bool is_matched = (screen_node->class_p == screen_it->second.first) &&
+                              (screen_node->parent == screen_it->second.second);
+            _resource_screens.erase(screen_it);
+            if (!is_matched) {
+                ESP_UTILS_LOGD("Screen(@0x%p) information is not matched, skip", screen_node);
+                continue;
+            }
+
+            uint32_t screen_cnt = disp->screen_cnt;
+            lv_obj_del(screen_node);
+            resource_clean_count++;
+            if (screen_cnt - disp->screen_cnt > 1) {
+                is_cascaded = true;
+                i = std::min(i, disp->screen_cnt);
             }
         }
-        i = do_clean ? 0 : i + 1;
-    }
-    if (resource_loop_count >= RESOURCE_LOOP_COUNT_MAX) {
-        ret = false;
-        ESP_UTILS_LOGE("Clean screen loop count exceed max");
-    } else {
-        ESP_UTILS_LOGD("Clean screen(%d), miss(%d): ", resource_clean_count, (int)(_resource_screen_count - resource_clean_count));
     }
+    ESP_UTILS_LOGD("Clean screen(%d), miss(%d): ", resource_clean_count, resource_record_count - resource_clean_count);
 
-    // Timer
-    resource_loop_count = 0;
+    // Timer, deleting a timer doesn't change the others
+    resource_record_count = _resource_timers.size();
     resource_clean_count = 0;
     timer_node = lv_timer_get_next(nullptr);
-    while ((timer_node != nullptr) && (_resource_timers.size() > 0) &&
-            (resource_loop_count++ < RESOURCE_LOOP_COUNT_MAX)) {
-        do_clean = false;
-        auto timer_it = find(_resource_timers.begin(), _resource_timers.end(), timer_node);
+    while ((timer_node != nullptr) && !_resource_timers.empty()) {
+        lv_timer_t *timer_next = lv_timer_get_next(timer_node);
+        auto timer_it = _resource_timers.find(timer_node);
         if (timer_it != _resource_timers.end()) {
-            auto timer_map_it = _resource_timers_cb_usr_map.find(timer_node);
-            if (timer_map_it == _resource_timers_cb_usr_map.end()) {
-                ESP_UTILS_LOGE("Timer cb usr map not found");
-            } else  {
-                if ((timer_map_it->second.first == timer_node->timer_cb) &&
-                        (timer_map_it->second.second == timer_node->user_data)) {
-                    lv_timer_del(timer_node);
-                    do_clean = true;
-                    resource_clean_count++;
-                } else {
-                    ESP_UTILS_LOGD("Timer(@0x%p) information is not matched, skip", timer_node);
-                }
-                _resource_timers.erase(timer_it);
-                _resource_timers_cb_usr_map.erase(timer_map_it);
+            if ((timer_it->second.first == timer_node->timer_cb) &&
+                    (timer_it->second.second == timer_node->user_data)) {
+                lv_timer_del(timer_node);
+                resource_clean_count++;
+            } else {
+                ESP_UTILS_LOGD("Timer(@0x%p) information is not matched, skip", timer_node);
             }
+            _resource_timers.erase(timer_it);
         }
-        timer_node = do_clean ? lv_timer_get_next(nullptr) : lv_timer_get_next(timer_node);
-    }
-    if (resource_loop_count >= RESOURCE_LOOP_COUNT_MAX) {
-        ret = false;
-        ESP_UTILS_LOGE("Clean timer loop count exceed max");
-    } else {
-        ESP_UTILS_LOGD("Clean timer(%d), miss(%d): ", resource_clean_count, _resource_timer_count - resource_clean_count);
+        timer_node = timer_next;
     }
+    ESP_UTILS_LOGD("Clean timer(%d), miss(%d): ", resource_clean_count, resource_record_count - resource_clean_count);
 
-    // Animation
-    resource_loop_count = 0;
+    // Animation. Their deleted callbacks may change the list, so the matched animations are only tagged with
+    // `onCleanResourceAnimExecCallback()` here, then deleted by a single `lv_anim_del()`. It restarts from the head of
+    // the list after each deletion, where it finds the next one, as the recorded animations are the newest
+    resource_record_count = _resource_anims.size();
     resource_clean_count = 0;
     anim_node = (lv_anim_t *)_lv_ll_get_head(&LV_ANIM_LL_DEFAULT());
-    while ((anim_node != nullptr) && (_resource_anims.size() > 0) &&
-            (resource_loop_count++ < RESOURCE_LOOP_COUNT_MAX)) {
-        do_clean = false;
-        auto anim_it = find(_resource_anims.begin(), _resource_anims.end(), anim_node);
+    while ((anim_node != nullptr) && !_resource_anims.empty()) {
+        auto anim_it = _resource_anims.find(anim_node);
         if (anim_it != _resource_anims.end()) {
-            auto anim_map_it = _resource_anims_var_exec_map.find(anim_node);
-            if (anim_map_it == _resource_anims_var_exec_map.end()) {
-                ESP_UTILS_LOGE("Animation var exec map not found");
-            } else  {
-                if ((anim_map_it->second.first == anim_node->var) &&
-                        (anim_map_it->second.second == anim_node->exec_cb)) {
-                    if (lv_anim_del(anim_node->var, anim_node->exec_cb)) {
-                        do_clean = true;
-                        resource_clean_count++;
-                    } else {
-                        ESP_UTILS_LOGE("Delete animation failed");
-                    }
-                } else {
-                    ESP_UTILS_LOGD("Anim(@0x%p) information is not matched, skip", anim_node);
-                }
-                _resource_anims.erase(anim_it);
-                _resource_anims_var_exec_map.erase(anim_map_it);
+            if ((anim_it->second.first == anim_node->var) && (anim_it->second.second == anim_node->exec_cb)) {
+                anim_node->exec_cb = onCleanResourceAnimExecCallback;
+                resource_clean_count++;
+            } else {
+                ESP_UTILS_LOGD("Anim(@0x%p) information is not matched, skip", anim_node);
             }
+            _resource_anims.erase(anim_it);
         }
-        anim_node = do_clean ? (lv_anim_t *)_lv_ll_get_head(&LV_ANIM_LL_DEFAULT()) :
-                    (lv_anim_t *)_lv_ll_get_next(&LV_ANIM_LL_DEFAULT(), anim_node);
+        anim_node = (lv_anim_t *)_lv_ll_get_next(&LV_ANIM_LL_DEFAULT(), anim_node);
     }
-    if (resource_loop_count >= RESOURCE_LOOP_COUNT_MAX) {
-        ret = false;
-        ESP_UTILS_LOGE("Clean timer loop count exceed max");
-    } else {
-        ESP_UTILS_LOGD("Clean anim(%d), miss(%d): ", resource_clean_count, _resource_anim_count - resource_clean_count);
+    if ((resource_clean_count > 0) && !lv_anim_del(nullptr, onCleanResourceAnimExecCallback)) {
+        ESP_UTILS_LOGE("Delete animations failed");
     }
+    ESP_UTILS_LOGD("Clean anim(%d), miss(%d): ", resource_clean_count, resource_record_count - resource_clean_count);
 
     ESP_UTILS_CHECK_FALSE_RETURN(resetRecordResource(), false, "Reset record resource failed");
 
-    return ret;
+    return true;
 }
 
 bool App::processInstall(Context *system_context, int id)
@@ -380,10 +330,7 @@ bool App::processUninstall(void)
     _flags = {};
     _display_style = {};
     _app_style = {};
-    _resource_timer_count = 0;
-    _resource_anim_count = 0;
     _resource_head_screen_index = 0;
-    _resource_screen_count = 0;
     if (_active_config.flags.enable_default_screen && checkLvObjIsValid(_active_screen)) {
         lv_obj_del(_active_screen);
     }
@@ -663,20 +610,9 @@ bool App::resetRecordResource(void)
     ESP_UTILS_CHECK_FALSE_RETURN(checkInitialized(), false, "Not initialized");
     ESP_UTILS_LOGD("App(%s: %d) reset record resource", getName(), _id);
 
-    // Screen
-    _resource_screen_count = 0;
     _resource_screens.clear();
-    _resource_screens_class_parent_map.clear();
-
-    // Timer
-    _resource_timer_count = 0;
     _resource_timers.clear();
-    _resource_timers_cb_usr_map.clear();
-
-    // Animation
-    _resource_anim_count = 0;
     _resource_anims.clear();
-    _resource_anims_var_exec_map.clear();
 
     _flags.is_resource_recording = false;
 
@@ -774,6 +710,11 @@ bool App::loadAppTheme(void)
     return true;
 }
 
+void App::onCleanResourceAnimExecCallback(void *var, int32_t value)
+{
+    // Only tags the animations to clean
+}
+
 void App::onCleanResourceEventCallback(lv_event_t *event)
 {
     App *app = nullptr;
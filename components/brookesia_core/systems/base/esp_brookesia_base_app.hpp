@@ -8,6 +8,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include "lvgl.h"
 #include "lvgl/esp_brookesia_lv_helper.hpp"
 #include "more/esp_utils_plugin_registry.hpp"
@@ -429,6 +430,7 @@ private:
     // bool delTempScreen(void);
 
     static void onCleanResourceEventCallback(lv_event_t *e);
+    static void onCleanResourceAnimExecCallback(void *var, int32_t value);
     static void onResizeScreenLoadedEventCallback(lv_event_t *e);
 
     // Core
@@ -453,22 +455,16 @@ private:
         lv_theme_t *theme;
     } _app_style = {};
     // Resources
-    int _resource_timer_count = 0;
-    int _resource_anim_count = 0;
     int _resource_head_screen_index = 0;
-    int _resource_screen_count = 0;
     lv_obj_t *_last_screen = nullptr;
     lv_obj_t *_active_screen = nullptr;
     // lv_obj_t *_temp_screen;
     lv_timer_t *_resource_head_timer = nullptr;
     lv_anim_t *_resource_head_anim = nullptr;
-    std::list <lv_obj_t *> _resource_screens = {};
-    std::list <lv_timer_t *> _resource_timers = {};
-    std::list <lv_anim_t *> _resource_anims = {};
-    // These maps are meant to store additional information about the recorded resources to prevent accidental cleanup
-    std::map<lv_obj_t *, std::pair<const lv_obj_class_t *, lv_obj_t *>> _resource_screens_class_parent_map;
-    std::map<lv_timer_t *, std::pair<lv_timer_cb_t, void *>> _resource_timers_cb_usr_map;
-    std::map<lv_anim_t *, std::pair<void *, lv_anim_exec_xcb_t>> _resource_anims_var_exec_map;
+    // The recorded resources, with additional information to prevent the cleanup of another resource at their address
+    std::unordered_map<lv_obj_t *, std::pair<const lv_obj_class_t *, lv_obj_t *>> _resource_screens;
+    std::unordered_map<lv_timer_t *, std::pair<lv_timer_cb_t, void *>> _resource_timers;
+    std::unordered_map<lv_anim_t *, std::pair<void *, lv_anim_exec_xcb_t>> _resource_anims;
 };
 
 }
@@ -4,12 +4,14 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <cstring>
+#include "esp_timer.h"
 #include "esp_brookesia_systems_internal.h"
 #if !ESP_BROOKESIA_BASE_CORE_ENABLE_DEBUG_LOG
 #   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
 #endif
 #include "private/esp_brookesia_base_utils.hpp"
 #include "gui/lvgl/esp_brookesia_lv_lock.hpp"
+#include "gui/lvgl/esp_brookesia_lv_scheduler.hpp"
 #include "squareline/ui_comp/ui_comp.h"
 #include "esp_brookesia_base_context.hpp"
 
@@ -103,6 +105,27 @@ bool Context::sendDataUpdateEvent(void *param)
     return true;
 }
 
+bool Context::postDataUpdateEvent(uint32_t dirty_sections)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(checkCoreInitialized(), false, "Context is not initialized");
+
+    ESP_UTILS_LOGD("Post data update event(sections: 0x%x)", static_cast<int>(dirty_sections));
+    _data_update_dirty_sections |= (dirty_sections & DATA_SECTIONS_ALL);
+    ESP_UTILS_CHECK_FALSE_RETURN(_event.postEvent(this, Event::ID::STYLESHEET), false, "Post event failed");
+
+    return true;
+}
+
+bool Context::checkDataUpdateSection(lv_event_t *event, DataSection section)
+{
+    auto data = static_cast<const DataUpdateEventData *>(lv_event_get_param(event));
+    if (data == nullptr) {
+        return true;
+    }
+
+    return (data->dirty_sections & (getDataSectionBit(DataSection::CORE) | getDataSectionBit(section))) != 0;
+}
+
 bool Context::registerNavigateEventCallback(lv_event_cb_t callback, void *user_data)
 {
     ESP_UTILS_CHECK_NULL_RETURN(callback, false, "Invalid callback function");
@@ -214,12 +237,27 @@ bool Context::begin(void)
     ESP_UTILS_CHECK_FALSE_RETURN(esp_brookesia_core_utils_check_event_code_valid(app_event_code), false,
                                  "Create app event code failed");
 
+    // Check if the display is set. If not, use the default display
+    if (_display_device == nullptr) {
+        ESP_UTILS_LOGW("Display is not set, use default display");
+        _display_device = lv_disp_get_default();
+        ESP_UTILS_CHECK_NULL_RETURN(_display_device, false, "Display device is not initialized");
+    }
+
     // Save data
     _event_obj = event_obj;
     _data_update_event_code = data_update_event_code;
     _navigate_event_code = navigate_event_code;
     _app_event_code = app_event_code;
 
+    // Send the posted events once per frame, before the layout is updated. From here `del()` undoes everything
+    ESP_UTILS_CHECK_FALSE_GOTO(
+        _event.registerEvent(this, onDataUpdatePostedEventHandler, Event::ID::STYLESHEET, this), err,
+        "Register data update event handler failed"
+    );
+    _event.setPostedCallback(onEventPostedCallback, this);
+    lv_display_add_event_cb(_display_device, onDisplayRefreshStartEventCallback, LV_EVENT_REFR_START, this);
+
     // Initialize cores
     ESP_UTILS_CHECK_FALSE_GOTO(_display.begin(), err, "Begin core display failed");
     ESP_UTILS_CHECK_FALSE_GOTO(_manager.begin(), err, "Begin core manager failed");
@@ -256,6 +294,12 @@ bool Context::del(void)
         ret = false;
     }
 
+    if (_display_device != nullptr) {
+        lv_display_remove_event_cb_with_user_data(_display_device, onDisplayRefreshStartEventCallback, this);
+    }
+    _event.setPostedCallback(nullptr);
+    _event.unregisterEvent(this, onDataUpdatePostedEventHandler, Event::ID::STYLESHEET);
+
     _display_device = nullptr;
     _touch_device = nullptr;
     _free_event_code = _LV_EVENT_LAST;
@@ -263,6 +307,7 @@ bool Context::del(void)
     _data_update_event_code = _LV_EVENT_LAST;
     _navigate_event_code = _LV_EVENT_LAST;
     _app_event_code = _LV_EVENT_LAST;
+    _data_update_dirty_sections = 0;
 
     return ret;
 }
@@ -297,6 +342,10 @@ void Context::onCoreDataUpdateEventCallback(lv_event_t *event)
     core = (Context *)lv_event_get_user_data(event);
     ESP_UTILS_CHECK_NULL_EXIT(core, "Invalid core object");
 
+    if (!checkDataUpdateSection(event, DataSection::CORE)) {
+        return;
+    }
+
     ESP_UTILS_CHECK_FALSE_EXIT(core->_display.updateByNewData(), "Context display update failed");
 }
 
@@ -331,4 +380,46 @@ void Context::onCoreNavigateEventCallback(lv_event_t *event)
     }
 }
 
+void Context::onDisplayRefreshStartEventCallback(lv_event_t *event)
+{
+    ESP_UTILS_CHECK_NULL_EXIT(event, "Invalid event object");
+
+    Context *core = static_cast<Context *>(lv_event_get_user_data(event));
+    ESP_UTILS_CHECK_NULL_EXIT(core, "Invalid core object");
+
+    ESP_UTILS_CHECK_FALSE_EXIT(core->_event.flushPostedEvents(), "Flush posted events failed");
+}
+
+void Context::onEventPostedCallback(void *user_data)
+{
+    Context *core = static_cast<Context *>(user_data);
+    ESP_UTILS_CHECK_NULL_EXIT(core, "Invalid core object");
+
+    // The refresh timer is parked while the screen is idle, so wake it up to flush the posted events
+    LvScheduler::getInstance().requestRefresh(core->_display_device);
+}
+
+bool Context::onDataUpdatePostedEventHandler(const Event::HandlerData &data)
+{
+    Context *core = static_cast<Context *>(data.user_data);
+    ESP_UTILS_CHECK_NULL_RETURN(core, false, "Invalid core object");
+
+    // All the sections marked since the last frame are sent at once
+    if (core->_data_update_dirty_sections == 0) {
+        return true;
+    }
+    DataUpdateEventData update_data = {
+        .dirty_sections = core->_data_update_dirty_sections,
+    };
+    core->_data_update_dirty_sections = 0;
+
+    int64_t start_us = esp_timer_get_time();
+    ESP_UTILS_CHECK_FALSE_RETURN(core->sendDataUpdateEvent(&update_data), false, "Send data update event failed");
+    core->_data_update_us = static_cast<uint32_t>(esp_timer_get_time() - start_us);
+    ESP_UTILS_LOGD("Data update(sections: 0x%x) took %dus", static_cast<int>(update_data.dirty_sections),
+                   static_cast<int>(core->_data_update_us));
+
+    return true;
+}
+
 } // namespace esp_brookesia::systems::base
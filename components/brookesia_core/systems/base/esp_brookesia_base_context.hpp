@@ -35,6 +35,33 @@ public:
         void *data;
     };
 
+    /**
+     * @brief Sections of the data which can be updated on their own. A change of `CORE` updates all of them, as the
+     *        widgets use the core fonts and styles
+     */
+    enum class DataSection : uint8_t {
+        CORE,
+        STATUS_BAR,
+        NAVIGATION_BAR,
+        APP_LAUNCHER,
+        RECENTS_SCREEN,
+        GESTURE,
+        MAX,
+    };
+
+    /**
+     * @brief Param of the data update event. The event sent without param updates all the sections
+     */
+    struct DataUpdateEventData {
+        uint32_t dirty_sections;
+    };
+
+    static constexpr uint32_t getDataSectionBit(DataSection section)
+    {
+        return (1UL << static_cast<int>(section));
+    }
+    static constexpr uint32_t DATA_SECTIONS_ALL = (1UL << static_cast<int>(DataSection::MAX)) - 1;
+
     Context(const Context &) = delete;
     Context(Context &&) = delete;
     Context &operator=(const Context &) = delete;
@@ -90,6 +117,22 @@ public:
     bool registerDateUpdateEventCallback(lv_event_cb_t callback, void *user_data);
     bool unregisterDateUpdateEventCallback(lv_event_cb_t callback, void *user_data);
     bool sendDataUpdateEvent(void *param = nullptr);
+    /**
+     * @brief Mark the sections as dirty, they are all updated by a single data update event at the start of the next
+     *        frame, so their layout is also updated once. That frame is requested even if the screen is idle
+     */
+    bool postDataUpdateEvent(uint32_t dirty_sections);
+    /**
+     * @brief Check if a section should be updated by the data update event
+     */
+    static bool checkDataUpdateSection(lv_event_t *event, DataSection section);
+    /**
+     * @brief Time spent by the handlers of the last posted data update event
+     */
+    uint32_t getDataUpdateTimeUs(void) const
+    {
+        return _data_update_us;
+    }
     lv_event_code_t getDataUpdateEventCode(void) const
     {
         return _data_update_event_code;
@@ -170,6 +213,9 @@ protected:
 private:
     static void onCoreDataUpdateEventCallback(lv_event_t *event);
     static void onCoreNavigateEventCallback(lv_event_t *event);
+    static void onDisplayRefreshStartEventCallback(lv_event_t *event);
+    static void onEventPostedCallback(void *user_data);
+    static bool onDataUpdatePostedEventHandler(const Event::HandlerData &data);
 
     // Event
     uint32_t _free_event_code;
@@ -177,6 +223,8 @@ private:
     lv_event_code_t _data_update_event_code;
     lv_event_code_t _navigate_event_code;
     lv_event_code_t _app_event_code;
+    uint32_t _data_update_dirty_sections = 0;
+    uint32_t _data_update_us = 0;
 };
 
 } // namespace esp_brookesia::systems::base
@@ -42,8 +42,12 @@ Event::ID operator++(Event::ID &id, int)
 void Event::reset(void)
 {
     _free_event_id = ID::CUSTOM;
-    _event_handlers.clear();
+    std::vector<Slot>().swap(_slots);
+    _used_slots_num = 0;
+    _handlers_num = 0;
+    _table_version++;
     _available_event_ids.clear();
+    _posted_events.clear();
 }
 
 bool Event::registerEvent(void *object, Handler handler, ID id, void *user_data)
@@ -52,8 +56,12 @@ bool Event::registerEvent(void *object, Handler handler, ID id, void *user_data)
                    handler, user_data);
     ESP_UTILS_CHECK_NULL_RETURN(handler, false, "Invalid handler");
 
-    auto &handlers_for_object = _event_handlers[object];
-    handlers_for_object[id].emplace_back(handler, user_data);
+    Slot *slot = insertSlot(object, id);
+    ESP_UTILS_CHECK_NULL_RETURN(slot, false, "Insert slot failed");
+
+    slot->addHandler({handler, user_data});
+    _handlers_num++;
+    _table_version++;
 
     return true;
 }
@@ -62,62 +70,126 @@ bool Event::sendEvent(void *object, ID id, void *param) const
 {
     ESP_UTILS_LOGD("Send event for object(0x%p) ID(%d) param(0x%p)", object, static_cast<int>(id), param);
 
-    auto object_it = _event_handlers.find(object);
-    if (object_it == _event_handlers.end()) {
+    const Slot *slot = findSlot(object, id);
+    if (slot == nullptr) {
         return true;
     }
 
-    auto &handlers_for_object = object_it->second;
-    auto handler_it = handlers_for_object.find(id);
-    if (handler_it == handlers_for_object.end()) {
-        return true;
-    }
-
-    HandlerData data = {};
     bool ret = true;
-    for (auto &handler_data_pair : handler_it->second) {
-        auto &handler = handler_data_pair.first;
-        auto &user_data = handler_data_pair.second;
-        if (handler == nullptr) {
+    uint32_t table_version = _table_version;
+    for (size_t i = 0; (slot != nullptr) && (i < slot->handlers_num); i++) {
+        // Copied, the handler may change the table
+        HandlerItem item = slot->getHandler(i);
+        HandlerItem next_item = (i + 1 < slot->handlers_num) ? slot->getHandler(i + 1) : HandlerItem{nullptr, nullptr};
+        if (item.handler == nullptr) {
             ESP_UTILS_LOGE("Handler is nullptr");
             continue;
         }
-        data = {id, object, param, user_data};
-        if (!handler(data)) {
+        if (!item.handler({id, object, param, item.user_data})) {
             ret = false;
             ESP_UTILS_LOGE("Do handler failed");
         }
+        if (table_version == _table_version) {
+            continue;
+        }
+
+        // The handlers before `i` may have been removed, so resume after the current one where it is now, or at
+        // the one which followed it if the current one was removed
+        table_version = _table_version;
+        slot = findSlot(object, id);
+        if (slot == nullptr) {
+            break;
+        }
+        size_t index = slot->findHandler(item, i);
+        if (index < slot->handlers_num) {
+            i = index;
+            continue;
+        }
+        if (next_item.handler == nullptr) {
+            break;
+        }
+        index = slot->findHandler(next_item, i);
+        if (index >= slot->handlers_num) {
+            break;
+        }
+        // Incremented back to `index` by the loop
+        i = index - 1;
     }
 
     return ret;
 }
 
-void Event::unregisterEvent(void *object)
+bool Event::postEvent(void *object, ID id, void *param)
 {
-    ESP_UTILS_LOGD("Unregister event for object(0x%p)", object);
+    for (auto &event : _posted_events) {
+        if ((event.object == object) && (event.id == id) && (event.param == param)) {
+            ESP_UTILS_LOGD("Coalesce event for object(0x%p) ID(%d) param(0x%p)", object, static_cast<int>(id), param);
+            return true;
+        }
+    }
 
-    auto object_it = _event_handlers.find(object);
-    if (object_it == _event_handlers.end()) {
-        return;
+    ESP_UTILS_LOGD("Post event for object(0x%p) ID(%d) param(0x%p)", object, static_cast<int>(id), param);
+    _posted_events.push_back({object, id, param});
+    if ((_posted_events.size() == 1) && (_posted_callback != nullptr)) {
+        _posted_callback(_posted_callback_user_data);
+    }
+
+    return true;
+}
+
+bool Event::flushPostedEvents(void)
+{
+    if (_posted_events.empty()) {
+        return true;
     }
 
+    // The events posted by the handlers are sent by the next flush. Both queues keep their capacity, so a steady
+    // stream of events doesn't allocate
+    _flushing_events.swap(_posted_events);
+    ESP_UTILS_LOGD("Flush %d posted events", static_cast<int>(_flushing_events.size()));
+
+    bool ret = true;
+    for (auto &event : _flushing_events) {
+        if (!sendEvent(event.object, event.id, event.param)) {
+            ret = false;
+        }
+    }
+    _flushing_events.clear();
+
+    return ret;
+}
+
+void Event::setPostedCallback(PostedCallback callback, void *user_data)
+{
+    _posted_callback = callback;
+    _posted_callback_user_data = user_data;
+}
+
+void Event::unregisterEvent(void *object)
+{
+    ESP_UTILS_LOGD("Unregister event for object(0x%p)", object);
+
     // Save event IDs to be removed
     std::unordered_set<ID> event_ids;
-    for (auto &id_handlers_pair : object_it->second) {
-        event_ids.insert(id_handlers_pair.first);
+    size_t handlers_count = _handlers_num;
+    eraseSlotsIf([&](Slot & slot) {
+        if (slot.object != object) {
+            return false;
+        }
+        event_ids.insert(slot.id);
+        return true;
+    });
+    if (handlers_count == _handlers_num) {
+        return;
     }
+    ESP_UTILS_LOGD("Remove %d event handlers", (int)(handlers_count - _handlers_num));
 
-    // Remove handlers for the given object
-    size_t handlers_count = getEventHandlersCount();
-    _event_handlers.erase(object_it);
-    ESP_UTILS_LOGD("Remove %d event handlers", (int)(handlers_count - getEventHandlersCount() ));
+    // The object may be gone, don't send its posted events
+    erasePostedEventsWithoutHandler();
 
     // Add removed event IDs to available event IDs
     for (const auto &id : event_ids) {
-        if (!checkUsedEventID(id)) {
-            ESP_UTILS_LOGD("Recycle event ID(%d)", static_cast<int>(id));
-            _available_event_ids.insert(id);
-        }
+        recycleEventID(id);
     }
 }
 
@@ -125,85 +197,58 @@ void Event::unregisterEvent(void *object, ID id)
 {
     ESP_UTILS_LOGD("Unregister event for object(0x%p) ID(%d)", object, static_cast<int>(id));
 
-    auto object_it = _event_handlers.find(object);
-    if (object_it == _event_handlers.end()) {
+    Slot *slot = findSlot(object, id);
+    if (slot == nullptr) {
         return;
     }
 
-    auto &handlers_for_object = object_it->second;
-    size_t handlers_count = getEventHandlersCount();
-    if (handlers_for_object.erase(id) == 0) {
-        return;
-    }
-    if (handlers_for_object.empty()) {
-        _event_handlers.erase(object_it);
-    }
-    ESP_UTILS_LOGD("Remove %d event handlers", (int)(handlers_count - getEventHandlersCount() ));
+    size_t handlers_count = _handlers_num;
+    eraseSlot(slot);
+    ESP_UTILS_LOGD("Remove %d event handlers", (int)(handlers_count - _handlers_num));
+    erasePostedEventsWithoutHandler();
 
     // Add removed event IDs to available event IDs
-    if (!checkUsedEventID(id)) {
-        ESP_UTILS_LOGD("Recycle event ID(%d)", static_cast<int>(id));
-        _available_event_ids.insert(id);
-    }
+    recycleEventID(id);
 }
 
 void Event::unregisterEvent(void *object, Handler handler, ID id)
 {
     ESP_UTILS_LOGD("Unregister event for object(0x%p) ID(%d) handler(0x%p)", object, static_cast<int>(id), handler);
 
-    auto object_it = _event_handlers.find(object);
-    if (object_it == _event_handlers.end()) {
+    Slot *slot = findSlot(object, id);
+    if (slot == nullptr) {
         return;
     }
 
-    auto &handlers_for_object = object_it->second;
-    auto handler_it = handlers_for_object.find(id);
-    if (handler_it == handlers_for_object.end()) {
-        return;
-    }
-
-    auto &handlers = handler_it->second;
-    auto it = std::remove_if(handlers.begin(), handlers.end(),
-    [&](const std::pair<Handler, void *> &pair) {
-        return handler == pair.first;
-    });
-    if (it == handlers.end()) {
+    size_t removed_num = slot->removeHandler(handler);
+    if (removed_num == 0) {
         return;
     }
-
-    size_t handlers_count = getEventHandlersCount();
-    handlers.erase(it, handlers.end());
-    if (handlers.empty()) {
-        handlers_for_object.erase(handler_it);
-    }
-    if (handlers_for_object.empty()) {
-        _event_handlers.erase(object_it);
+    _handlers_num -= removed_num;
+    _table_version++;
+    if (slot->isEmpty()) {
+        eraseSlot(slot);
+        erasePostedEventsWithoutHandler();
     }
-    ESP_UTILS_LOGD("Remove %d event handlers", (int)(handlers_count - getEventHandlersCount() ));
+    ESP_UTILS_LOGD("Remove %d event handlers", (int)removed_num);
 
     // Add removed event IDs to available event IDs
-    if (!checkUsedEventID(id)) {
-        _available_event_ids.insert(id);
-    }
+    recycleEventID(id);
 }
 
 void Event::unregisterEvent(ID id)
 {
     ESP_UTILS_LOGD("Unregister event for ID(%d)", static_cast<int>(id));
 
-    size_t handlers_count = getEventHandlersCount();
-    for (auto &object_handler_pair : _event_handlers) {
-        auto &handlers_for_object = object_handler_pair.second;
-        if (handlers_for_object.find(id) != handlers_for_object.end()) {
-            handlers_for_object.erase(id);
-        }
-    }
-    cleanEmptyHandlers();
-    ESP_UTILS_LOGD("Remove %d event handlers", (int)(handlers_count - getEventHandlersCount() ));
+    size_t handlers_count = _handlers_num;
+    eraseSlotsIf([&](Slot & slot) {
+        return (slot.id == id);
+    });
+    ESP_UTILS_LOGD("Remove %d event handlers", (int)(handlers_count - _handlers_num));
+    erasePostedEventsWithoutHandler();
 
     // Add removed event IDs to available event IDs
-    ESP_UTILS_LOGD("Recycle event ID(%d)", static_cast<int>(id));
-    _available_event_ids.insert(id);
+    recycleEventID(id);
 }
 
 void Event::unregisterEvent(Handler handler)
@@ -212,44 +257,26 @@ void Event::unregisterEvent(Handler handler)
 
     // Save event IDs to be removed
     std::unordered_set<ID> event_ids;
-    size_t handlers_count = getEventHandlersCount();
-    for (auto &object_handler_pair : _event_handlers) {
-        auto &handlers_for_object = object_handler_pair.second;
-        for (auto &id_handlers_pair : handlers_for_object) {
-            auto &handlers = id_handlers_pair.second;
-            auto it = std::remove_if(handlers.begin(), handlers.end(),
-            [&](const std::pair<Handler, void *> &pair) {
-                return handler == pair.first;
-            });
-            if (it != handlers.end()) {
-                event_ids.insert(id_handlers_pair.first);
-                handlers.erase(it, handlers.end());
-            }
+    size_t handlers_count = _handlers_num;
+    eraseSlotsIf([&](Slot & slot) {
+        size_t removed_num = slot.removeHandler(handler);
+        if (removed_num == 0) {
+            return false;
         }
-    }
-    cleanEmptyHandlers();
-    ESP_UTILS_LOGD("Remove %d event handlers", (int)(handlers_count - getEventHandlersCount() ));
+        _handlers_num -= removed_num;
+        _table_version++;
+        event_ids.insert(slot.id);
+        return slot.isEmpty();
+    });
+    ESP_UTILS_LOGD("Remove %d event handlers", (int)(handlers_count - _handlers_num));
+    erasePostedEventsWithoutHandler();
 
     // Add removed event IDs to available event IDs
     for (const auto &id : event_ids) {
-        if (!checkUsedEventID(id)) {
-            ESP_UTILS_LOGD("Recycle event ID(%d)", static_cast<int>(id));
-            _available_event_ids.insert(id);
-        }
+        recycleEventID(id);
     }
 }
 
-bool Event::checkUsedEventID(ID id) const
-{
-    for (auto &object_handler_pair : _event_handlers) {
-        auto &handlers_for_object = object_handler_pair.second;
-        if (handlers_for_object.find(id) != handlers_for_object.end()) {
-            return true;
-        }
-    }
-    return false;
-}
-
 Event::ID Event::getFreeEventID()
 {
     if (!_available_event_ids.empty()) {
@@ -262,35 +289,202 @@ Event::ID Event::getFreeEventID()
     return ++_free_event_id;
 }
 
-size_t Event::getEventHandlersCount(void) const
+void Event::Slot::addHandler(const HandlerItem &item)
 {
-    size_t count = 0;
-    for (auto &object_handler_pair : _event_handlers) {
-        for (auto &id_handlers_pair : object_handler_pair.second) {
-            count += id_handlers_pair.second.size();
+    if (handlers_num < SLOT_INLINE_HANDLERS_NUM) {
+        handlers[handlers_num] = item;
+    } else {
+        more_handlers.push_back(item);
+    }
+    handlers_num++;
+}
+
+size_t Event::Slot::removeHandler(Handler handler)
+{
+    // Keep the order of the other handlers
+    size_t kept_num = 0;
+    for (size_t i = 0; i < handlers_num; i++) {
+        HandlerItem item = getHandler(i);
+        if (item.handler == handler) {
+            continue;
         }
+        if (kept_num < SLOT_INLINE_HANDLERS_NUM) {
+            handlers[kept_num] = item;
+        } else {
+            more_handlers[kept_num - SLOT_INLINE_HANDLERS_NUM] = item;
+        }
+        kept_num++;
     }
 
-    return count;
+    size_t removed_num = handlers_num - kept_num;
+    handlers_num = kept_num;
+    more_handlers.resize((kept_num > SLOT_INLINE_HANDLERS_NUM) ? (kept_num - SLOT_INLINE_HANDLERS_NUM) : 0);
+
+    return removed_num;
 }
 
-void Event::cleanEmptyHandlers()
+size_t Event::Slot::findHandler(const HandlerItem &item, size_t index) const
 {
-    for (auto it = _event_handlers.begin(); it != _event_handlers.end(); ) {
-        auto &id_map = it->second;
-        for (auto id_it = id_map.begin(); id_it != id_map.end(); ) {
-            if (id_it->second.empty()) {
-                id_it = id_map.erase(id_it);
-            } else {
-                ++id_it;
-            }
+    if (handlers_num == 0) {
+        return handlers_num;
+    }
+    for (size_t i = std::min<size_t>(index, handlers_num - 1) + 1; i-- > 0; ) {
+        const HandlerItem &handler = getHandler(i);
+        if ((handler.handler == item.handler) && (handler.user_data == item.user_data)) {
+            return i;
         }
-        if (id_map.empty()) {
-            it = _event_handlers.erase(it);
-        } else {
-            ++it;
+    }
+
+    return handlers_num;
+}
+
+size_t Event::getSlotIndex(void *object, ID id) const
+{
+    uint64_t key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(object));
+    key ^= static_cast<uint64_t>(static_cast<uint32_t>(id)) << 32;
+    // Fibonacci hashing, the high bits are the best mixed
+    key *= 0x9E3779B97F4A7C15ULL;
+
+    return static_cast<size_t>(key >> 32) & (_slots.size() - 1);
+}
+
+const Event::Slot *Event::findSlot(void *object, ID id) const
+{
+    if (_used_slots_num == 0) {
+        return nullptr;
+    }
+
+    size_t mask = _slots.size() - 1;
+    for (size_t i = getSlotIndex(object, id); ; i = (i + 1) & mask) {
+        const Slot &slot = _slots[i];
+        if (slot.isEmpty()) {
+            return nullptr;
+        }
+        if ((slot.object == object) && (slot.id == id)) {
+            return &slot;
         }
     }
 }
 
+Event::Slot *Event::findSlot(void *object, ID id)
+{
+    return const_cast<Slot *>(static_cast<const Event *>(this)->findSlot(object, id));
+}
+
+Event::Slot *Event::insertSlot(void *object, ID id)
+{
+    Slot *slot = findSlot(object, id);
+    if (slot != nullptr) {
+        return slot;
+    }
+
+    // Keep the load factor under 3/4, so the probes stay short
+    if ((_used_slots_num + 1) * 4 > _slots.size() * 3) {
+        growSlots();
+    }
+
+    size_t mask = _slots.size() - 1;
+    size_t i = getSlotIndex(object, id);
+    while (!_slots[i].isEmpty()) {
+        i = (i + 1) & mask;
+    }
+    slot = &_slots[i];
+    slot->object = object;
+    slot->id = id;
+    _used_slots_num++;
+
+    return slot;
+}
+
+void Event::eraseSlot(Slot *slot)
+{
+    _handlers_num -= slot->handlers_num;
+    slot->handlers_num = 0;
+    slot->more_handlers.clear();
+    _used_slots_num--;
+    _table_version++;
+
+    // Shift back the following slots of the probe sequence which can be found from the erased one
+    size_t mask = _slots.size() - 1;
+    size_t hole = slot - _slots.data();
+    for (size_t i = (hole + 1) & mask; !_slots[i].isEmpty(); i = (i + 1) & mask) {
+        size_t home = getSlotIndex(_slots[i].object, _slots[i].id);
+        if (((i - home) & mask) < ((i - hole) & mask)) {
+            continue;
+        }
+        _slots[hole] = std::move(_slots[i]);
+        _slots[i].handlers_num = 0;
+        _slots[i].more_handlers.clear();
+        hole = i;
+    }
+}
+
+void Event::growSlots(void)
+{
+    std::vector<Slot> old_slots(std::max(SLOTS_NUM_MIN, _slots.size() * 2));
+    old_slots.swap(_slots);
+    ESP_UTILS_LOGD("Grow slots: %d -> %d", static_cast<int>(old_slots.size()), static_cast<int>(_slots.size()));
+
+    size_t mask = _slots.size() - 1;
+    for (auto &old_slot : old_slots) {
+        if (old_slot.isEmpty()) {
+            continue;
+        }
+        size_t i = getSlotIndex(old_slot.object, old_slot.id);
+        while (!_slots[i].isEmpty()) {
+            i = (i + 1) & mask;
+        }
+        _slots[i] = std::move(old_slot);
+    }
+    _table_version++;
+}
+
+size_t Event::eraseSlotsIf(const std::function<bool(Slot &)> &condition)
+{
+    size_t erased_num = 0;
+    for (size_t i = 0; i < _slots.size(); ) {
+        Slot &slot = _slots[i];
+        // The erased slot is filled by a shifted one, which is checked again
+        if (!slot.isEmpty() && condition(slot)) {
+            eraseSlot(&slot);
+            erased_num++;
+            continue;
+        }
+        i++;
+    }
+
+    return erased_num;
+}
+
+void Event::erasePostedEventsWithoutHandler(void)
+{
+    // The events of the removed handlers would be sent to nothing, or to an object which is gone
+    _posted_events.erase(std::remove_if(_posted_events.begin(), _posted_events.end(),
+    [this](const PostedEvent & event) {
+        return (findSlot(event.object, event.id) == nullptr);
+    }), _posted_events.end());
+}
+
+void Event::recycleEventID(ID id)
+{
+    // Only the IDs handed out by `getFreeEventID()` are recycled, not the built-in ones
+    if (id <= ID::CUSTOM) {
+        return;
+    }
+    if (!checkUsedEventID(id)) {
+        ESP_UTILS_LOGD("Recycle event ID(%d)", static_cast<int>(id));
+        _available_event_ids.insert(id);
+    }
+}
+
+bool Event::checkUsedEventID(ID id) const
+{
+    for (auto &slot : _slots) {
+        if (!slot.isEmpty() && (slot.id == id)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 } // namespace esp_brookesia::systems::base
@@ -5,8 +5,9 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <array>
 #include <vector>
-#include <unordered_map>
 #include <unordered_set>
 #include <functional>
 #include <memory>
@@ -28,6 +29,7 @@ public:
         void *user_data;
     };
     using Handler = bool (*)(const HandlerData &data);
+    using PostedCallback = void (*)(void *user_data);
 
     Event();
     ~Event();
@@ -35,6 +37,20 @@ public:
     void reset(void);
     bool registerEvent(void *object, Handler handler, ID id, void *user_data = nullptr);
     bool sendEvent(void *object, ID id, void *param = nullptr) const;
+    /**
+     * @brief Queue an event to be sent by `flushPostedEvents()`. The same event (object, ID and param) posted again
+     *        before the flush is only sent once
+     */
+    bool postEvent(void *object, ID id, void *param = nullptr);
+    /**
+     * @brief Send the posted events, in the order they were posted. Called by the context at the start of every
+     *        LVGL frame
+     */
+    bool flushPostedEvents(void);
+    /**
+     * @brief Set the function called when an event is posted to an empty queue, to get the next flush scheduled
+     */
+    void setPostedCallback(PostedCallback callback, void *user_data = nullptr);
     void unregisterEvent(void *object);
     void unregisterEvent(void *object, ID id);
     void unregisterEvent(void *object, Handler handler, ID id);
@@ -43,16 +59,71 @@ public:
 
     ID getFreeEventID();
 
+    size_t getPostedEventsCount(void) const
+    {
+        return _posted_events.size();
+    }
+
 private:
-    using HandlerList = std::vector<std::pair<Handler, void *>>;
+    // Handlers of a (object, ID) stored in the slot, the rest are moved to `more_handlers`
+    static constexpr size_t SLOT_INLINE_HANDLERS_NUM = 2;
+    static constexpr size_t SLOTS_NUM_MIN = 16;
+
+    struct HandlerItem {
+        Handler handler;
+        void *user_data;
+    };
+    // Open-addressing slot, empty when it has no handler
+    struct Slot {
+        void *object;
+        ID id;
+        uint32_t handlers_num;
+        std::array<HandlerItem, SLOT_INLINE_HANDLERS_NUM> handlers;
+        std::vector<HandlerItem> more_handlers;
+
+        bool isEmpty() const
+        {
+            return (handlers_num == 0);
+        }
+        const HandlerItem &getHandler(size_t index) const
+        {
+            return (index < SLOT_INLINE_HANDLERS_NUM) ? handlers[index] :
+                   more_handlers[index - SLOT_INLINE_HANDLERS_NUM];
+        }
+        // Search backward from `index`, handlers are only appended, so a kept one never moves to a higher index
+        size_t findHandler(const HandlerItem &item, size_t index) const;
+        void addHandler(const HandlerItem &item);
+        size_t removeHandler(Handler handler);
+    };
+    struct PostedEvent {
+        void *object;
+        ID id;
+        void *param;
+    };
 
+    size_t getSlotIndex(void *object, ID id) const;
+    const Slot *findSlot(void *object, ID id) const;
+    Slot *findSlot(void *object, ID id);
+    Slot *insertSlot(void *object, ID id);
+    void eraseSlot(Slot *slot);
+    void growSlots(void);
+    size_t eraseSlotsIf(const std::function<bool(Slot &)> &condition);
+    void erasePostedEventsWithoutHandler(void);
+    void recycleEventID(ID id);
     bool checkUsedEventID(ID id) const;
-    size_t getEventHandlersCount(void) const;
-    void cleanEmptyHandlers();
 
     ID _free_event_id;
-    std::unordered_map<void *, std::unordered_map<ID, HandlerList>> _event_handlers;
+    // Flat table, the capacity is a power of 2 and the deleted slots are backward shifted, so there are no tombstones
+    std::vector<Slot> _slots;
+    size_t _used_slots_num = 0;
+    size_t _handlers_num = 0;
+    // Bumped on every change of the table, so a dispatch knows when a handler changed it
+    uint32_t _table_version = 0;
     std::unordered_set<ID> _available_event_ids;
+    std::vector<PostedEvent> _posted_events;
+    std::vector<PostedEvent> _flushing_events;
+    PostedCallback _posted_callback = nullptr;
+    void *_posted_callback_user_data = nullptr;
 };
 
 } // namespace esp_brookesia::systems::base
@@ -5,6 +5,8 @@
  */
 #include <cstring>
 #include <cmath>
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "esp_brookesia_systems_internal.h"
 #if !ESP_BROOKESIA_BASE_MANAGER_ENABLE_DEBUG_LOG
 #   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
@@ -14,6 +16,8 @@
 #include "esp_brookesia_base_manager.hpp"
 #include "esp_brookesia_base_context.hpp"
 
+#define SNAPSHOT_ASYNC_TIMER_PERIOD_MS  (10)
+
 using namespace std;
 using namespace esp_brookesia::gui;
 
@@ -304,6 +308,10 @@ bool Manager::processAppResume(App *app)
         // if so, pause the active app
         ESP_UTILS_CHECK_FALSE_RETURN(processAppPause(_active_app), false, "App process pause failed");
     }
+    // The app is shown again before its snapshot is captured, it's taken on the next pause
+    if (_pending_snapshot_app_id == app->_id) {
+        cancelPendingAppSnapshot();
+    }
 
     // Process display
     ESP_UTILS_CHECK_FALSE_RETURN(display.processAppResume(app), false, "Display process resume failed");
@@ -379,67 +387,346 @@ bool Manager::processAppClose(App *app)
     return true;
 }
 
+/**
+ * RGB565 box filter, the channels of a pixel are summed at once in a 32-bit word: `0x07E0F81F` keeps the green in the
+ * upper half and the red and blue in the lower half, with enough free bits above each of them for 16 samples
+ */
+static inline uint32_t snapshot_expand_rgb565(uint16_t color)
+{
+    return (color | (static_cast<uint32_t>(color) << 16)) & 0x07E0F81F;
+}
+
+static inline uint16_t snapshot_pack_rgb565(uint32_t channels)
+{
+    channels &= 0x07E0F81F;
+    return static_cast<uint16_t>(channels | (channels >> 16));
+}
+
+static void snapshot_downscale_rgb565(const lv_draw_buf_t *src, lv_draw_buf_t *dest, uint8_t factor)
+{
+    int shift = (factor == 4) ? 4 : 2;
+
+    for (uint32_t y = 0; y < dest->header.h; y++) {
+        auto dest_row = reinterpret_cast<uint16_t *>(dest->data + y * dest->header.stride);
+        for (uint32_t x = 0; x < dest->header.w; x++) {
+            uint32_t sum = 0;
+            for (int dy = 0; dy < factor; dy++) {
+                auto src_row = reinterpret_cast<const uint16_t *>(src->data + (y * factor + dy) * src->header.stride);
+                for (int dx = 0; dx < factor; dx++) {
+                    sum += snapshot_expand_rgb565(src_row[x * factor + dx]);
+                }
+            }
+            dest_row[x] = snapshot_pack_rgb565(sum >> shift);
+        }
+    }
+}
+
+size_t Manager::compressSnapshotRle(const uint8_t *in, size_t size, size_t blk_size, uint8_t *out)
+{
+    size_t blk_num = size / blk_size;
+    size_t out_size = 0;
+    size_t i = 0;
+
+    while (i < blk_num) {
+        size_t run = 1;
+        while ((i + run < blk_num) && (run < 0x7f) && !memcmp(in + (i + run) * blk_size, in + i * blk_size, blk_size)) {
+            run++;
+        }
+        if (run > 1) {
+            out[out_size++] = run;
+            memcpy(out + out_size, in + i * blk_size, blk_size);
+            out_size += blk_size;
+            i += run;
+            continue;
+        }
+
+        size_t start = i++;
+        while ((i < blk_num) && (i - start < 0x7f) &&
+                ((i + 1 >= blk_num) || memcmp(in + (i + 1) * blk_size, in + i * blk_size, blk_size))) {
+            i++;
+        }
+        out[out_size++] = 0x80 | (i - start);
+        memcpy(out + out_size, in + start * blk_size, (i - start) * blk_size);
+        out_size += (i - start) * blk_size;
+    }
+
+    return out_size;
+}
+
+static uint8_t *snapshot_compress(const lv_draw_buf_t *buffer, size_t &compressed_size)
+{
+    size_t blk_size = lv_color_format_get_size(static_cast<lv_color_format_t>(buffer->header.cf));
+    size_t size = buffer->header.stride * buffer->header.h;
+    // Worst case: a control byte for each block, the buffer is shrunk to the real size below
+    size_t max_size = 3 * sizeof(uint32_t) + size + size / blk_size;
+    auto compressed = static_cast<uint8_t *>(heap_caps_malloc(max_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    if (compressed == nullptr) {
+        compressed = static_cast<uint8_t *>(heap_caps_malloc(max_size, MALLOC_CAP_DEFAULT));
+    }
+    ESP_UTILS_CHECK_NULL_RETURN(
+        compressed, nullptr, "Alloc compressed snapshot(%d) failed", static_cast<int>(max_size)
+    );
+
+    uint32_t header[3] = {LV_IMAGE_COMPRESS_RLE, 0, static_cast<uint32_t>(size)};
+    header[1] = Manager::compressSnapshotRle(buffer->data, size, blk_size, compressed + sizeof(header));
+    memcpy(compressed, header, sizeof(header));
+    compressed_size = sizeof(header) + header[1];
+    if (compressed_size >= size) {
+        heap_caps_free(compressed);
+        return nullptr;
+    }
+
+    // Shrinking is done in place, in the same heap
+    auto shrunk = static_cast<uint8_t *>(heap_caps_realloc(compressed, compressed_size, MALLOC_CAP_8BIT));
+
+    return (shrunk != nullptr) ? shrunk : compressed;
+}
+
+static void snapshot_free(lv_image_dsc_t &dsc, lv_draw_buf_t *&buffer, uint8_t *&compressed)
+{
+    // The decoded compressed snapshot may be kept in the image cache
+    lv_image_cache_drop(&dsc);
+    if (buffer != nullptr) {
+        lv_draw_buf_destroy(buffer);
+        buffer = nullptr;
+    }
+    if (compressed != nullptr) {
+        heap_caps_free(compressed);
+        compressed = nullptr;
+    }
+}
+
+/**
+ * Snapshots are taken at the screen size, even if the app screen has another one. Return if the screen is resized, to
+ * restore its area after the snapshot
+ */
+static bool snapshot_fit_screen(lv_obj_t *screen, const gui::StyleSize &screen_size, lv_area_t &area)
+{
+    area = screen->coords;
+    if ((lv_area_get_width(&area) == screen_size.width) && (lv_area_get_height(&area) == screen_size.height)) {
+        return false;
+    }
+
+    ESP_UTILS_LOGD("Active screen size is not match screen size, resize it");
+    screen->coords = (lv_area_t) {
+        .x1 = 0,
+        .y1 = 0,
+        .x2 = (lv_coord_t)(screen_size.width - 1),
+        .y2 = (lv_coord_t)(screen_size.height - 1),
+    };
+
+    return true;
+}
+
 bool Manager::saveAppSnapshot(App *app)
 {
 #if !LV_USE_SNAPSHOT
     ESP_UTILS_CHECK_FALSE_RETURN(false, false, "`LV_USE_SNAPSHOT` is not enabled");
 #else
-    bool resize_app_screen = false;
-    lv_res_t ret = LV_RES_INV;
     lv_area_t app_screen_area = {};
-    lv_draw_buf_t *snapshot_buffer = nullptr;
+    bool resize_app_screen = false;
+    bool ret = false;
 
     ESP_UTILS_CHECK_NULL_RETURN(app, false, "Invalid app");
     ESP_UTILS_LOGD("Save app(%d) snapshot", app->_id);
 
     ESP_UTILS_CHECK_FALSE_RETURN(app->_active_screen != nullptr, false, "Invalid active screen");
-    app_screen_area = app->_active_screen->coords;
-    if ((lv_area_get_width(&app_screen_area) != _system_context.getData().screen_size.width) ||
-            (lv_area_get_height(&app_screen_area) != _system_context.getData().screen_size.height)) {
-        ESP_UTILS_LOGD("Active screen size is not match screen size, resize it");
-        app->_active_screen->coords = (lv_area_t) {
-            .x1 = 0,
-            .y1 = 0,
-            .x2 = (lv_coord_t)(_system_context.getData().screen_size.width - 1),
-            .y2 = (lv_coord_t)(_system_context.getData().screen_size.height - 1),
-        };
-        resize_app_screen = true;
+    // Only one snapshot is captured at a time, finish the previous one
+    if (_pending_snapshot.isRunning() && !renderPendingAppSnapshot(0, true)) {
+        ESP_UTILS_LOGE("Finish pending snapshot failed");
     }
 
-    auto it = _id_app_snapshot_map.find(app->_id);
+    int64_t start_us = esp_timer_get_time();
     auto color_format = _system_context.getDisplayDevice()->color_format;
-    snapshot_buffer = (it != _id_app_snapshot_map.end()) ? it->second : nullptr;
+    resize_app_screen = snapshot_fit_screen(
+                            app->_active_screen, _system_context.getData().screen_size, app_screen_area
+                        );
+    if (isAppSnapshotAsync()) {
+        // Only the buffer is created here, the screen is rendered by the timer when nothing else is drawn
+        ret = _pending_snapshot.begin(app->_active_screen, color_format);
+        if (resize_app_screen) {
+            app->_active_screen->coords = app_screen_area;
+        }
+        ESP_UTILS_CHECK_FALSE_RETURN(ret, false, "Begin snapshot failed");
+
+        _pending_snapshot_app_id = app->_id;
+        _pending_snapshot_blocking_us = static_cast<uint32_t>(esp_timer_get_time() - start_us);
+        if (_pending_snapshot_timer == nullptr) {
+            _pending_snapshot_timer = lv_timer_create(
+                                          onPendingAppSnapshotTimerCallback, SNAPSHOT_ASYNC_TIMER_PERIOD_MS, this
+                                      );
+            ESP_UTILS_CHECK_NULL_GOTO(_pending_snapshot_timer, err, "Create snapshot timer failed");
+        }
+
+        return true;
+    }
 
-    if ((snapshot_buffer == nullptr) || (snapshot_buffer->header.w != lv_area_get_width(&app_screen_area)) ||
-            (snapshot_buffer->header.h != lv_area_get_height(&app_screen_area))) {
-        if (snapshot_buffer != nullptr) {
-            lv_draw_buf_destroy(snapshot_buffer);
+    {
+        lv_draw_buf_t *full_buffer = lv_snapshot_take(app->_active_screen, color_format);
+        if (resize_app_screen) {
+            app->_active_screen->coords = app_screen_area;
         }
-        snapshot_buffer = lv_snapshot_create_draw_buf(app->_active_screen, color_format);
-        ESP_UTILS_CHECK_NULL_GOTO(snapshot_buffer, err, "Create snapshot buffer failed");
+        ESP_UTILS_CHECK_NULL_RETURN(full_buffer, false, "Take snapshot fail");
+
+        _snapshot_render_us = static_cast<uint32_t>(esp_timer_get_time() - start_us);
+        _snapshot_blocking_us = _snapshot_render_us;
+        ret = storeAppSnapshot(app->_id, full_buffer);
     }
 
-    // And take snapshot for recent screen
-    ret = lv_snapshot_take_to_draw_buf(app->_active_screen, color_format, snapshot_buffer);
-    ESP_UTILS_CHECK_FALSE_GOTO(ret == LV_RESULT_OK, err, "Take snapshot fail");
+    return ret;
 
-    _id_app_snapshot_map[app->_id] = snapshot_buffer;
-    if (resize_app_screen) {
-        app->_active_screen->coords = app_screen_area;
+err:
+    cancelPendingAppSnapshot();
+
+    return false;
+#endif
+}
+
+bool Manager::storeAppSnapshot(int id, lv_draw_buf_t *full_buffer)
+{
+    lv_draw_buf_t *buffer = nullptr;
+    uint8_t *compressed = nullptr;
+    size_t compressed_size = 0;
+    lv_image_header_t header = {};
+    uint8_t downscale = _core_data.snapshot.downscale;
+    auto color_format = static_cast<lv_color_format_t>(full_buffer->header.cf);
+    size_t full_size = full_buffer->header.stride * full_buffer->header.h;
+
+    if ((downscale > 1) && (color_format != LV_COLOR_FORMAT_RGB565)) {
+        ESP_UTILS_LOGW("Only RGB565 snapshots can be downscaled, keep the full resolution");
+        downscale = 1;
+    }
+    if ((downscale > 1) && (downscale != 2) && (downscale != 4)) {
+        ESP_UTILS_LOGW("Invalid snapshot downscale(%d), use 2", downscale);
+        downscale = 2;
+    }
+    if (downscale > 1) {
+        buffer = lv_draw_buf_create(
+                     full_buffer->header.w / downscale, full_buffer->header.h / downscale, color_format, LV_STRIDE_AUTO
+                 );
+        ESP_UTILS_CHECK_NULL_GOTO(buffer, err, "Create snapshot buffer failed");
+        snapshot_downscale_rgb565(full_buffer, buffer, downscale);
+        lv_draw_buf_destroy(full_buffer);
+        full_buffer = nullptr;
+    } else {
+        buffer = full_buffer;
+        full_buffer = nullptr;
+    }
+
+    header = buffer->header;
+    if (_core_data.flags.enable_app_snapshot_compress) {
+        compressed = snapshot_compress(buffer, compressed_size);
+        if (compressed != nullptr) {
+            lv_draw_buf_destroy(buffer);
+            buffer = nullptr;
+        } else {
+            ESP_UTILS_LOGD("Snapshot is not compressible, keep it uncompressed");
+        }
+    }
+
+    {
+        // The descriptor is updated in place, so the recents screen can keep it
+        auto &snapshot = _id_app_snapshot_map[id];
+        snapshot_free(snapshot.dsc, snapshot.buffer, snapshot.compressed);
+        snapshot.full_size = full_size;
+        if (compressed != nullptr) {
+            snapshot.compressed = compressed;
+            snapshot.dsc.header = header;
+            snapshot.dsc.header.flags |= LV_IMAGE_FLAGS_COMPRESSED;
+            snapshot.dsc.data = compressed;
+            snapshot.dsc.data_size = compressed_size;
+        } else {
+            snapshot.buffer = buffer;
+            snapshot.dsc.header = header;
+            snapshot.dsc.data = buffer->data;
+            snapshot.dsc.data_size = buffer->data_size;
+        }
+        ESP_UTILS_LOGD(
+            "App(%d) snapshot: %dx%d, %d/%d bytes, rendered in %dus (%dus blocking)", id,
+            static_cast<int>(snapshot.dsc.header.w), static_cast<int>(snapshot.dsc.header.h),
+            static_cast<int>(snapshot.dsc.data_size), static_cast<int>(full_size),
+            static_cast<int>(_snapshot_render_us), static_cast<int>(_snapshot_blocking_us)
+        );
     }
 
     return true;
 
 err:
-    if (snapshot_buffer != nullptr) {
-        lv_draw_buf_destroy(snapshot_buffer);
+    if (full_buffer != nullptr) {
+        lv_draw_buf_destroy(full_buffer);
+    }
+    if (buffer != nullptr) {
+        lv_draw_buf_destroy(buffer);
+    }
+
+    return false;
+}
+
+bool Manager::renderPendingAppSnapshot(int32_t rows, bool is_blocking)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(_pending_snapshot.isRunning(), false, "No pending snapshot");
+
+    // The app may have been closed, or changed its screen
+    App *app = getRunningAppById(_pending_snapshot_app_id);
+    if ((app == nullptr) || (app->_active_screen != _pending_snapshot.getObject())) {
+        ESP_UTILS_LOGW("App(%d) screen has changed, cancel its snapshot", _pending_snapshot_app_id);
+        cancelPendingAppSnapshot();
+        return false;
+    }
+
+    lv_area_t app_screen_area = {};
+    bool resize_app_screen = snapshot_fit_screen(
+                                 app->_active_screen, _system_context.getData().screen_size, app_screen_area
+                             );
+    uint32_t render_us = _pending_snapshot.getRenderTimeUs();
+    bool ret = _pending_snapshot.renderNext(rows);
+    if (is_blocking) {
+        _pending_snapshot_blocking_us += _pending_snapshot.getRenderTimeUs() - render_us;
     }
     if (resize_app_screen) {
         app->_active_screen->coords = app_screen_area;
     }
+    if (!ret) {
+        cancelPendingAppSnapshot();
+        ESP_UTILS_CHECK_FALSE_RETURN(false, false, "Render snapshot failed");
+    }
+    if (!_pending_snapshot.isDone()) {
+        return true;
+    }
 
-    return false;
-#endif
+    int id = _pending_snapshot_app_id;
+    _snapshot_render_us = _pending_snapshot.getRenderTimeUs();
+    _snapshot_blocking_us = _pending_snapshot_blocking_us;
+    auto full_buffer = _pending_snapshot.release();
+    cancelPendingAppSnapshot();
+
+    return storeAppSnapshot(id, full_buffer);
+}
+
+void Manager::cancelPendingAppSnapshot(void)
+{
+    _pending_snapshot.del();
+    _pending_snapshot_app_id = -1;
+    if (_pending_snapshot_timer != nullptr) {
+        lv_timer_delete(_pending_snapshot_timer);
+        _pending_snapshot_timer = nullptr;
+    }
+}
+
+void Manager::onPendingAppSnapshotTimerCallback(lv_timer_t *timer)
+{
+    auto manager = static_cast<Manager *>(lv_timer_get_user_data(timer));
+    ESP_UTILS_CHECK_NULL_EXIT(manager, "Invalid manager");
+
+    // Idle frame: the transition to the home screen is over, and nothing waits to be refreshed
+    lv_display_t *display = manager->_system_context.getDisplayDevice();
+    if ((lv_anim_count_running() > 0) || ((display != nullptr) && (display->inv_p > 0))) {
+        return;
+    }
+
+    if (!manager->renderPendingAppSnapshot(manager->_core_data.snapshot.async_rows, false)) {
+        ESP_UTILS_LOGE("Render pending snapshot failed");
+    }
 }
 
 bool Manager::releaseAppSnapshot(App *app)
@@ -447,16 +734,17 @@ bool Manager::releaseAppSnapshot(App *app)
     ESP_UTILS_CHECK_NULL_RETURN(app, false, "Invalid app");
     ESP_UTILS_LOGD("Release app(%d) snapshot", app->_id);
 
+    if (_pending_snapshot_app_id == app->_id) {
+        cancelPendingAppSnapshot();
+    }
+
     auto it = _id_app_snapshot_map.find(app->_id);
     if (it == _id_app_snapshot_map.end()) {
         return true;
     }
 
-    auto snapshot_buffer = it->second;
-    if (snapshot_buffer != nullptr) {
-        lv_draw_buf_destroy(snapshot_buffer);
-    }
-    ESP_UTILS_CHECK_FALSE_RETURN(_id_app_snapshot_map.erase(app->_id) > 0, false, "Free snapshot failed");
+    snapshot_free(it->second.dsc, it->second.buffer, it->second.compressed);
+    _id_app_snapshot_map.erase(it);
 
     return true;
 }
@@ -522,12 +810,57 @@ App *Manager::getRunningAppById(int id)
     return nullptr;
 }
 
-const lv_draw_buf_t *Manager::getAppSnapshot(int id)
+const lv_image_dsc_t *Manager::getAppSnapshot(int id)
 {
+    if (_pending_snapshot.isRunning() && (_pending_snapshot_app_id == id)) {
+        ESP_UTILS_LOGD("Finish pending snapshot of app(%d)", id);
+        if (!renderPendingAppSnapshot(0, true)) {
+            ESP_UTILS_LOGE("Finish pending snapshot failed");
+        }
+    }
+
     auto it = _id_app_snapshot_map.find(id);
     ESP_UTILS_CHECK_FALSE_RETURN(it != _id_app_snapshot_map.end(), nullptr, "App snapshot not found");
 
-    return it->second;
+    return &it->second.dsc;
+}
+
+Manager::SnapshotStats Manager::getAppSnapshotStats(void) const
+{
+    SnapshotStats stats = {};
+
+    for (auto &it : _id_app_snapshot_map) {
+        stats.num++;
+        stats.size += it.second.dsc.data_size;
+        stats.full_size += it.second.full_size;
+    }
+    stats.render_us = _snapshot_render_us;
+    stats.blocking_us = _snapshot_blocking_us;
+
+    return stats;
+}
+
+void Manager::dumpAppSnapshots(void) const
+{
+    for (auto &it : _id_app_snapshot_map) {
+        auto &dsc = it.second.dsc;
+        ESP_UTILS_LOGI(
+            "App(%d) snapshot: %dx%d%s, %d bytes (%d at full resolution)", it.first, static_cast<int>(dsc.header.w),
+            static_cast<int>(dsc.header.h), (it.second.compressed != nullptr) ? " RLE" : "",
+            static_cast<int>(dsc.data_size), static_cast<int>(it.second.full_size)
+        );
+    }
+
+    auto stats = getAppSnapshotStats();
+    ESP_UTILS_LOGI(
+        "%d snapshots: %d bytes (%d at full resolution), free PSRAM: %d bytes", stats.num,
+        static_cast<int>(stats.size), static_cast<int>(stats.full_size),
+        static_cast<int>(heap_caps_get_free_size(MALLOC_CAP_SPIRAM))
+    );
+    ESP_UTILS_LOGI(
+        "Last snapshot: rendered in %dus, %dus on the app switch (%s)", static_cast<int>(stats.render_us),
+        static_cast<int>(stats.blocking_us), isAppSnapshotAsync() ? "async" : "sync"
+    );
 }
 
 bool Manager::begin(void)
@@ -571,6 +904,10 @@ bool Manager::del(void)
     }
     _id_installed_app_map.clear();
     _id_running_app_map.clear();
+    cancelPendingAppSnapshot();
+    for (auto &it : _id_app_snapshot_map) {
+        snapshot_free(it.second.dsc, it.second.buffer, it.second.compressed);
+    }
     _id_app_snapshot_map.clear();
 
     return ret;
@@ -9,6 +9,7 @@
 #include <map>
 #include <unordered_map>
 #include "lvgl/esp_brookesia_lv_helper.hpp"
+#include "lvgl/esp_brookesia_lv_tiled_snapshot.hpp"
 #include "esp_brookesia_base_app.hpp"
 #include "esp_brookesia_base_display.hpp"
 
@@ -31,11 +32,35 @@ public:
         struct {
             int max_running_num;
         } app;
+        struct {
+            /**
+             * Snapshots are stored this many times smaller on each side (1, 2 or 4) for the recents screen, which
+             * only shows thumbnails. 0 or 1 keeps the full resolution, e.g. for transition animations
+             */
+            uint8_t downscale;
+            /**
+             * Rows rendered per idle frame when the snapshots are captured asynchronously, 0 to render them at once
+             * on the first idle frame
+             */
+            uint16_t async_rows;
+        } snapshot;
         struct {
             uint8_t enable_app_save_snapshot: 1;
+            uint8_t enable_app_snapshot_compress: 1;    /*!< Store the snapshots RLE-compressed in PSRAM. They're
+                                                         *   decoded into the LVGL image cache, which must hold all
+                                                         *   of them (`CONFIG_LV_CACHE_DEF_SIZE`) */
+            uint8_t enable_app_snapshot_async: 1;       /*!< Capture the snapshots after the app switch, when idle */
         } flags;
     };
 
+    struct SnapshotStats {
+        int num;
+        size_t size;            /*!< Memory used by the stored snapshots */
+        size_t full_size;       /*!< Memory they would use at full resolution without compression */
+        uint32_t render_us;     /*!< Time spent rendering the last snapshot */
+        uint32_t blocking_us;   /*!< Part of it spent on the app switch, instead of idle frames */
+    };
+
     using RegistryAppInfo = std::tuple<std::string, std::shared_ptr<App>>;
 
     Manager(Context &core, const Data &data);
@@ -71,7 +96,38 @@ public:
     {
         return _active_app;
     }
-    const lv_draw_buf_t *getAppSnapshot(int id);
+    /**
+     * @brief Get the snapshot of an app. A snapshot still being captured asynchronously is finished first
+     */
+    const lv_image_dsc_t *getAppSnapshot(int id);
+    SnapshotStats getAppSnapshotStats(void) const;
+    /**
+     * @brief Override the `enable_app_snapshot_async` flag of the stylesheet, e.g. to compare the app switch latency
+     *        with and without it
+     */
+    void setAppSnapshotAsync(bool enable)
+    {
+        _app_snapshot_async = enable ? 1 : 0;
+    }
+    bool isAppSnapshotAsync(void) const
+    {
+        return (_app_snapshot_async >= 0) ? (_app_snapshot_async > 0) : _core_data.flags.enable_app_snapshot_async;
+    }
+    void dumpAppSnapshots(void) const;
+
+    /**
+     * @brief RLE-compress a buffer as the snapshots are stored with `enable_app_snapshot_compress`, in the format of
+     *        the LVGL decoder: a control byte, then either a block repeated `ctrl` times, or `ctrl & 0x7f` literal
+     *        blocks
+     *
+     * @param[in] in Buffer to compress
+     * @param[in] size Size of the buffer, a multiple of `blk_size`
+     * @param[in] blk_size Size of a block, e.g. of a pixel
+     * @param[out] out Compressed buffer, which must hold `size + size / blk_size` bytes in the worst case
+     *
+     * @return The size of the compressed buffer
+     */
+    static size_t compressSnapshotRle(const uint8_t *in, size_t size, size_t blk_size, uint8_t *out);
 
 protected:
     virtual bool processAppRunExtra(App *app)
@@ -107,18 +163,37 @@ protected:
     const Data &_core_data;
 
 private:
+    struct AppSnapshot {
+        lv_image_dsc_t dsc;
+        lv_draw_buf_t *buffer;  /*!< Uncompressed pixels */
+        uint8_t *compressed;    /*!< Or compressed ones, in PSRAM */
+        size_t full_size;
+    };
+
     bool begin(void);
     bool del(void);
     bool startApp(int id);
+    bool storeAppSnapshot(int id, lv_draw_buf_t *full_buffer);
+    bool renderPendingAppSnapshot(int32_t rows, bool is_blocking);
+    void cancelPendingAppSnapshot(void);
 
     static void onAppEventCallback(lv_event_t *event);
     static void onNavigationEventCallback(lv_event_t *event);
+    static void onPendingAppSnapshotTimerCallback(lv_timer_t *timer);
 
     uint32_t _app_free_id{App::APP_ID_MIN};
     App *_active_app{nullptr};
     std::unordered_map <int, App *> _id_installed_app_map;
     std::unordered_map <int, App *> _id_running_app_map;
-    std::unordered_map <int, lv_draw_buf_t *> _id_app_snapshot_map;
+    std::unordered_map <int, AppSnapshot> _id_app_snapshot_map;
+    // Asynchronous snapshot, only one at a time
+    gui::LvTiledSnapshot _pending_snapshot;
+    int _pending_snapshot_app_id{-1};
+    lv_timer_t *_pending_snapshot_timer{nullptr};
+    uint32_t _pending_snapshot_blocking_us{0};
+    int8_t _app_snapshot_async{-1};     // -1: as the stylesheet
+    uint32_t _snapshot_render_us{0};
+    uint32_t _snapshot_blocking_us{0};
     // Navigation
     NavigateType _navigate_type{NavigateType::MAX};
 };
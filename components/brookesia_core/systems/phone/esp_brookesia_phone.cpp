@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <algorithm>
+#include <cstring>
+#include <type_traits>
 #include "esp_brookesia_systems_internal.h"
 #if !ESP_BROOKESIA_PHONE_PHONE_ENABLE_DEBUG_LOG
 #   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
@@ -19,6 +21,44 @@ namespace esp_brookesia::systems::phone {
 
 const Stylesheet Phone::_default_stylesheet_dark = ESP_BROOKESIA_PHONE_DEFAULT_DARK_STYLESHEET();
 
+template <typename T>
+static bool check_data_changed(const T &old_data, const T &new_data)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Data should be compared byte by byte");
+
+    // Padding bytes may differ, which only updates a section for nothing
+    return (memcmp(&old_data, &new_data, sizeof(T)) != 0);
+}
+
+static uint32_t get_stylesheet_dirty_sections(const Stylesheet &old_stylesheet, const Stylesheet &new_stylesheet)
+{
+    using DataSection = base::Context::DataSection;
+
+    // The name of the core data is not used by the widgets
+    uint32_t dirty_sections = 0;
+    if (check_data_changed(old_stylesheet.core.screen_size, new_stylesheet.core.screen_size) ||
+            check_data_changed(old_stylesheet.core.display, new_stylesheet.core.display)) {
+        dirty_sections |= base::Context::getDataSectionBit(DataSection::CORE);
+    }
+    if (check_data_changed(old_stylesheet.display.status_bar, new_stylesheet.display.status_bar)) {
+        dirty_sections |= base::Context::getDataSectionBit(DataSection::STATUS_BAR);
+    }
+    if (check_data_changed(old_stylesheet.display.navigation_bar, new_stylesheet.display.navigation_bar)) {
+        dirty_sections |= base::Context::getDataSectionBit(DataSection::NAVIGATION_BAR);
+    }
+    if (check_data_changed(old_stylesheet.display.app_launcher, new_stylesheet.display.app_launcher)) {
+        dirty_sections |= base::Context::getDataSectionBit(DataSection::APP_LAUNCHER);
+    }
+    if (check_data_changed(old_stylesheet.display.recents_screen, new_stylesheet.display.recents_screen)) {
+        dirty_sections |= base::Context::getDataSectionBit(DataSection::RECENTS_SCREEN);
+    }
+    if (check_data_changed(old_stylesheet.manager.gesture, new_stylesheet.manager.gesture)) {
+        dirty_sections |= base::Context::getDataSectionBit(DataSection::GESTURE);
+    }
+
+    return dirty_sections;
+}
+
 Phone::Phone(lv_display_t *display):
     base::Context(_active_stylesheet.core, _display, _manager, display),
     StylesheetManager(),
@@ -44,8 +84,8 @@ bool Phone::begin(void)
     ESP_UTILS_LOGD("Begin phone(@0x%p)", this);
     ESP_UTILS_CHECK_FALSE_RETURN(!checkCoreInitialized(), false, "Already initialized");
 
-    // Check if any phone stylesheet is added, if not, add default stylesheet
-    if (getStylesheetCount() == 0) {
+    // Check if any phone stylesheet is added or applied, if not, add default stylesheet
+    if ((getStylesheetCount() == 0) && (_active_stylesheet.core.name == nullptr)) {
         ESP_UTILS_LOGW("No phone stylesheet is added, adding default dark stylesheet(%s)",
                        _default_stylesheet_dark.core.name);
         ESP_UTILS_CHECK_FALSE_GOTO(ret = addStylesheet(_default_stylesheet_dark), end,
@@ -148,13 +188,18 @@ bool Phone::activateStylesheet(const Stylesheet &stylesheet)
 {
     ESP_UTILS_LOGD("Activate phone(0x%p) stylesheet", this);
 
+    // Only the sections which differ from the active stylesheet are updated
+    const Stylesheet *new_stylesheet = getStylesheet(stylesheet.core.name, stylesheet.core.screen_size);
+    uint32_t dirty_sections = (new_stylesheet != nullptr) ?
+                              get_stylesheet_dirty_sections(_active_stylesheet, *new_stylesheet) : DATA_SECTIONS_ALL;
+
     ESP_UTILS_CHECK_FALSE_RETURN(
         StylesheetManager::activateStylesheet(stylesheet.core.name, stylesheet.core.screen_size),
         false, "Failed to activate phone stylesheet"
     );
 
-    if (checkCoreInitialized() && !sendDataUpdateEvent()) {
-        ESP_UTILS_LOGE("Send update data event failed");
+    if (checkCoreInitialized() && (dirty_sections != 0) && !postDataUpdateEvent(dirty_sections)) {
+        ESP_UTILS_LOGE("Post update data event failed");
     }
 
     return true;
@@ -169,6 +214,22 @@ bool Phone::activateStylesheet(const Stylesheet *stylesheet)
     return true;
 }
 
+bool Phone::applyStylesheet(const Stylesheet &stylesheet)
+{
+    ESP_UTILS_LOGD("Apply phone(0x%p) stylesheet", this);
+
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        StylesheetManager::activateStylesheet(stylesheet.core.screen_size, stylesheet), false,
+        "Failed to apply phone stylesheet"
+    );
+
+    if (checkCoreInitialized() && !postDataUpdateEvent(DATA_SECTIONS_ALL)) {
+        ESP_UTILS_LOGE("Post update data event failed");
+    }
+
+    return true;
+}
+
 bool Phone::calibrateStylesheet(const gui::StyleSize &screen_size, Stylesheet &stylesheet)
 {
     ESP_UTILS_LOGD("Calibrate phone(0x%p) stylesheet", this);
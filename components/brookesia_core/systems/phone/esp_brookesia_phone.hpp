@@ -46,6 +46,53 @@ public:
     bool addStylesheet(const Stylesheet *stylesheet);
     bool activateStylesheet(const Stylesheet &stylesheet);
     bool activateStylesheet(const Stylesheet *stylesheet);
+    /**
+     * @brief Calibrate the stylesheet and activate it, without adding it. For a fixed display which only uses this
+     *        stylesheet, e.g. a `constexpr` one chosen for the resolution at compile time, this saves the stored copy
+     *        and its lookup maps
+     */
+    bool applyStylesheet(const Stylesheet &stylesheet);
+
+    /**
+     * @brief Resolve the sizes of the stylesheet given in percent of the screen to pixels at compile time, for a
+     *        display with a fixed resolution: the screen size, the min and max sizes of the status and navigation
+     *        bars, and the gesture indicator bars. The sizes relative to other objects and the fonts, which are
+     *        only known at runtime, are still calibrated by `applyStylesheet()`
+     *
+     * @param stylesheet The stylesheet, e.g. `STYLESHEET_410_502_DARK`
+     * @param display_size The resolution of the display in pixels
+     *
+     * @return The stylesheet with the resolved sizes
+     */
+    static constexpr Stylesheet resolveStylesheet(Stylesheet stylesheet, const gui::StyleSize &display_size)
+    {
+        auto &screen_size = stylesheet.core.screen_size;
+        screen_size = screen_size.resolve(display_size);
+
+        auto &status_bar = stylesheet.display.status_bar.data;
+        if (status_bar.flags.enable_main_size_min) {
+            status_bar.main.size_min = status_bar.main.size_min.resolve(screen_size);
+        }
+        if (status_bar.flags.enable_main_size_max) {
+            status_bar.main.size_max = status_bar.main.size_max.resolve(screen_size);
+        }
+        auto &navigation_bar = stylesheet.display.navigation_bar.data;
+        if (navigation_bar.flags.enable_main_size_min) {
+            navigation_bar.main.size_min = navigation_bar.main.size_min.resolve(screen_size);
+        }
+        if (navigation_bar.flags.enable_main_size_max) {
+            navigation_bar.main.size_max = navigation_bar.main.size_max.resolve(screen_size);
+        }
+        auto &gesture = stylesheet.manager.gesture;
+        for (int i = 0; i < static_cast<int>(Gesture::IndicatorBarType::MAX); i++) {
+            if (gesture.flags.enable_indicator_bars[i]) {
+                gesture.indicator_bars[i].main.size_max = gesture.indicator_bars[i].main.size_max.resolve(screen_size);
+                gesture.indicator_bars[i].main.size_min = gesture.indicator_bars[i].main.size_min.resolve(screen_size);
+            }
+        }
+
+        return stylesheet;
+    }
 
     bool calibrateScreenSize(gui::StyleSize &size) override;
 
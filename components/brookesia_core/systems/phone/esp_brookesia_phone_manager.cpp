@@ -9,6 +9,7 @@
 #   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
 #endif
 #include "private/esp_brookesia_phone_utils.hpp"
+#include "lvgl/esp_brookesia_lv_latency_monitor.hpp"
 #include "esp_brookesia_phone_manager.hpp"
 #include "esp_brookesia_phone.hpp"
 
@@ -469,6 +470,21 @@ void Manager::onAppLauncherGestureEventCallback(lv_event_t *event)
     if (dir_type != Gesture::DIR_NONE) {
         // Check if the gesture is released
         if (event_code == gesture->getReleaseEventCode()) {   // If so, reset the navigation type
+            gesture_info = (Gesture::Info *)lv_event_get_param(event);
+            ESP_UTILS_CHECK_NULL_GOTO(gesture_info, end, "Invalid gesture info");
+            // Keep scrolling the pages in the same direction after a fling
+            if (gesture_info->direction == dir_type) {
+                int page_index = app_launcher->getActiveScreenIndex();
+                int page_offset = gesture->getFlingSteps(
+                                      *gesture_info, manager->_system_context.getData().screen_size.width,
+                                      app_launcher->getPageCount()
+                                  );
+                page_index += (dir_type == Gesture::DIR_LEFT) ? page_offset : -page_offset;
+                page_index = max(min(page_index, app_launcher->getPageCount() - 1), 0);
+                if ((page_index != app_launcher->getActiveScreenIndex()) && !app_launcher->scrollToPage(page_index)) {
+                    ESP_UTILS_LOGE("base::App table scroll to page(%d) failed", page_index);
+                }
+            }
             dir_type = Gesture::DIR_NONE;
             goto end;
         }
@@ -594,6 +610,8 @@ bool Manager::processNavigationEvent(base::Manager::NavigateType type)
         if (active_app == nullptr) {
             goto end;
         }
+        // The latency of the frame showing the home screen includes the pause of the app, e.g. its snapshot
+        LvLatencyMonitor::getInstance().setInteraction(LvLatencyMonitor::Interaction::AppSwitch);
         // Process app pause
         ESP_UTILS_CHECK_FALSE_GOTO(ret = processAppPause(active_app), end, "base::App(%d) pause failed", active_app->getId());
         ESP_UTILS_CHECK_FALSE_RETURN(processDisplayScreenChange(Screen::MAIN, nullptr), false,
@@ -990,6 +1008,7 @@ void Manager::onRecentsScreenGesturePressingEventCallback(lv_event_t *event)
 
     gesture_info = (Gesture::Info *)lv_event_get_param(event);
     ESP_UTILS_CHECK_NULL_EXIT(gesture_info, "Invalid gesture info");
+    LvLatencyMonitor::getInstance().setInteraction(LvLatencyMonitor::Interaction::RecentsDrag);
 
     // Check if scroll to the left or right
     if ((gesture_info->direction & Gesture::DIR_LEFT) && !manager->_flags.is_recents_screen_snapshot_move_hor &&
@@ -1066,6 +1085,7 @@ void Manager::onRecentsScreenGestureReleaseEventCallback(lv_event_t *event)
     int distance_move_down_threshold = 0;
     int distance_move_up_exit_threshold = 0;
     int distance_y = 0;
+    int distance_fling_y = 0;
     int state = RECENTS_SCREEN_NONE;
     lv_event_code_t event_code = _LV_EVENT_LAST;
     lv_point_t start_point = { 0 };
@@ -1088,8 +1108,26 @@ void Manager::onRecentsScreenGestureReleaseEventCallback(lv_event_t *event)
     event_code = manager->_system_context.getAppEventCode();
     ESP_UTILS_CHECK_FALSE_EXIT(esp_brookesia_core_utils_check_event_code_valid(event_code), "Invalid event code");
 
-    // Check if the recents_screen is not pressed or the snapshot is moved
-    if (!manager->_flags.is_recents_screen_pressed || manager->_flags.is_recents_screen_snapshot_move_hor) {
+    // Check if the recents_screen is not pressed
+    if (!manager->_flags.is_recents_screen_pressed) {
+        return;
+    }
+    // Check if the snapshot is moved, if so, keep moving in the same direction after a fling
+    if (manager->_flags.is_recents_screen_snapshot_move_hor) {
+        if ((manager->_recents_screen_active_app != nullptr) && (manager->_gesture != nullptr)) {
+            int fling_steps = manager->_gesture->getFlingSteps(
+                                  *gesture_info, manager->_system_context.getData().screen_size.width / 2,
+                                  manager->getRunningAppCount()
+                              );
+            for (int i = 0; i < fling_steps; i++) {
+                if ((gesture_info->direction & Gesture::DIR_LEFT) && !manager->processRecentsScreenMoveLeft()) {
+                    ESP_UTILS_LOGE("Recents screen app move left failed");
+                } else if ((gesture_info->direction & Gesture::DIR_RIGHT) &&
+                           !manager->processRecentsScreenMoveRight()) {
+                    ESP_UTILS_LOGE("Recents screen app move right failed");
+                }
+            }
+        }
         return;
     }
 
@@ -1118,9 +1156,13 @@ void Manager::onRecentsScreenGestureReleaseEventCallback(lv_event_t *event)
     distance_move_up_threshold = -1 * data->recents_screen.drag_snapshot_y_step + 1;
     distance_move_down_threshold = -distance_move_up_threshold;
     distance_move_up_exit_threshold = -1 * data->recents_screen.delete_snapshot_y_threshold;
+    // Also close the app if the snapshot is flung up far enough
+    if ((manager->_gesture != nullptr) && (gesture_info->direction & Gesture::DIR_UP)) {
+        distance_fling_y = -manager->_gesture->getFlingSteps(*gesture_info, 1, -distance_move_up_exit_threshold);
+    }
     if ((distance_y > distance_move_up_threshold) && (distance_y < distance_move_down_threshold)) {
         state |= RECENTS_SCREEN_APP_SHOW | RECENTS_SCREEN_HIDE;
-    } else if (distance_y <= distance_move_up_exit_threshold) {
+    } else if ((distance_y + distance_fling_y) <= distance_move_up_exit_threshold) {
         state |= RECENTS_SCREEN_APP_CLOSE;
     }
 
@@ -17,6 +17,7 @@
 #include "phone/private/esp_brookesia_phone_utils.hpp"
 #include "systems/base/esp_brookesia_base_context.hpp"
 #include "lvgl/esp_brookesia_lv_helper.hpp"
+#include "lvgl/esp_brookesia_lv_render_profiler.hpp"
 #include "esp_brookesia_app_launcher.hpp"
 
 #define ESP_BROOKESIA_APP_LAUNCHER_SPOT_INACTIVE_STATE     LV_STATE_DEFAULT
@@ -100,6 +101,7 @@ bool AppLauncher::begin(lv_obj_t *parent)
     _table_obj = table_obj;
     _indicator_obj = indicator_obj;
     _mix_objs = mix_objs;
+    LvRenderProfiler::getInstance().addOwner(main_obj.get(), "AppLauncher");
 
     /* Update */
     ESP_UTILS_CHECK_FALSE_GOTO(updateByNewData(), err, "Update failed");
@@ -633,6 +635,9 @@ void AppLauncher::onDataUpdateEventCallback(lv_event_t *event)
 
     ESP_UTILS_LOGD("Data update event callback");
     ESP_UTILS_CHECK_NULL_EXIT(event, "Invalid event object");
+    if (!base::Context::checkDataUpdateSection(event, base::Context::DataSection::APP_LAUNCHER)) {
+        return;
+    }
 
     app_launcher = (AppLauncher *)lv_event_get_user_data(event);
     ESP_UTILS_CHECK_NULL_EXIT(app_launcher, "Invalid app launcher object");
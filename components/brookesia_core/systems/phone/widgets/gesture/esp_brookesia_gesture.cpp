@@ -5,11 +5,14 @@
  */
 #include <limits>
 #include <cmath>
+#include "esp_timer.h"
 #include "esp_brookesia_systems_internal.h"
 #if !ESP_BROOKESIA_PHONE_GESTURE_ENABLE_DEBUG_LOG
 #   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
 #endif
 #include "phone/private/esp_brookesia_phone_utils.hpp"
+#include "lvgl/esp_brookesia_lv_latency_monitor.hpp"
+#include "lvgl/esp_brookesia_lv_touch_input.hpp"
 #include "esp_brookesia_gesture.hpp"
 
 using namespace std;
@@ -17,6 +20,8 @@ using namespace esp_brookesia::gui;
 
 namespace esp_brookesia::systems::phone {
 
+Gesture::BoostRequestSignal Gesture::boost_request_signal;
+
 Gesture::Gesture(base::Context &core_in, const Gesture::Data &data_in)
     : core(core_in)
     , data(data_in)
@@ -33,7 +38,6 @@ Gesture::~Gesture()
 
 bool Gesture::begin(lv_obj_t *parent)
 {
-    ESP_Brookesia_LvTimer_t detect_timer = nullptr;
     ESP_Brookesia_LvObj_t event_mask_obj = nullptr;
     array<ESP_Brookesia_LvObj_t, static_cast<int>(Gesture::IndicatorBarType::MAX)> indicator_bars = {};
     array<ESP_Brookesia_LvAnim_t, static_cast<int>(Gesture::IndicatorBarType::MAX)> indicator_bar_scale_back_anims = {};
@@ -45,8 +49,6 @@ bool Gesture::begin(lv_obj_t *parent)
     ESP_UTILS_CHECK_NULL_RETURN(core.getTouchDevice(), false, "Invalid core touch device");
 
     /* Create objects */
-    detect_timer = ESP_BROOKESIA_LV_TIMER(onTouchDetectTimerCallback, data.detect_period_ms, this);
-    ESP_UTILS_CHECK_NULL_RETURN(detect_timer, false, "Create detect timer failed");
     event_mask_obj = ESP_BROOKESIA_LV_OBJ(obj, parent);
     ESP_UTILS_CHECK_NULL_RETURN(event_mask_obj, false, "Create event & mask object failed");
     press_event_code = core.getFreeEventCode();
@@ -91,9 +93,13 @@ bool Gesture::begin(lv_obj_t *parent)
         lv_anim_set_ready_cb(indicator_bar_scale_back_anims[i].get(), onIndicatorBarScaleBackAnimationReadyCallback);
     }
 
+    // Touch device, the gesture is detected from every sample it reports instead of polling it
+    lv_indev_add_event_cb(core.getTouchDevice(), onTouchDeviceEventCallback, LV_EVENT_PRESSED, this);
+    lv_indev_add_event_cb(core.getTouchDevice(), onTouchDeviceEventCallback, LV_EVENT_PRESSING, this);
+    lv_indev_add_event_cb(core.getTouchDevice(), onTouchDeviceEventCallback, LV_EVENT_RELEASED, this);
+
     // Save objects
     _touch_device = core.getTouchDevice();
-    _detect_timer = detect_timer;
     _event_mask_obj = event_mask_obj;
     _press_event_code = press_event_code;
     _pressing_event_code = pressing_event_code;
@@ -101,6 +107,10 @@ bool Gesture::begin(lv_obj_t *parent)
     _indicator_bars = indicator_bars;
     _indicator_bar_scale_back_anims = indicator_bar_scale_back_anims;
 
+    // The thresholds follow the active stylesheet
+    ESP_UTILS_CHECK_FALSE_GOTO(core.registerDateUpdateEventCallback(onDataUpdateEventCallback, this), err,
+                               "Register data update event callback failed");
+
     // Update the object style
     ESP_UTILS_CHECK_FALSE_GOTO(updateByNewData(), err, "Update failed");
 
@@ -116,9 +126,19 @@ bool Gesture::del(void)
 {
     ESP_UTILS_LOGD("Delete(0x%p)", this);
 
-    _direction_tan_threshold = 0;
+    if (checkGestureStart()) {
+        boost_request_signal(false, this);
+    }
+    if (_touch_device != nullptr) {
+        lv_indev_remove_event_cb_with_user_data(_touch_device, onTouchDeviceEventCallback, this);
+        _touch_device = nullptr;
+    }
+    if ((_event_mask_obj != nullptr) && core.checkCoreInitialized() &&
+            !core.unregisterDateUpdateEventCallback(onDataUpdateEventCallback, this)) {
+        ESP_UTILS_LOGE("Unregister data update event callback failed");
+    }
+    _direction_tan_threshold_q = 0;
     _touch_start_tick = 0;
-    _detect_timer.reset();
     resetGestureInfo();
     _event_mask_obj.reset();
     for (int i = 0; i < static_cast<int>(Gesture::IndicatorBarType::MAX); i++) {
@@ -165,6 +185,21 @@ bool Gesture::checkIndicatorBarVisible(Gesture::IndicatorBarType type) const
     return !lv_obj_has_flag(_indicator_bars[type_int].get(), LV_OBJ_FLAG_HIDDEN);
 }
 
+int Gesture::getFlingSteps(const Gesture::Info &info, int step_px, int max_steps) const
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(step_px > 0, 0, "Invalid step");
+
+    if (!info.flags.fling) {
+        return 0;
+    }
+
+    // The content keeps moving with a constant deceleration, so it travels v^2 / 2a after the release
+    int64_t velocity = (info.direction & DIR_HOR) ? info.velocity_x_px_per_s : info.velocity_y_px_per_s;
+    int64_t distance = velocity * velocity / (2 * FLING_DECELERATION_PX_PER_S2);
+
+    return static_cast<int>(min<int64_t>(distance / step_px, max_steps));
+}
+
 int Gesture::getIndicatorBarLength(Gesture::IndicatorBarType type) const
 {
     ESP_UTILS_CHECK_FALSE_RETURN(checkInitialized(), -1, "Not initialized");
@@ -391,6 +426,72 @@ void Gesture::resetGestureInfo(void)
 {
     Info reset_info = GESTURE_INFO_INIT;
     _info = reset_info;
+    _sample_head = 0;
+    _sample_count = 0;
+}
+
+void Gesture::pushSample(int x, int y, int64_t timestamp_us)
+{
+    // The press is reported twice (pressed & pressing) for the same sample
+    if ((_sample_count > 0) && (_samples[(_sample_head + SAMPLE_RING_SIZE - 1) % SAMPLE_RING_SIZE].timestamp_us ==
+                                timestamp_us)) {
+        return;
+    }
+
+    _samples[_sample_head] = {
+        .x = static_cast<int16_t>(x),
+        .y = static_cast<int16_t>(y),
+        .timestamp_us = timestamp_us,
+    };
+    _sample_head = (_sample_head + 1) % SAMPLE_RING_SIZE;
+    _sample_count = min<uint8_t>(_sample_count + 1, SAMPLE_RING_SIZE);
+}
+
+bool Gesture::estimateVelocity(int64_t now_us, int &velocity_x, int &velocity_y) const
+{
+    velocity_x = 0;
+    velocity_y = 0;
+    if (_sample_count < 2) {
+        return false;
+    }
+
+    // The finger has stayed still before leaving the panel, so there is no velocity
+    const Sample &last = _samples[(_sample_head + SAMPLE_RING_SIZE - 1) % SAMPLE_RING_SIZE];
+    if ((now_us - last.timestamp_us) > VELOCITY_WINDOW_US) {
+        return true;
+    }
+
+    // Least squares slope of x(t) and y(t) over the samples of the window, the time is relative to the last sample
+    int64_t n = 0;
+    int64_t sum_t = 0;
+    int64_t sum_tt = 0;
+    int64_t sum_x = 0;
+    int64_t sum_y = 0;
+    int64_t sum_tx = 0;
+    int64_t sum_ty = 0;
+    for (int i = 1; i <= _sample_count; i++) {
+        const Sample &sample = _samples[(_sample_head + SAMPLE_RING_SIZE - i) % SAMPLE_RING_SIZE];
+        int64_t t = sample.timestamp_us - last.timestamp_us;
+        if (-t > VELOCITY_WINDOW_US) {
+            break;
+        }
+        n++;
+        sum_t += t;
+        sum_tt += t * t;
+        sum_x += sample.x;
+        sum_y += sample.y;
+        sum_tx += t * sample.x;
+        sum_ty += t * sample.y;
+    }
+
+    int64_t denominator = n * sum_tt - sum_t * sum_t;
+    if ((n < 2) || (denominator == 0)) {
+        return false;
+    }
+    velocity_x = static_cast<int>((n * sum_tx - sum_t * sum_x) * 1000000 / denominator);
+    velocity_y = static_cast<int>((n * sum_ty - sum_t * sum_y) * 1000000 / denominator);
+
+    return true;
 }
 
 bool Gesture::updateByNewData(void)
@@ -402,8 +503,6 @@ bool Gesture::updateByNewData(void)
     int align_x_offset = 0;
     int align_y_offset = 0;
     lv_align_t align = LV_ALIGN_DEFAULT;
-    // Timer
-    lv_timer_set_period(_detect_timer.get(), data.detect_period_ms);
     // Mask
     lv_obj_set_size(_event_mask_obj.get(), core.getData().screen_size.width, core.getData().screen_size.height);
     // Indicator bar
@@ -452,8 +551,11 @@ bool Gesture::updateByNewData(void)
                                            (float)bar_range;
         lv_obj_align(_indicator_bars[i].get(), align, align_x_offset, align_y_offset);
     }
-    // Data
-    _direction_tan_threshold = tan((int)data.threshold.direction_angle * M_PI / 180);
+    // Data, the direction is checked in fixed point, so compute the tan threshold only once here
+    float direction_tan = tanf(static_cast<float>(data.threshold.direction_angle) * static_cast<float>(M_PI) / 180);
+    _direction_tan_threshold_q = static_cast<int32_t>(
+        min(direction_tan * (1 << DIRECTION_TAN_FRAC_BITS), static_cast<float>(numeric_limits<int32_t>::max()))
+    );
 
     return true;
 }
@@ -464,6 +566,9 @@ void Gesture::onDataUpdateEventCallback(lv_event_t *event)
 
     ESP_UTILS_LOGD("Data update event callback");
     ESP_UTILS_CHECK_NULL_EXIT(event, "Invalid event object");
+    if (!base::Context::checkDataUpdateSection(event, base::Context::DataSection::GESTURE)) {
+        return;
+    }
 
     gesture = (Gesture *)lv_event_get_user_data(event);
     ESP_UTILS_CHECK_NULL_EXIT(gesture, "Invalid gesture object");
@@ -471,25 +576,32 @@ void Gesture::onDataUpdateEventCallback(lv_event_t *event)
     ESP_UTILS_CHECK_FALSE_EXIT(gesture->updateByNewData(), "Update gesture object style failed");
 }
 
-void Gesture::onTouchDetectTimerCallback(struct _lv_timer_t *t)
+void Gesture::onTouchDeviceEventCallback(lv_event_t *event)
 {
     bool touched = false;
     int distance_x = 0;
     int distance_y = 0;
-    float distance_tan = numeric_limits<float>::infinity();
+    int velocity_x = 0;
+    int velocity_y = 0;
+    int64_t timestamp_us = 0;
     lv_event_code_t event_code = LV_EVENT_ALL;
 
-    Gesture *gesture = (Gesture *)t->user_data;
+    ESP_UTILS_CHECK_NULL_EXIT(event, "Invalid event object");
+
+    Gesture *gesture = (Gesture *)lv_event_get_user_data(event);
     ESP_UTILS_CHECK_NULL_EXIT(gesture, "Invalid gesture");
 
     const Gesture::Data &data = gesture->data;
     const int &display_w = gesture->core.getData().screen_size.width;
     const int &display_h = gesture->core.getData().screen_size.height;
-    const float &distance_tan_threshold = gesture->_direction_tan_threshold;
     Gesture::Info &info = gesture->_info;
 
     // Check if touched and save the last touch point
     touched = gesture->readTouchPoint(info.stop_x, info.stop_y);
+    // Prefer the time at which the point has been read if the touch device records it
+    LvTouchInput::Sample touch_sample = {};
+    timestamp_us = LvTouchInput::getLastSample(gesture->_touch_device, touch_sample) ? touch_sample.timestamp_us :
+                   esp_timer_get_time();
 
     // Process the stop area
     info.stop_area = Gesture::AREA_CENTER;
@@ -509,6 +621,7 @@ void Gesture::onTouchDetectTimerCallback(struct _lv_timer_t *t)
         gesture->_touch_start_tick = lv_tick_get();
         info.start_x = info.stop_x;
         info.start_y = info.stop_y;
+        gesture->pushSample(info.stop_x, info.stop_y, timestamp_us);
 
         // Process the start area
         info.start_area = Gesture::AREA_CENTER;
@@ -520,6 +633,7 @@ void Gesture::onTouchDetectTimerCallback(struct _lv_timer_t *t)
         // Set the press event code
         event_code = gesture->_press_event_code;
         ESP_UTILS_LOGD("Gesture send press event");
+        boost_request_signal(true, gesture);
 
         goto event_process;
     }
@@ -530,6 +644,8 @@ void Gesture::onTouchDetectTimerCallback(struct _lv_timer_t *t)
 
     // Set the event code according to the touch status
     if (touched) {
+        // The release keeps the last point, it's not a new sample
+        gesture->pushSample(info.stop_x, info.stop_y, timestamp_us);
         event_code = gesture->_pressing_event_code;
         ESP_UTILS_LOGD("Gesture send pressing event");
     } else {
@@ -545,19 +661,20 @@ void Gesture::onTouchDetectTimerCallback(struct _lv_timer_t *t)
         goto event_process;
     }
 
-    // Process the distance and speed
-    info.distance_px = (float)sqrt(distance_x * distance_x + distance_y * distance_y);
-    info.speed_px_per_ms = (info.duration_ms > 0) ? (info.distance_px / info.duration_ms) :
-                           numeric_limits<float>::infinity();
+    // Process the distance and speed, the speed is the one at the end of the gesture rather than the average one
+    info.distance_px = sqrtf(static_cast<float>(distance_x * distance_x + distance_y * distance_y));
+    gesture->estimateVelocity(timestamp_us, velocity_x, velocity_y);
+    info.velocity_x_px_per_s = velocity_x;
+    info.velocity_y_px_per_s = velocity_y;
+    info.speed_px_per_ms = sqrtf(
+                               static_cast<float>(velocity_x) * velocity_x + static_cast<float>(velocity_y) * velocity_y
+                           ) / 1000;
     info.flags.slow_speed = (info.speed_px_per_ms < data.threshold.speed_slow_px_per_ms);
 
     /* Process the direction */
-    // Calculate the tan value of the gesture
-    distance_tan = (distance_x == 0) ? numeric_limits<float>::infinity() : (float)distance_y / distance_x;
-    // Check if the tan absolute value is large enoughd
-    // if so, it means the gesture is up or down, otherwise, it's left or right
-    if ((distance_tan == numeric_limits<float>::infinity()) || (distance_tan > distance_tan_threshold) ||
-            (distance_tan < -distance_tan_threshold)) {
+    // Compare |dy / dx| with the tan threshold in Q8, if larger the gesture is up or down, otherwise left or right
+    if ((static_cast<int64_t>(abs(distance_y)) << DIRECTION_TAN_FRAC_BITS) >
+            static_cast<int64_t>(gesture->_direction_tan_threshold_q) * abs(distance_x)) {
         // Check the distance in y axis
         if (distance_y > data.threshold.direction_vertical) {
             info.direction = Gesture::DIR_DOWN;
@@ -572,21 +689,28 @@ void Gesture::onTouchDetectTimerCallback(struct _lv_timer_t *t)
             info.direction = Gesture::DIR_LEFT;
         }
     }
+    info.flags.fling = (!touched && !info.flags.slow_speed && (info.direction != Gesture::DIR_NONE));
 
 event_process:
     if (gesture->checkGestureStart()) {
         ESP_UTILS_LOGD(
-            "\n\tpoint(%d,%d->%d,%d), area(%d->%d), dir(%d), distance(%.2f), angle(%d), duration(%dms), speed(%.2f),"
-            "event(%d)", info.start_x, info.start_y, info.stop_x, info.stop_y, info.start_area, info.stop_area,
-            (int)info.direction, info.distance_px, (int)(atan(distance_tan) * -180 / M_PI), (int)info.duration_ms,
-            info.speed_px_per_ms, (int)event_code
+            "\n\tpoint(%d,%d->%d,%d), area(%d->%d), dir(%d), distance(%.2f), duration(%dms), velocity(%d,%d), "
+            "speed(%.2f), fling(%d), event(%d)", info.start_x, info.start_y, info.stop_x, info.stop_y, info.start_area,
+            info.stop_area, (int)info.direction, info.distance_px, (int)info.duration_ms, info.velocity_x_px_per_s,
+            info.velocity_y_px_per_s, info.speed_px_per_ms, (int)info.flags.fling, (int)event_code
         );
     }
 
+    // The handlers may refine the interaction, e.g. a swipe which drags a snapshot of the recents screen
+    LvLatencyMonitor::getInstance().markDispatch(
+        (info.direction == Gesture::DIR_NONE) ? LvLatencyMonitor::Interaction::Tap :
+        LvLatencyMonitor::Interaction::Swipe
+    );
     gesture->_event_data = info;
     lv_obj_send_event(gesture->_event_mask_obj.get(), event_code, (void *)&gesture->_event_data);
     if (event_code == gesture->_release_event_code) {
         gesture->resetGestureInfo();
+        boost_request_signal(false, gesture);
     }
 }
 
@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include "boost/signals2/signal.hpp"
 #include "systems/base/esp_brookesia_base_context.hpp"
 #include "lvgl/esp_brookesia_lv_helper.hpp"
 
@@ -38,7 +39,7 @@ public:
     };
 
     struct Data {
-        uint8_t detect_period_ms;
+        uint8_t detect_period_ms;   /*!< Unused, the gesture is updated by the samples of the touch device */
         struct {
             int direction_vertical;
             int direction_horizon;
@@ -81,14 +82,19 @@ public:
         int stop_x;
         int stop_y;
         uint32_t duration_ms;
-        float speed_px_per_ms;
+        float speed_px_per_ms;      /*!< Speed at the end of the gesture, see `velocity_x/y_px_per_s` */
         float distance_px;
+        int velocity_x_px_per_s;    /*!< Fit over the last samples, 0 if the finger stopped before release */
+        int velocity_y_px_per_s;
         struct {
             uint8_t slow_speed: 1;
             uint8_t short_duration: 1;
+            uint8_t fling: 1;       /*!< Released while moving faster than `speed_slow_px_per_ms` */
         } flags;
     };
 
+    using BoostRequestSignal = boost::signals2::signal<void(bool boost, Gesture *gesture)>;
+
     Gesture(base::Context &core_in, const Gesture::Data &data_in);
     ~Gesture();
 
@@ -133,6 +139,16 @@ public:
         return _release_event_code;
     }
     int getIndicatorBarLength(Gesture::IndicatorBarType type) const;
+    /**
+     * @brief Get the number of extra steps (e.g. pages) the content should move after a fling
+     *
+     * @param[in] info The gesture info of the release event
+     * @param[in] step_px The size of a step along the gesture direction
+     * @param[in] max_steps The maximum number of extra steps
+     *
+     * @return The number of extra steps, 0 if the gesture isn't a fling
+     */
+    int getFlingSteps(const Gesture::Info &info, int step_px, int max_steps) const;
 
     static bool calibrateData(const gui::StyleSize &screen_size, const base::Display &display,
                               Gesture::Data &data);
@@ -140,16 +156,29 @@ public:
     base::Context &core;
     const Gesture::Data &data;
 
+    /**
+     * @brief Emitted when a touch starts (`true`) and ends (`false`), e.g. to raise the CPU frequency during gestures
+     */
+    static BoostRequestSignal boost_request_signal;
+
 private:
     using IndicatorBarAnimVar_t = struct {
         Gesture *gesture;
         Gesture::IndicatorBarType type;
     };
+    struct Sample {
+        int16_t x;
+        int16_t y;
+        int64_t timestamp_us;
+    };
+
     void resetGestureInfo(void);
     bool updateByNewData(void);
+    void pushSample(int x, int y, int64_t timestamp_us);
+    bool estimateVelocity(int64_t now_us, int &velocity_x, int &velocity_y) const;
 
     static void onDataUpdateEventCallback(lv_event_t *event);
-    static void onTouchDetectTimerCallback(struct _lv_timer_t *t);
+    static void onTouchDeviceEventCallback(lv_event_t *event);
     static void onIndicatorBarScaleBackAnimationExecuteCallback(void *var, int32_t value);
     static void onIndicatorBarScaleBackAnimationReadyCallback(lv_anim_t *anim);
 
@@ -163,11 +192,18 @@ private:
         .stop_y = -1,
         .duration_ms = 0,
         .distance_px = 0,
+        .velocity_x_px_per_s = 0,
+        .velocity_y_px_per_s = 0,
         .flags = {
             .slow_speed = 0,
             .short_duration = 0,
+            .fling = 0,
         },
     };
+    static constexpr int SAMPLE_RING_SIZE = 16;
+    static constexpr int64_t VELOCITY_WINDOW_US = 80 * 1000;
+    static constexpr int DIRECTION_TAN_FRAC_BITS = 8;
+    static constexpr int64_t FLING_DECELERATION_PX_PER_S2 = 8000;
 
     // Core
     lv_indev_t *_touch_device = nullptr;
@@ -175,11 +211,10 @@ private:
     struct {
         std::array<bool, static_cast<int>(Gesture::IndicatorBarType::MAX)>  is_indicator_bar_scale_back_anim_running;
     } _flags = {};
-    float _direction_tan_threshold = 0;
+    int32_t _direction_tan_threshold_q = 0;
     std::array<int, static_cast<int>(Gesture::IndicatorBarType::MAX)>  _indicator_bar_min_lengths;
     std::array<int, static_cast<int>(Gesture::IndicatorBarType::MAX)>  _indicator_bar_max_lengths;
     uint32_t _touch_start_tick = 0;
-    ESP_Brookesia_LvTimer_t _detect_timer;
     ESP_Brookesia_LvObj_t _event_mask_obj;
     std::array<ESP_Brookesia_LvObj_t, static_cast<int>(Gesture::IndicatorBarType::MAX)>  _indicator_bars;
     std::array<IndicatorBarAnimVar_t, static_cast<int>(Gesture::IndicatorBarType::MAX)>  _indicator_bar_anim_var;
@@ -190,6 +225,9 @@ private:
     lv_event_code_t _release_event_code = LV_EVENT_ALL;
     Info _info = GESTURE_INFO_INIT;
     Info _event_data = GESTURE_INFO_INIT;
+    std::array<Sample, SAMPLE_RING_SIZE> _samples = {};
+    uint8_t _sample_head = 0;
+    uint8_t _sample_count = 0;
 };
 
 } // namespace esp_brookesia::systems::phone
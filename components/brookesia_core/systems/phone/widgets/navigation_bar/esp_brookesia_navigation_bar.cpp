@@ -9,6 +9,7 @@
 #   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
 #endif
 #include "phone/private/esp_brookesia_phone_utils.hpp"
+#include "lvgl/esp_brookesia_lv_render_profiler.hpp"
 #include "esp_brookesia_navigation_bar.hpp"
 
 using namespace std;
@@ -138,6 +139,7 @@ bool NavigationBar::begin(lv_obj_t *parent)
     _visual_flex_hide_timer = visual_flex_hide_timer;
     _visual_flex_show_anim = visual_flex_show_anim;
     _visual_flex_hide_anim = visual_flex_hide_anim;
+    LvRenderProfiler::getInstance().addOwner(main_obj.get(), "NavigationBar");
 
     /* Update */
     ESP_UTILS_CHECK_FALSE_GOTO(updateByNewData(), err, "Update by new data failed");
@@ -524,6 +526,9 @@ void NavigationBar::onDataUpdateEventCallback(lv_event_t *event)
 
     ESP_UTILS_LOGD("Data update event callback");
     ESP_UTILS_CHECK_NULL_EXIT(event, "Invalid event object");
+    if (!base::Context::checkDataUpdateSection(event, base::Context::DataSection::NAVIGATION_BAR)) {
+        return;
+    }
 
     navigation_bar = (NavigationBar *)lv_event_get_user_data(event);
     ESP_UTILS_CHECK_NULL_EXIT(navigation_bar, "Invalid navigation bar object");
@@ -9,6 +9,7 @@
 #   define ESP_BROOKESIA_UTILS_DISABLE_DEBUG_LOG
 #endif
 #include "phone/private/esp_brookesia_phone_utils.hpp"
+#include "lvgl/esp_brookesia_lv_render_profiler.hpp"
 #include "esp_brookesia_recents_screen.hpp"
 
 #define MEMORY_LABEL_TEXT_FORMAT        "%d + %d %s of %d + %d %s available"
@@ -115,6 +116,7 @@ bool RecentsScreen::begin(lv_obj_t *parent)
     _trash_obj = trash_obj;
     _trash_icon = trash_icon;
     _snapshot_deleted_event_code = _system_context.getFreeEventCode();
+    LvRenderProfiler::getInstance().addOwner(main_obj.get(), "RecentsScreen");
 
     // Update
     ESP_UTILS_CHECK_FALSE_GOTO(updateByNewData(), err, "Update failed");
@@ -283,6 +285,17 @@ bool RecentsScreen::setMemoryLabel(int internal_free, int internal_total, int ex
     return true;
 }
 
+bool RecentsScreen::setMemoryLabelText(const char *text) const
+{
+    ESP_UTILS_LOGD("Set memory label text");
+    ESP_UTILS_CHECK_FALSE_RETURN(_memory_label != nullptr, false, "Memory label is disabled");
+    ESP_UTILS_CHECK_NULL_RETURN(text, false, "Invalid text");
+
+    lv_label_set_text(_memory_label.get(), text);
+
+    return true;
+}
+
 bool RecentsScreen::checkSnapshotExist(int id) const
 {
     auto it = _id_snapshot_map.find(id);
@@ -579,6 +592,9 @@ void RecentsScreen::onDataUpdateEventCallback(lv_event_t *event)
 
     ESP_UTILS_LOGD("Data update event");
     ESP_UTILS_CHECK_NULL_EXIT(event, "Invalid event object");
+    if (!base::Context::checkDataUpdateSection(event, base::Context::DataSection::RECENTS_SCREEN)) {
+        return;
+    }
 
     recents_screen = (RecentsScreen *)lv_event_get_user_data(event);
     ESP_UTILS_CHECK_NULL_EXIT(recents_screen, "Invalid app snapshot_table object");
@@ -68,6 +68,10 @@ public:
     bool moveSnapshotY(int id, int y);
     bool updateSnapshotImage(int id);
     bool setMemoryLabel(int internal_free, int internal_total, int external_free, int external_total) const;
+    /**
+     * @brief Replace the memory usage shown by the memory label with any text, e.g. the render profiler overlay
+     */
+    bool setMemoryLabelText(const char *text) const;
 
     bool checkInitialized(void) const
     {
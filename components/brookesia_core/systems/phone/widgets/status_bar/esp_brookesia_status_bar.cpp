@@ -12,6 +12,7 @@
 #include "phone/private/esp_brookesia_phone_utils.hpp"
 #include "systems/base/esp_brookesia_base_context.hpp"
 #include "lvgl/esp_brookesia_lv_helper.hpp"
+#include "lvgl/esp_brookesia_lv_render_profiler.hpp"
 #include "esp_brookesia_status_bar.hpp"
 
 using namespace std;
@@ -312,6 +313,7 @@ bool StatusBar::beginMain(lv_obj_t *parent)
     /* Save objects */
     _main_obj = main_obj;
     _area_objs = area_objs;
+    LvRenderProfiler::getInstance().addOwner(main_obj.get(), "StatusBar");
 
     /* Update */
     ESP_UTILS_CHECK_FALSE_GOTO(updateMainByNewData(), err, "Update main failed");
@@ -711,6 +713,9 @@ void StatusBar::onDataUpdateEventCallback(lv_event_t *event)
     StatusBar *status_bar = nullptr;
 
     ESP_UTILS_CHECK_NULL_EXIT(event, "Invalid event object");
+    if (!base::Context::checkDataUpdateSection(event, base::Context::DataSection::STATUS_BAR)) {
+        return;
+    }
 
     ESP_UTILS_LOGD("Data update event callback");
     status_bar = (StatusBar *)lv_event_get_user_data(event);
@@ -0,0 +1,24 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+// 4x4 checker, packed into the assets partition of the test app. Its file name is longer than the default
+// `CONFIG_MMAP_FILE_NAME_LENGTH` of esp_mmap_assets, like the SquareLine images
+
+#include "lvgl.h"
+
+const uint8_t test_assets_long_name_png_data[] = {
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+};
+const lv_image_dsc_t test_assets_long_name_png = {
+    .header.w = 4,
+    .header.h = 4,
+    .data_size = sizeof(test_assets_long_name_png_data),
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .data = test_assets_long_name_png_data
+};
@@ -3,9 +3,12 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <cstring>
+#include <vector>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "esp_log.h"
 #include "unity.h"
 #include "unity_test_runner.h"
@@ -19,6 +22,17 @@ using namespace esp_brookesia::systems::phone;
 #define TEST_LVGL_RESOLUTION_WIDTH          CONFIG_TEST_LVGL_RESOLUTION_WIDTH
 #define TEST_LVGL_RESOLUTION_HEIGHT         CONFIG_TEST_LVGL_RESOLUTION_HEIGHT
 #define TEST_INSTALL_UNINSTALL_APP_TIMES    (10)
+#define TEST_LATENCY_REPLAY_TIMES           (10)
+#define TEST_LATENCY_SAMPLE_PERIOD_MS       (10)
+#define TEST_LATENCY_SWIPE_SAMPLES          (10)
+#define TEST_WATCHFACE_SIZE                 (100)
+#define TEST_PROFILER_FRAME_NUM             (4)
+#define TEST_PROFILER_TOP_NUM               (4)
+#define TEST_IMAGE_REDRAW_TIMES             (10)
+#define TEST_SNAPSHOT_BAND_ROWS             (50)
+#define TEST_RESOURCE_SCREEN_RATIO          (10)
+#define TEST_EVENT_OBJECT_NUM               (64)
+#define TEST_EVENT_SEND_TIMES               (10000)
 
 /* Try using a stylesheet that corresponds to the resolution */
 #if (TEST_LVGL_RESOLUTION_WIDTH == 320) && (TEST_LVGL_RESOLUTION_HEIGHT == 240)
@@ -95,6 +109,982 @@ TEST_CASE("test esp-brookesia to add stylesheet", "[esp-brookesia][phone][add_st
 }
 #endif
 
+#ifdef TEST_ESP_BROOKESIA_PHONE_DARK_STYLESHEET
+TEST_CASE("test esp-brookesia to apply stylesheet without adding it", "[esp-brookesia][phone][apply_stylesheet]")
+{
+    lv_display_t *disp = nullptr;
+    lv_indev_t *tp = nullptr;
+    systems::phone::Phone *phone = nullptr;
+    auto heap_used = [](size_t heap_free) {
+        return static_cast<int>(heap_free - heap_caps_get_free_size(MALLOC_CAP_DEFAULT));
+    };
+
+    test_lvgl_init(&disp, &tp);
+
+    ESP_LOGI(TAG, "Add and activate the stylesheet");
+    phone = test_esp_brookesia_phone_init(disp, tp, false);
+    size_t heap_free = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    int64_t start_us = esp_timer_get_time();
+    TEST_ASSERT_TRUE_MESSAGE(phone->addStylesheet(TEST_ESP_BROOKESIA_PHONE_DARK_STYLESHEET()),
+                             "Failed to add phone stylesheet");
+    TEST_ASSERT_TRUE_MESSAGE(phone->activateStylesheet(TEST_ESP_BROOKESIA_PHONE_DARK_STYLESHEET()),
+                             "Failed to active phone stylesheet");
+    ESP_LOGI(TAG, "Add and activate: %dus, %d bytes", static_cast<int>(esp_timer_get_time() - start_us),
+             heap_used(heap_free));
+    TEST_ASSERT_TRUE_MESSAGE(phone->begin(), "Failed to begin phone");
+    test_esp_brookesia_phone_deinit(phone);
+
+    ESP_LOGI(TAG, "Apply the stylesheet");
+    phone = test_esp_brookesia_phone_init(disp, tp, false);
+    heap_free = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    start_us = esp_timer_get_time();
+    TEST_ASSERT_TRUE_MESSAGE(phone->applyStylesheet(TEST_ESP_BROOKESIA_PHONE_DARK_STYLESHEET()),
+                             "Failed to apply phone stylesheet");
+    ESP_LOGI(TAG, "Apply: %dus, %d bytes", static_cast<int>(esp_timer_get_time() - start_us), heap_used(heap_free));
+    TEST_ASSERT_EQUAL_MESSAGE(0, phone->getStylesheetCount(), "Stylesheet stored");
+    TEST_ASSERT_TRUE_MESSAGE(phone->begin(), "Failed to begin phone");
+    TEST_ASSERT_EQUAL_MESSAGE(0, phone->getStylesheetCount(), "Default stylesheet added");
+    systems::phone::Stylesheet calibrated = *phone->getStylesheet();
+    test_esp_brookesia_phone_deinit(phone);
+
+    ESP_LOGI(TAG, "Apply the stylesheet resolved at compile time");
+    constexpr systems::phone::Stylesheet resolved = systems::phone::Phone::resolveStylesheet(
+                TEST_ESP_BROOKESIA_PHONE_DARK_STYLESHEET(), {TEST_LVGL_RESOLUTION_WIDTH, TEST_LVGL_RESOLUTION_HEIGHT}
+            );
+    static_assert(resolved.core.screen_size.width == TEST_LVGL_RESOLUTION_WIDTH, "Screen size not resolved");
+    phone = test_esp_brookesia_phone_init(disp, tp, false);
+    heap_free = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    start_us = esp_timer_get_time();
+    TEST_ASSERT_TRUE_MESSAGE(phone->applyStylesheet(resolved), "Failed to apply resolved phone stylesheet");
+    ESP_LOGI(TAG, "Apply resolved: %dus, %d bytes", static_cast<int>(esp_timer_get_time() - start_us),
+             heap_used(heap_free));
+    TEST_ASSERT_TRUE_MESSAGE(phone->begin(), "Failed to begin phone");
+    // The sizes resolved at compile time are the ones calibrated at runtime
+    auto check_size = [](const gui::StyleSize & expected, const gui::StyleSize & actual) {
+        TEST_ASSERT_EQUAL(expected.width, actual.width);
+        TEST_ASSERT_EQUAL(expected.height, actual.height);
+        TEST_ASSERT_EQUAL(expected.radius, actual.radius);
+    };
+    auto active = phone->getStylesheet();
+    check_size(calibrated.core.screen_size, active->core.screen_size);
+    check_size(calibrated.display.status_bar.data.main.size_min, active->display.status_bar.data.main.size_min);
+    check_size(calibrated.display.status_bar.data.main.size_max, active->display.status_bar.data.main.size_max);
+    check_size(
+        calibrated.display.navigation_bar.data.main.size_min, active->display.navigation_bar.data.main.size_min
+    );
+    check_size(
+        calibrated.display.navigation_bar.data.main.size_max, active->display.navigation_bar.data.main.size_max
+    );
+    test_esp_brookesia_phone_deinit(phone);
+
+    test_lvgl_deinit(disp, tp);
+}
+
+TEST_CASE("test esp-brookesia stylesheet switch updates changed sections", "[esp-brookesia][phone][stylesheet_switch]")
+{
+    using systems::phone::Stylesheet;
+    using DataSection = systems::base::Context::DataSection;
+
+    lv_display_t *disp = nullptr;
+    lv_indev_t *tp = nullptr;
+    systems::phone::Phone *phone = nullptr;
+
+    test_lvgl_init(&disp, &tp);
+    phone = test_esp_brookesia_phone_init(disp, tp, true);
+
+    // Variants of the stylesheet, which differ by a single section
+    auto base_stylesheet = new Stylesheet(TEST_ESP_BROOKESIA_PHONE_DARK_STYLESHEET());
+    TEST_ASSERT_NOT_NULL_MESSAGE(base_stylesheet, "Failed to create stylesheet");
+    base_stylesheet->core.name = "test_base";
+    auto status_bar_stylesheet = new Stylesheet(*base_stylesheet);
+    TEST_ASSERT_NOT_NULL_MESSAGE(status_bar_stylesheet, "Failed to create stylesheet");
+    status_bar_stylesheet->core.name = "test_status_bar";
+    status_bar_stylesheet->display.status_bar.data.main.background_color.opacity /= 2;
+    auto core_stylesheet = new Stylesheet(*base_stylesheet);
+    TEST_ASSERT_NOT_NULL_MESSAGE(core_stylesheet, "Failed to create stylesheet");
+    core_stylesheet->core.name = "test_core";
+    core_stylesheet->core.display.background.color.color ^= 0xFFFFFF;
+
+    // Record the sections whose widgets are updated, as they check it
+    static uint32_t updated_sections = 0;
+    auto data_update_cb = [](lv_event_t *e) {
+        for (int i = 0; i < static_cast<int>(DataSection::MAX); i++) {
+            if (Phone::checkDataUpdateSection(e, static_cast<DataSection>(i))) {
+                updated_sections |= Phone::getDataSectionBit(static_cast<DataSection>(i));
+            }
+        }
+    };
+    TEST_ASSERT_TRUE(phone->registerDateUpdateEventCallback(data_update_cb, nullptr));
+
+    const uint32_t all_sections = Phone::DATA_SECTIONS_ALL;
+    const struct {
+        Stylesheet *stylesheet;
+        uint32_t updated_sections;
+    } switches[] = {
+        {base_stylesheet, 0},   // Not checked, it depends on the stylesheet of the phone
+        {status_bar_stylesheet, Phone::getDataSectionBit(DataSection::STATUS_BAR)},
+        {core_stylesheet, all_sections},
+        {base_stylesheet, all_sections},
+    };
+    auto refr_timer = lv_display_get_refr_timer(disp);
+    for (size_t i = 0; i < sizeof(switches) / sizeof(switches[0]); i++) {
+        auto stylesheet = switches[i].stylesheet;
+        TEST_ASSERT_TRUE_MESSAGE(phone->addStylesheet(stylesheet), "Failed to add stylesheet");
+        // Idle screen, the refresh timer is parked as by the scheduler
+        lv_timer_pause(refr_timer);
+        updated_sections = 0;
+        TEST_ASSERT_TRUE_MESSAGE(phone->activateStylesheet(stylesheet), "Failed to activate stylesheet");
+        // The widgets are updated at the start of the frame which the switch requests, before its layout pass
+        lv_timer_handler();
+        ESP_LOGI(TAG, "Switch to stylesheet(%s): sections(0x%x), %dus", stylesheet->core.name,
+                 static_cast<int>(updated_sections), static_cast<int>(phone->getDataUpdateTimeUs()));
+        if (i > 0) {
+            TEST_ASSERT_EQUAL_HEX32(switches[i].updated_sections, updated_sections);
+        }
+    }
+    TEST_ASSERT_TRUE(phone->unregisterDateUpdateEventCallback(data_update_cb, nullptr));
+
+    delete base_stylesheet;
+    delete status_bar_stylesheet;
+    delete core_stylesheet;
+    test_esp_brookesia_phone_deinit(phone);
+    test_lvgl_deinit(disp, tp);
+}
+#endif
+
+static lv_indev_data_t test_touch_data = {};
+
+static void test_latency_replay_sample(lv_indev_t *tp, int x, int y, bool pressed)
+{
+    test_touch_data.point.x = x;
+    test_touch_data.point.y = y;
+    test_touch_data.state = pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+
+    // There is no touch IRQ, the sample starts with its read
+    int64_t now_us = esp_timer_get_time();
+    gui::LvLatencyMonitor::getInstance().beginProbe(now_us, now_us);
+    lv_indev_read(tp);
+    lv_timer_handler();
+    lv_refr_now(nullptr);
+    vTaskDelay(pdMS_TO_TICKS(TEST_LATENCY_SAMPLE_PERIOD_MS));
+}
+
+TEST_CASE("test esp-brookesia touch latency with replayed touch traces", "[esp-brookesia][phone][latency]")
+{
+    lv_display_t *disp = nullptr;
+    lv_indev_t *tp = nullptr;
+    systems::phone::Phone *phone = nullptr;
+    using Monitor = gui::LvLatencyMonitor;
+    auto &monitor = Monitor::getInstance();
+
+    test_lvgl_init(&disp, &tp);
+    // Headless display, the flushing is done as soon as it starts
+    lv_display_set_flush_cb(disp, [](lv_display_t *disp, const lv_area_t *area, uint8_t *color_p) {
+        lv_display_flush_ready(disp);
+    });
+    lv_indev_set_read_cb(tp, [](lv_indev_t *indev, lv_indev_data_t *data) {
+        data->point = test_touch_data.point;
+        data->state = test_touch_data.state;
+    });
+    lv_tick_set_cb([]() {
+        return static_cast<uint32_t>(esp_timer_get_time() / 1000);
+    });
+    phone = test_esp_brookesia_phone_init(disp, tp, true);
+    TEST_ASSERT_TRUE_MESSAGE(monitor.begin({.history_size = 64}, disp), "Failed to begin latency monitor");
+
+    // Redraw a label under the finger, like a UI giving feedback to every sample
+    lv_obj_t *label = lv_label_create(lv_layer_top());
+    TEST_ASSERT_NOT_NULL_MESSAGE(label, "Failed to create label");
+    auto on_touch = [](lv_event_t *e) {
+        lv_point_t point = {};
+        lv_indev_get_point(lv_indev_active(), &point);
+        lv_obj_t *label = static_cast<lv_obj_t *>(lv_event_get_user_data(e));
+        lv_label_set_text_fmt(label, "%d,%d", static_cast<int>(point.x), static_cast<int>(point.y));
+        lv_obj_set_pos(label, point.x, point.y);
+    };
+    lv_indev_add_event_cb(tp, on_touch, LV_EVENT_PRESSED, label);
+    lv_indev_add_event_cb(tp, on_touch, LV_EVENT_PRESSING, label);
+
+    int w = TEST_LVGL_RESOLUTION_WIDTH;
+    int h = TEST_LVGL_RESOLUTION_HEIGHT;
+    for (int i = 0; i < TEST_LATENCY_REPLAY_TIMES; i++) {
+        ESP_LOGD(TAG, "Replay tap");
+        test_latency_replay_sample(tp, w / 2, h / 2, true);
+        test_latency_replay_sample(tp, w / 2, h / 2, true);
+        test_latency_replay_sample(tp, w / 2, h / 2, false);
+
+        ESP_LOGD(TAG, "Replay swipe");
+        for (int j = 0; j <= TEST_LATENCY_SWIPE_SAMPLES; j++) {
+            test_latency_replay_sample(tp, w * 4 / 5 - (w * 3 / 5) * j / TEST_LATENCY_SWIPE_SAMPLES, h / 2, true);
+        }
+        test_latency_replay_sample(tp, w / 5, h / 2, false);
+    }
+    monitor.dump();
+
+    Monitor::Percentiles tap = {};
+    Monitor::Percentiles swipe = {};
+    TEST_ASSERT_TRUE(monitor.getPercentiles(Monitor::Interaction::Tap, Monitor::Stage::Flush, tap));
+    TEST_ASSERT_TRUE(monitor.getPercentiles(Monitor::Interaction::Swipe, Monitor::Stage::Flush, swipe));
+    TEST_ASSERT_GREATER_THAN_MESSAGE(0, tap.count, "No tap has been measured");
+    TEST_ASSERT_GREATER_THAN_MESSAGE(0, swipe.count, "No swipe has been measured");
+    TEST_ASSERT_LESS_OR_EQUAL(tap.p90_us, tap.p50_us);
+    TEST_ASSERT_LESS_OR_EQUAL(swipe.p99_us, swipe.p90_us);
+
+    TEST_ASSERT_TRUE_MESSAGE(monitor.del(), "Failed to delete latency monitor");
+    lv_obj_delete(label);
+    test_esp_brookesia_phone_deinit(phone);
+    test_lvgl_deinit(disp, tp);
+}
+
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+TEST_CASE("test esp-brookesia watchface redraws the due layers only", "[esp-brookesia][gui][watchface]")
+{
+    lv_display_t *disp = nullptr;
+    lv_indev_t *tp = nullptr;
+
+    test_lvgl_init(&disp, &tp);
+
+    // Static dial, hour hand moving every minute, second hand and time text
+    struct __attribute__((packed)) {
+        esp_brookesia_watchface_header_t header;
+        esp_brookesia_watchface_layer_t layers[4];
+    } face = {
+        .header = {
+            .magic = ESP_BROOKESIA_WATCHFACE_MAGIC,
+            .version = ESP_BROOKESIA_WATCHFACE_VERSION,
+            .layer_num = 4,
+            .width = TEST_WATCHFACE_SIZE,
+            .height = TEST_WATCHFACE_SIZE,
+            .bg_color = 0x000000,
+            .size = sizeof(face),
+        },
+        .layers = {
+            {
+                .type = ESP_BROOKESIA_WATCHFACE_LAYER_FILL, .cadence = ESP_BROOKESIA_WATCHFACE_CADENCE_STATIC,
+                .opa = LV_OPA_COVER, .x = 0, .y = 0, .w = TEST_WATCHFACE_SIZE, .h = TEST_WATCHFACE_SIZE,
+                .color = 0x202020, .param = TEST_WATCHFACE_SIZE / 2,
+            },
+            {
+                .type = ESP_BROOKESIA_WATCHFACE_LAYER_HAND, .cadence = ESP_BROOKESIA_WATCHFACE_CADENCE_MINUTE,
+                .source = ESP_BROOKESIA_WATCHFACE_HAND_HOUR, .opa = LV_OPA_COVER, .x = TEST_WATCHFACE_SIZE / 2,
+                .y = TEST_WATCHFACE_SIZE / 2, .w = 4, .h = TEST_WATCHFACE_SIZE / 4, .color = 0xffffff,
+            },
+            {
+                .type = ESP_BROOKESIA_WATCHFACE_LAYER_HAND, .cadence = ESP_BROOKESIA_WATCHFACE_CADENCE_SECOND,
+                .source = ESP_BROOKESIA_WATCHFACE_HAND_SECOND, .opa = LV_OPA_COVER, .x = TEST_WATCHFACE_SIZE / 2,
+                .y = TEST_WATCHFACE_SIZE / 2, .w = 2, .h = TEST_WATCHFACE_SIZE * 2 / 5, .color = 0xff0000,
+                .param = 10,
+            },
+            {
+                .type = ESP_BROOKESIA_WATCHFACE_LAYER_TEXT, .cadence = ESP_BROOKESIA_WATCHFACE_CADENCE_MINUTE,
+                .source = ESP_BROOKESIA_WATCHFACE_TEXT_TIME, .opa = LV_OPA_COVER, .x = 0,
+                .y = TEST_WATCHFACE_SIZE * 3 / 4, .w = TEST_WATCHFACE_SIZE, .h = 20, .color = 0xffffff,
+                .param = 14,
+            },
+        },
+    };
+
+    gui::Watchface watchface;
+    gui::LvObject screen(lv_screen_active(), false);
+    TEST_ASSERT_TRUE_MESSAGE(watchface.loadFromMemory(&face, sizeof(face)), "Failed to load watchface");
+    TEST_ASSERT_TRUE_MESSAGE(watchface.begin(&screen), "Failed to begin watchface");
+
+    struct tm time = {};
+    time.tm_hour = 10;
+    time.tm_min = 8;
+    TEST_ASSERT_TRUE(watchface.update(time));
+    auto full_px = watchface.getStats().redraw_px;
+    TEST_ASSERT_EQUAL_UINT32(TEST_WATCHFACE_SIZE * TEST_WATCHFACE_SIZE, full_px);
+
+    ESP_LOGI(TAG, "Only the second hand moves within a minute");
+    watchface.resetStats();
+    time.tm_sec = 1;
+    TEST_ASSERT_TRUE(watchface.update(time));
+    TEST_ASSERT_GREATER_THAN_UINT32(0, watchface.getStats().redraw_px);
+    TEST_ASSERT_LESS_THAN_UINT32(full_px / 2, watchface.getStats().redraw_px);
+
+    ESP_LOGI(TAG, "Nothing is redrawn at the same time");
+    watchface.resetStats();
+    TEST_ASSERT_TRUE(watchface.update(time));
+    TEST_ASSERT_EQUAL_UINT32(0, watchface.getStats().redraw_px);
+
+    ESP_LOGI(TAG, "The minute layers are redrawn on the next minute");
+    time.tm_min = 9;
+    time.tm_sec = 0;
+    TEST_ASSERT_TRUE(watchface.update(time));
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(3, watchface.getStats().draw_op_count);
+    watchface.dump();
+
+    TEST_ASSERT_TRUE_MESSAGE(watchface.del(), "Failed to delete watchface");
+    watchface.unload();
+
+    ESP_LOGI(TAG, "A face with a font size not built fails to load");
+    face.layers[3].param = 13;
+    TEST_ASSERT_FALSE(watchface.loadFromMemory(&face, sizeof(face)));
+    TEST_ASSERT_FALSE(watchface.isLoaded());
+
+    ESP_LOGI(TAG, "Load the face packed by `tools/lv_watchface_packer.py` into the assets partition");
+    auto &assets = gui::LvAssets::getInstance();
+    TEST_ASSERT_TRUE(assets.addPartition({
+        .partition_label = "assets",
+        .max_files = TEST_ASSETS_FILE_NUM,
+        .checksum = 0,
+    }));
+    size_t packed_size = 0;
+    auto packed_face = assets.getFile("analog", &packed_size);
+    TEST_ASSERT_NOT_NULL_MESSAGE(packed_face, "Face not packed");
+    TEST_ASSERT_TRUE_MESSAGE(watchface.loadFromMemory(packed_face, packed_size), "Failed to load packed face");
+    TEST_ASSERT_TRUE(watchface.begin(&screen));
+    TEST_ASSERT_TRUE(watchface.update(time));
+    watchface.resetStats();
+
+    ESP_LOGI(TAG, "Only the complication is redrawn for its new value");
+    watchface.setComplicationValue(0, 50);
+    TEST_ASSERT_TRUE(watchface.update(time));
+    // The 60x60 gauge of `analog.json`
+    TEST_ASSERT_EQUAL_UINT32(60 * 60, watchface.getStats().redraw_px);
+    watchface.resetStats();
+    watchface.setComplicationValue(0, 50);
+    TEST_ASSERT_TRUE(watchface.update(time));
+    TEST_ASSERT_EQUAL_UINT32(0, watchface.getStats().redraw_px);
+
+    TEST_ASSERT_TRUE(watchface.del());
+    watchface.unload();
+    TEST_ASSERT_TRUE(assets.del());
+
+    test_lvgl_deinit(disp, tp);
+}
+#endif
+
+TEST_CASE("test esp-brookesia render profiler records the refreshed frames", "[esp-brookesia][gui][profiler]")
+{
+    lv_display_t *disp = nullptr;
+    lv_indev_t *tp = nullptr;
+    systems::phone::Phone *phone = nullptr;
+    auto &profiler = gui::LvRenderProfiler::getInstance();
+
+    test_lvgl_init(&disp, &tp);
+    // Headless display, the flushing is done as soon as it starts
+    lv_display_set_flush_cb(disp, [](lv_display_t *disp, const lv_area_t *area, uint8_t *color_p) {
+        lv_display_flush_ready(disp);
+    });
+    phone = test_esp_brookesia_phone_init(disp, tp, true);
+    TEST_ASSERT_TRUE_MESSAGE(
+        profiler.begin({.frame_num = TEST_PROFILER_FRAME_NUM, .top_num = TEST_PROFILER_TOP_NUM}, disp),
+        "Failed to begin render profiler"
+    );
+
+    // More frames than the ring buffer keeps
+    for (int i = 0; i < TEST_PROFILER_FRAME_NUM * 2; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(disp);
+    }
+    profiler.dump();
+    TEST_ASSERT_TRUE(profiler.dumpTrace(stdout));
+
+    TEST_ASSERT_EQUAL_MESSAGE(TEST_PROFILER_FRAME_NUM, profiler.getFrameNum(), "Ring buffer is not full");
+    auto frame = profiler.getFrame(profiler.getFrameNum() - 1);
+    TEST_ASSERT_NOT_NULL(frame);
+    TEST_ASSERT_NULL(profiler.getFrame(profiler.getFrameNum()));
+    TEST_ASSERT_EQUAL_UINT32(TEST_LVGL_RESOLUTION_WIDTH * TEST_LVGL_RESOLUTION_HEIGHT, frame->flushed_px);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(frame->flushed_px, frame->invalidated_px);
+    TEST_ASSERT_FALSE_MESSAGE(frame->objects.empty(), "No object has been measured");
+    TEST_ASSERT_LESS_OR_EQUAL(TEST_PROFILER_TOP_NUM, frame->objects.size());
+    for (size_t i = 1; i < frame->objects.size(); i++) {
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(frame->objects[i - 1].draw_us, frame->objects[i].draw_us);
+    }
+
+    TEST_ASSERT_TRUE_MESSAGE(profiler.del(), "Failed to delete render profiler");
+    test_esp_brookesia_phone_deinit(phone);
+    test_lvgl_deinit(disp, tp);
+}
+
+LV_IMG_DECLARE(esp_brookesia_image_large_app_launcher_default_112_112);
+
+/* Same format as `lv_rle_decompress()`, see `tools/lv_image_converter.py` */
+static size_t test_image_rle_compress(const uint8_t *in, size_t size, size_t blk_size, uint8_t *out)
+{
+    size_t blk_num = size / blk_size;
+    size_t out_size = 0;
+    size_t i = 0;
+    while (i < blk_num) {
+        size_t run = 1;
+        while ((i + run < blk_num) && (run < 0x7f) && !memcmp(in + (i + run) * blk_size, in + i * blk_size, blk_size)) {
+            run++;
+        }
+        if (run > 1) {
+            out[out_size++] = run;
+            memcpy(out + out_size, in + i * blk_size, blk_size);
+            out_size += blk_size;
+            i += run;
+            continue;
+        }
+        size_t start = i;
+        while ((i < blk_num) && (i - start < 0x7f) &&
+                ((i + 1 >= blk_num) || memcmp(in + (i + 1) * blk_size, in + i * blk_size, blk_size))) {
+            i++;
+        }
+        if (i == start) {
+            continue;
+        }
+        out[out_size++] = 0x80 | (i - start);
+        memcpy(out + out_size, in + start * blk_size, (i - start) * blk_size);
+        out_size += (i - start) * blk_size;
+    }
+    return out_size;
+}
+
+TEST_CASE("test esp-brookesia image formats flash size and draw time", "[esp-brookesia][gui][image]")
+{
+    lv_display_t *disp = nullptr;
+    lv_indev_t *tp = nullptr;
+    const lv_image_dsc_t &src = esp_brookesia_image_large_app_launcher_default_112_112;
+    uint32_t w = src.header.w;
+    uint32_t h = src.header.h;
+
+    test_lvgl_init(&disp, &tp);
+    // Headless display, the flushing is done as soon as it starts
+    lv_display_set_flush_cb(disp, [](lv_display_t *disp, const lv_area_t *area, uint8_t *color_p) {
+        lv_display_flush_ready(disp);
+    });
+
+    ESP_LOGI(TAG, "Convert the ARGB8888 icon to RGB565A8, then compress it with RLE");
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_ARGB8888, src.header.cf);
+    size_t rgb565a8_size = w * h * 3;
+    uint8_t *rgb565a8 = static_cast<uint8_t *>(malloc(rgb565a8_size));
+    TEST_ASSERT_NOT_NULL(rgb565a8);
+    for (uint32_t y = 0; y < h; y++) {
+        for (uint32_t x = 0; x < w; x++) {
+            const uint8_t *px = src.data + y * src.header.stride + x * 4;
+            uint16_t color = ((px[2] & 0xf8) << 8) | ((px[1] & 0xfc) << 3) | (px[0] >> 3);
+            memcpy(rgb565a8 + (y * w + x) * 2, &color, sizeof(color));
+            rgb565a8[w * h * 2 + y * w + x] = px[3];
+        }
+    }
+    lv_image_dsc_t rgb565a8_dsc = {};
+    rgb565a8_dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    rgb565a8_dsc.header.cf = LV_COLOR_FORMAT_RGB565A8;
+    rgb565a8_dsc.header.w = w;
+    rgb565a8_dsc.header.h = h;
+    rgb565a8_dsc.header.stride = w * 2;
+    rgb565a8_dsc.data_size = rgb565a8_size;
+    rgb565a8_dsc.data = rgb565a8;
+
+    lv_image_dsc_t rle_dsc = rgb565a8_dsc;
+#if LV_USE_RLE
+    // Worst case: a literal control byte every 127 blocks
+    uint8_t *rle = static_cast<uint8_t *>(malloc(sizeof(lv_image_compressed_t) + rgb565a8_size * 2));
+    TEST_ASSERT_NOT_NULL(rle);
+    uint32_t rle_header[3] = {LV_IMAGE_COMPRESS_RLE, 0, static_cast<uint32_t>(rgb565a8_size)};
+    rle_header[1] = test_image_rle_compress(rgb565a8, rgb565a8_size, 2, rle + sizeof(rle_header));
+    memcpy(rle, rle_header, sizeof(rle_header));
+    rle_dsc.header.flags = LV_IMAGE_FLAGS_COMPRESSED;
+    rle_dsc.data_size = sizeof(rle_header) + rle_header[1];
+    rle_dsc.data = rle;
+    TEST_ASSERT_LESS_THAN_MESSAGE(rgb565a8_size, rle_dsc.data_size, "RLE doesn't compress the icon");
+#endif
+
+    struct {
+        const char *name;
+        const lv_image_dsc_t *dsc;
+    } formats[] = {
+        {"ARGB8888", &src},
+        {"RGB565A8", &rgb565a8_dsc},
+#if LV_USE_RLE
+        {"RGB565A8 RLE", &rle_dsc},
+#endif
+    };
+    lv_obj_t *image = lv_image_create(lv_screen_active());
+    TEST_ASSERT_NOT_NULL_MESSAGE(image, "Failed to create image");
+    lv_obj_center(image);
+
+    ESP_LOGI(TAG, "%-14s %10s %14s %14s", "Format", "Flash(B)", "First(us)", "Redraw(us)");
+    for (auto &format : formats) {
+        lv_image_set_src(image, format.dsc);
+        lv_refr_now(disp);
+
+        // The first draw decodes the image, compressed ones are then kept in the image cache
+        lv_image_cache_drop(format.dsc);
+        lv_obj_invalidate(image);
+        int64_t start_us = esp_timer_get_time();
+        lv_refr_now(disp);
+        int64_t first_us = esp_timer_get_time() - start_us;
+
+        start_us = esp_timer_get_time();
+        for (int i = 0; i < TEST_IMAGE_REDRAW_TIMES; i++) {
+            lv_obj_invalidate(image);
+            lv_refr_now(disp);
+        }
+        int64_t redraw_us = (esp_timer_get_time() - start_us) / TEST_IMAGE_REDRAW_TIMES;
+        ESP_LOGI(
+            TAG, "%-14s %10d %14d %14d", format.name, static_cast<int>(format.dsc->data_size),
+            static_cast<int>(first_us), static_cast<int>(redraw_us)
+        );
+    }
+    TEST_ASSERT_LESS_THAN(src.data_size, rgb565a8_dsc.data_size);
+
+    lv_obj_delete(image);
+    lv_image_cache_drop(nullptr);
+#if LV_USE_RLE
+    free(rle);
+#endif
+    free(rgb565a8);
+    test_lvgl_deinit(disp, tp);
+}
+
+TEST_CASE("test esp-brookesia assets are resolved by name in place", "[esp-brookesia][gui][assets]")
+{
+    using gui::LvAssets;
+
+    lv_display_t *disp = nullptr;
+    lv_indev_t *tp = nullptr;
+    const lv_image_dsc_t &src = esp_brookesia_image_large_app_launcher_default_112_112;
+
+    test_lvgl_init(&disp, &tp);
+    lv_display_set_flush_cb(disp, [](lv_display_t *disp, const lv_area_t *area, uint8_t *color_p) {
+        lv_display_flush_ready(disp);
+    });
+
+    ESP_LOGI(TAG, "Pack an image as `tools/lv_assets_packer.py` does");
+    size_t image_size = sizeof(lv_image_header_t) + src.data_size;
+    uint8_t *image_file = static_cast<uint8_t *>(malloc(image_size));
+    TEST_ASSERT_NOT_NULL(image_file);
+    memcpy(image_file, &src.header, sizeof(lv_image_header_t));
+    memcpy(image_file + sizeof(lv_image_header_t), src.data, src.data_size);
+
+    ESP_LOGI(TAG, "Pack a font with the glyph 'A' only");
+    // Aligned as the files of the assets partition, otherwise the font would be copied instead of used in place
+    alignas(4) struct __attribute__((packed)) {
+        esp_brookesia_lv_assets_font_header_t header;
+        esp_brookesia_lv_assets_glyph_dsc_t glyph_dsc[2];
+        uint8_t glyph_bitmap[8];
+        esp_brookesia_lv_assets_cmap_t cmap;
+    } font_file = {};
+    font_file.header.magic = ESP_BROOKESIA_LV_ASSETS_FONT_MAGIC;
+    font_file.header.version = ESP_BROOKESIA_LV_ASSETS_FONT_VERSION;
+    font_file.header.line_height = 6;
+    font_file.header.base_line = 1;
+    font_file.header.bpp = 4;
+    font_file.header.kern_type = ESP_BROOKESIA_LV_ASSETS_KERN_NONE;
+    font_file.header.cmap_num = 1;
+    font_file.header.glyph_num = 2;
+    font_file.header.glyph_dsc_offset = offsetof(decltype(font_file), glyph_dsc);
+    font_file.header.glyph_bitmap_offset = offsetof(decltype(font_file), glyph_bitmap);
+    font_file.header.cmap_offset = offsetof(decltype(font_file), cmap);
+    font_file.header.size = sizeof(font_file);
+    // The glyph ID 0 is reserved
+    font_file.glyph_dsc[1] = {.bitmap_index = 0, .adv_w = 80, .box_w = 4, .box_h = 4, .ofs_x = 0, .ofs_y = 0};
+    memset(font_file.glyph_bitmap, 0xff, sizeof(font_file.glyph_bitmap));
+    font_file.cmap.range_start = 'A';
+    font_file.cmap.range_length = 1;
+    font_file.cmap.glyph_id_start = 1;
+    font_file.cmap.type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY;
+
+    auto &assets = LvAssets::getInstance();
+    TEST_ASSERT_TRUE(assets.addMemory("image", image_file, image_size));
+    TEST_ASSERT_TRUE(assets.addMemory("font", &font_file, sizeof(font_file)));
+    TEST_ASSERT_FALSE_MESSAGE(assets.addMemory("image", image_file, image_size), "Duplicate name added");
+
+    ESP_LOGI(TAG, "Resolve the assets, their data should be used in place");
+    const lv_image_dsc_t *image = assets.getImage("image");
+    TEST_ASSERT_NOT_NULL(image);
+    TEST_ASSERT_EQUAL_PTR(image_file + sizeof(lv_image_header_t), image->data);
+    TEST_ASSERT_EQUAL(src.header.w, image->header.w);
+    TEST_ASSERT_EQUAL(src.header.h, image->header.h);
+    TEST_ASSERT_EQUAL_PTR_MESSAGE(image, assets.getImage("image"), "Descriptor created twice");
+    const lv_font_t *font = assets.getFont("font");
+    TEST_ASSERT_NOT_NULL(font);
+    TEST_ASSERT_EQUAL(6, lv_font_get_line_height(font));
+    TEST_ASSERT_EQUAL(5, lv_font_get_glyph_width(font, 'A', 0));
+    TEST_ASSERT_NULL_MESSAGE(assets.getFont("image"), "Image resolved as a font");
+    TEST_ASSERT_NULL_MESSAGE(assets.getImage("font"), "Font resolved as an image");
+    TEST_ASSERT_NULL(assets.getImage("unknown"));
+    LvAssets::Stats stats = assets.getStats();
+    TEST_ASSERT_EQUAL(0, stats.copied_size);
+    assets.dump();
+
+    ESP_LOGI(TAG, "Draw them");
+    lv_obj_t *image_obj = lv_image_create(lv_screen_active());
+    lv_image_set_src(image_obj, image);
+    lv_obj_t *label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, "AAA");
+    lv_refr_now(disp);
+    lv_obj_delete(label);
+    lv_obj_delete(image_obj);
+
+    TEST_ASSERT_TRUE(assets.del());
+    TEST_ASSERT_NULL_MESSAGE(assets.getImage("image"), "Image kept after deleting the assets");
+    free(image_file);
+
+    ESP_LOGI(TAG, "Resolve an image packed into the assets partition, with a name as long as the SquareLine ones");
+    TEST_ASSERT_TRUE(assets.addPartition({
+        .partition_label = "assets",
+        .max_files = TEST_ASSETS_FILE_NUM,
+        .checksum = 0,
+    }));
+    image = assets.getImage("test_assets_long_name_png");
+    TEST_ASSERT_NOT_NULL_MESSAGE(image, "Asset name truncated, check `CONFIG_MMAP_FILE_NAME_LENGTH`");
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_ARGB8888, image->header.cf);
+    TEST_ASSERT_EQUAL(4, image->header.w);
+    TEST_ASSERT_EQUAL(4, image->header.h);
+    TEST_ASSERT_EQUAL(4 * 4 * 4, image->data_size);
+    TEST_ASSERT_TRUE(assets.del());
+
+    test_lvgl_deinit(disp, tp);
+}
+
+TEST_CASE("test esp-brookesia tiled snapshot matches the full snapshot", "[esp-brookesia][gui][snapshot]")
+{
+    lv_display_t *disp = nullptr;
+    lv_indev_t *tp = nullptr;
+
+    test_lvgl_init(&disp, &tp);
+
+    // Rounded objects and a text crossing the bands
+    lv_obj_t *screen = lv_screen_active();
+    lv_obj_set_style_bg_color(screen, lv_color_hex(0x203040), 0);
+    for (int i = 0; i < 4; i++) {
+        lv_obj_t *obj = lv_obj_create(screen);
+        lv_obj_set_size(obj, TEST_LVGL_RESOLUTION_WIDTH / 2, TEST_LVGL_RESOLUTION_HEIGHT / 3);
+        lv_obj_set_pos(obj, i * 20, i * TEST_LVGL_RESOLUTION_HEIGHT / 5);
+        lv_obj_set_style_radius(obj, 16, 0);
+        lv_obj_set_style_bg_color(obj, lv_palette_main(static_cast<lv_palette_t>(i)), 0);
+    }
+    lv_obj_t *label = lv_label_create(screen);
+    lv_label_set_text(label, "Tiled snapshot");
+    lv_obj_center(label);
+    lv_obj_update_layout(screen);
+
+    int64_t start_us = esp_timer_get_time();
+    lv_draw_buf_t *expected = lv_snapshot_take(screen, LV_COLOR_FORMAT_RGB565);
+    int64_t full_us = esp_timer_get_time() - start_us;
+    TEST_ASSERT_NOT_NULL_MESSAGE(expected, "Failed to take snapshot");
+
+    gui::LvTiledSnapshot snapshot;
+    TEST_ASSERT_TRUE_MESSAGE(snapshot.begin(screen, LV_COLOR_FORMAT_RGB565), "Failed to begin tiled snapshot");
+    int band_num = 0;
+    while (!snapshot.isDone()) {
+        TEST_ASSERT_TRUE(snapshot.renderNext(TEST_SNAPSHOT_BAND_ROWS));
+        band_num++;
+    }
+    ESP_LOGI(
+        TAG, "Snapshot: %dus at once, %dus in %d bands", static_cast<int>(full_us),
+        static_cast<int>(snapshot.getRenderTimeUs()), band_num
+    );
+    TEST_ASSERT_EQUAL((TEST_LVGL_RESOLUTION_HEIGHT + TEST_SNAPSHOT_BAND_ROWS - 1) / TEST_SNAPSHOT_BAND_ROWS, band_num);
+
+    lv_draw_buf_t *actual = snapshot.release();
+    TEST_ASSERT_NOT_NULL(actual);
+    TEST_ASSERT_FALSE(snapshot.isRunning());
+    TEST_ASSERT_EQUAL_UINT32(expected->header.w, actual->header.w);
+    TEST_ASSERT_EQUAL_UINT32(expected->header.h, actual->header.h);
+    TEST_ASSERT_EQUAL_UINT32(expected->header.stride, actual->header.stride);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(
+        expected->data, actual->data, expected->header.stride * expected->header.h, "Bands differ from the snapshot"
+    );
+
+    lv_draw_buf_destroy(actual);
+    lv_draw_buf_destroy(expected);
+    lv_obj_clean(screen);
+    test_lvgl_deinit(disp, tp);
+}
+
+#if LV_USE_RLE
+TEST_CASE("test esp-brookesia snapshot RLE round trips through the LVGL decoder", "[esp-brookesia][base][snapshot_rle]")
+{
+    // Runs around the longest control (0x7f blocks), literals of the same lengths, and a trailing literal block
+    const struct {
+        const char *name;
+        size_t run;
+        size_t literal;
+        size_t repeat;
+        bool trailing_literal;
+    } cases[] = {
+        {"single block", 0, 1, 1, false},
+        {"run of 0x7e", 0x7e, 0, 1, false},
+        {"run of 0x7f", 0x7f, 0, 1, false},
+        {"run of 0x80", 0x80, 0, 1, false},
+        {"runs of 0x7f", 0x7f, 0, 3, false},
+        {"run of 0x7f, trailing literal", 0x7f, 0, 1, true},
+        {"literal of 0x7f", 0, 0x7f, 1, false},
+        {"literal of 0x80", 0, 0x80, 1, false},
+        {"run and literal", 0x7f, 0x7f, 4, true},
+        {"short runs", 2, 1, 200, true},
+    };
+
+    for (size_t blk_size : {2, 3, 4}) {
+        for (auto &test_case : cases) {
+            size_t blk_num = (test_case.run + test_case.literal) * test_case.repeat +
+                             (test_case.trailing_literal ? 1 : 0);
+            size_t size = blk_num * blk_size;
+            std::vector<uint8_t> in(size);
+            std::vector<uint8_t> compressed(size + blk_num);
+            std::vector<uint8_t> out(size);
+
+            // Blocks differ from their neighbours unless they are in the same run
+            uint8_t value = 0;
+            size_t pos = 0;
+            for (size_t i = 0; i < test_case.repeat; i++) {
+                value++;
+                for (size_t j = 0; j < test_case.run; j++, pos += blk_size) {
+                    memset(&in[pos], value, blk_size);
+                }
+                for (size_t j = 0; j < test_case.literal; j++, pos += blk_size) {
+                    memset(&in[pos], ++value, blk_size);
+                }
+            }
+            if (test_case.trailing_literal) {
+                memset(&in[pos], ++value, blk_size);
+            }
+
+            size_t compressed_size = systems::base::Manager::compressSnapshotRle(
+                                         in.data(), size, blk_size, compressed.data()
+                                     );
+            ESP_LOGI(TAG, "%-30s block(%d): %d -> %d bytes", test_case.name, static_cast<int>(blk_size),
+                     static_cast<int>(size), static_cast<int>(compressed_size));
+            TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(compressed.size(), compressed_size, test_case.name);
+            uint32_t decompressed_size = lv_rle_decompress(
+                                             compressed.data(), compressed_size, out.data(), out.size(), blk_size
+                                         );
+            TEST_ASSERT_EQUAL_MESSAGE(size, decompressed_size, test_case.name);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(in.data(), out.data(), size, test_case.name);
+        }
+    }
+}
+#endif
+
+
+class TestResourceApp: public systems::phone::App {
+public:
+    TestResourceApp(): App("Resources", nullptr, false) {}
+
+    bool run(void) override
+    {
+        return true;
+    }
+    bool back(void) override
+    {
+        return notifyCoreClosed();
+    }
+
+    // As many timers as animations, and a screen for every `TEST_RESOURCE_SCREEN_RATIO` resources
+    bool record(int num)
+    {
+        if (!startRecordResource()) {
+            return false;
+        }
+        for (int i = 0; i < num; i++) {
+            if ((i % TEST_RESOURCE_SCREEN_RATIO) == 0) {
+                lv_obj_create(nullptr);
+            } else if (i % 2) {
+                lv_timer_create([](lv_timer_t *timer) {}, 1000000, this);
+            } else {
+                lv_anim_t anim;
+                lv_anim_init(&anim);
+                lv_anim_set_var(&anim, &_anim_values[i]);
+                lv_anim_set_exec_cb(&anim, [](void *var, int32_t value) {});
+                lv_anim_set_duration(&anim, 1000000);
+                lv_anim_start(&anim);
+            }
+        }
+        return endRecordResource();
+    }
+    bool clean(void)
+    {
+        return cleanRecordResource();
+    }
+
+private:
+    int32_t _anim_values[1000] = {};
+};
+
+TEST_CASE("test esp-brookesia app cleans its recorded resources", "[esp-brookesia][phone][resource]")
+{
+    lv_display_t *disp = nullptr;
+    lv_indev_t *tp = nullptr;
+    systems::phone::Phone *phone = nullptr;
+    auto count_timers = []() {
+        int count = 0;
+        for (lv_timer_t *timer = lv_timer_get_next(nullptr); timer != nullptr; timer = lv_timer_get_next(timer)) {
+            count++;
+        }
+        return count;
+    };
+
+    test_lvgl_init(&disp, &tp);
+    phone = test_esp_brookesia_phone_init(disp, tp, true);
+    auto app = new TestResourceApp();
+    TEST_ASSERT_NOT_NULL_MESSAGE(app, "Failed to create app");
+    int app_id = phone->installApp(app);
+    TEST_ASSERT_TRUE_MESSAGE(app_id >= 0, "Failed to install app");
+
+    uint32_t screen_cnt = disp->screen_cnt;
+    int timer_num = count_timers();
+    uint32_t anim_num = lv_anim_count_running();
+    for (int num : {10, 100, 1000}) {
+        TEST_ASSERT_TRUE_MESSAGE(app->record(num), "Failed to record resources");
+        TEST_ASSERT_EQUAL_UINT32(screen_cnt + num / TEST_RESOURCE_SCREEN_RATIO, disp->screen_cnt);
+
+        int64_t start_us = esp_timer_get_time();
+        TEST_ASSERT_TRUE_MESSAGE(app->clean(), "Failed to clean resources");
+        int64_t clean_us = esp_timer_get_time() - start_us;
+        ESP_LOGI(TAG, "Clean %d resources: %dus", num, static_cast<int>(clean_us));
+
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(screen_cnt, disp->screen_cnt, "Screens left");
+        TEST_ASSERT_EQUAL_MESSAGE(timer_num, count_timers(), "Timers left");
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(anim_num, lv_anim_count_running(), "Animations left");
+    }
+
+    TEST_ASSERT_TRUE_MESSAGE(phone->uninstallApp(app_id), "Failed to uninstall app");
+    delete app;
+    test_esp_brookesia_phone_deinit(phone);
+    test_lvgl_deinit(disp, tp);
+}
+
+TEST_CASE("test esp-brookesia event register, send and unregister throughput", "[esp-brookesia][base][event]")
+{
+    using systems::base::Event;
+
+    static int handled_num = 0;
+    auto handler = [](const Event::HandlerData & data) {
+        handled_num++;
+        return true;
+    };
+    auto handler_other = [](const Event::HandlerData & data) {
+        handled_num++;
+        return true;
+    };
+    int objects[TEST_EVENT_OBJECT_NUM] = {};
+    Event event;
+    Event::ID custom_id = event.getFreeEventID();
+    auto heap_free = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+
+    // Two handlers per (object, ID), the inline ones of the slot
+    int64_t start_us = esp_timer_get_time();
+    for (auto &object : objects) {
+        for (auto id : {Event::ID::APP, Event::ID::NAVIGATION, custom_id}) {
+            TEST_ASSERT_TRUE(event.registerEvent(&object, handler, id));
+            TEST_ASSERT_TRUE(event.registerEvent(&object, handler_other, id));
+        }
+    }
+    int64_t register_us = esp_timer_get_time() - start_us;
+    ESP_LOGI(TAG, "Register %d handlers: %dus, %d bytes", TEST_EVENT_OBJECT_NUM * 6, static_cast<int>(register_us),
+             static_cast<int>(heap_free - heap_caps_get_free_size(MALLOC_CAP_DEFAULT)));
+
+    handled_num = 0;
+    heap_free = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    start_us = esp_timer_get_time();
+    for (int i = 0; i < TEST_EVENT_SEND_TIMES; i++) {
+        TEST_ASSERT_TRUE(event.sendEvent(&objects[i % TEST_EVENT_OBJECT_NUM], custom_id));
+    }
+    int64_t send_us = esp_timer_get_time() - start_us;
+    TEST_ASSERT_EQUAL(TEST_EVENT_SEND_TIMES * 2, handled_num);
+    TEST_ASSERT_EQUAL_MESSAGE(heap_free, heap_caps_get_free_size(MALLOC_CAP_DEFAULT), "Send allocated memory");
+    ESP_LOGI(TAG, "Send %d events: %dus (%dns per event)", TEST_EVENT_SEND_TIMES, static_cast<int>(send_us),
+             static_cast<int>(send_us * 1000 / TEST_EVENT_SEND_TIMES));
+
+    // Objects without handlers are the common case of the app events
+    int nothing = 0;
+    start_us = esp_timer_get_time();
+    for (int i = 0; i < TEST_EVENT_SEND_TIMES; i++) {
+        TEST_ASSERT_TRUE(event.sendEvent(&nothing, custom_id));
+    }
+    ESP_LOGI(TAG, "Send %d events with no handler: %dus", TEST_EVENT_SEND_TIMES,
+             static_cast<int>(esp_timer_get_time() - start_us));
+
+    // Posted events are coalesced until the flush, which is only requested by the first one
+    static int posted_num = 0;
+    event.setPostedCallback([](void *user_data) {
+        posted_num++;
+    });
+    handled_num = 0;
+    for (int i = 0; i < TEST_EVENT_SEND_TIMES; i++) {
+        TEST_ASSERT_TRUE(event.postEvent(&objects[i % 4], custom_id));
+    }
+    TEST_ASSERT_EQUAL(1, posted_num);
+    TEST_ASSERT_EQUAL(4, event.getPostedEventsCount());
+    TEST_ASSERT_TRUE(event.flushPostedEvents());
+    TEST_ASSERT_EQUAL(4 * 2, handled_num);
+    TEST_ASSERT_EQUAL(0, event.getPostedEventsCount());
+    event.setPostedCallback(nullptr);
+
+    start_us = esp_timer_get_time();
+    for (auto &object : objects) {
+        event.unregisterEvent(&object, handler_other, Event::ID::APP);
+        event.unregisterEvent(&object, Event::ID::NAVIGATION);
+        event.unregisterEvent(&object);
+    }
+    int64_t unregister_us = esp_timer_get_time() - start_us;
+    ESP_LOGI(TAG, "Unregister %d handlers: %dus", TEST_EVENT_OBJECT_NUM * 6, static_cast<int>(unregister_us));
+
+    handled_num = 0;
+    for (auto &object : objects) {
+        TEST_ASSERT_TRUE(event.sendEvent(&object, custom_id));
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(0, handled_num, "Handlers left");
+}
+
+TEST_CASE("test esp-brookesia event handlers unregistering handlers during a send", "[esp-brookesia][base][event]")
+{
+    using systems::base::Event;
+
+    static Event event;
+    static int object = 0;
+    static std::vector<int> called;
+    static Event::Handler handlers[] = {
+        [](const Event::HandlerData & data) {
+            called.push_back(0);
+            return true;
+        },
+        [](const Event::HandlerData & data) {
+            called.push_back(1);
+            return true;
+        },
+        // Removes a handler before it
+        [](const Event::HandlerData & data) {
+            called.push_back(2);
+            event.unregisterEvent(&object, handlers[0], Event::ID::APP);
+            return true;
+        },
+        [](const Event::HandlerData & data) {
+            called.push_back(3);
+            return true;
+        },
+        // Removes itself and a handler before it
+        [](const Event::HandlerData & data) {
+            called.push_back(4);
+            event.unregisterEvent(&object, handlers[4], Event::ID::APP);
+            event.unregisterEvent(&object, handlers[1], Event::ID::APP);
+            return true;
+        },
+        [](const Event::HandlerData & data) {
+            called.push_back(5);
+            return true;
+        },
+    };
+
+    event.reset();
+    called.clear();
+    for (auto handler : handlers) {
+        TEST_ASSERT_TRUE(event.registerEvent(&object, handler, Event::ID::APP));
+    }
+    TEST_ASSERT_TRUE(event.sendEvent(&object, Event::ID::APP));
+    TEST_ASSERT_TRUE_MESSAGE((called == std::vector<int>{0, 1, 2, 3, 4, 5}), "Handler skipped or called twice");
+    called.clear();
+    TEST_ASSERT_TRUE(event.sendEvent(&object, Event::ID::APP));
+    TEST_ASSERT_TRUE_MESSAGE((called == std::vector<int>{2, 3, 5}), "Removed handler called");
+
+    // The posted events are dropped with the last handler of their (object, ID)
+    TEST_ASSERT_TRUE(event.postEvent(&object, Event::ID::APP));
+    event.unregisterEvent(&object, handlers[2], Event::ID::APP);
+    event.unregisterEvent(&object, handlers[3], Event::ID::APP);
+    TEST_ASSERT_EQUAL(1, event.getPostedEventsCount());
+    event.unregisterEvent(&object, handlers[5], Event::ID::APP);
+    TEST_ASSERT_EQUAL(0, event.getPostedEventsCount());
+    event.reset();
+}
+
 // TEST_CASE("test esp-brookesia to install and uninstall APPs", "[esp-brookesia][phone][install_uninstall_app]")
 // {
 //     lv_display_t *disp = nullptr;
@@ -205,6 +205,13 @@ bool TouchDrvCSTXXX::getResolution(int16_t *x, int16_t *y)
     return _drv->getResolution(x, y);
 }
 
+TouchDrvInterface::InitStepResult TouchDrvCSTXXX::initStep(uint32_t &delay_ms)
+{
+    delay_ms = 0;
+    if (!_drv)return INIT_STEP_FAILED;
+    return _drv->initStep(delay_ms);
+}
+
 void TouchDrvCSTXXX::setCenterButtonCoordinate(uint16_t x, uint16_t y)
 {
     if (!_drv)return ;
@@ -104,6 +104,9 @@ public:
     // Get touch screen resolution, not implemented
     bool getResolution(int16_t *x, int16_t *y)override;
 
+    // Run the next step of the non-blocking initialization of the detected driver
+    InitStepResult initStep(uint32_t &delay_ms)override;
+
     // Set the screen touch button coordinates
     void setCenterButtonCoordinate(uint16_t x, uint16_t y);
 
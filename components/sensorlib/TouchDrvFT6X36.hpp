@@ -60,7 +60,7 @@ public:
 
     EventFlag event;
 
-    TouchDrvFT6X36() : comm(nullptr), hal(nullptr) {}
+    TouchDrvFT6X36() : comm(nullptr), hal(nullptr), _initState(INIT_STATE_IDLE) {}
 
     ~TouchDrvFT6X36()
     {
@@ -86,7 +86,8 @@ public:
         if (!beginCommon<SensorCommI2C, HalEspIDF>(comm, hal, port_num, addr, sda, scl)) {
             return false;
         }
-        return initImpl();
+        _initState = INIT_STATE_IDLE;
+        return true;
     }
 #else
     bool begin(i2c_master_bus_handle_t handle, uint8_t addr = FT6X36_SLAVE_ADDRESS)
@@ -94,7 +95,8 @@ public:
         if (!beginCommon<SensorCommI2C, HalEspIDF>(comm, hal, handle, addr)) {
             return false;
         }
-        return initImpl();
+        _initState = INIT_STATE_IDLE;
+        return true;
     }
 #endif  //ESP_PLATFORM
 #endif  //ARDUINO
@@ -330,15 +332,85 @@ public:
         SensorHalCustom::setCustomRead(read_cb);
     }
 
+    /**
+     * @brief  Resumable version of the initialization done by the blocking begin() variants.
+     *         On ESP-IDF begin() only sets up the bus, so the chip is initialized by calling
+     *         initStep() until it stops returning INIT_STEP_PENDING
+     */
+    InitStepResult initStep(uint32_t &delay_ms) override
+    {
+        delay_ms = 0;
+
+        if (!comm || !hal) {
+            return INIT_STEP_FAILED;
+        }
+
+        switch (_initState) {
+        case INIT_STATE_IDLE:
+            if (_irq != -1) {
+                hal->pinMode(_irq, INPUT);
+            }
+            if (_rst == -1) {
+                _initState = INIT_STATE_PROBE;
+                return initStep(delay_ms);
+            }
+            // Same sequence as reset()
+            hal->pinMode(_rst, OUTPUT);
+            hal->digitalWrite(_rst, HIGH);
+            delay_ms = 10;
+            _initState = INIT_STATE_RESET_ASSERT;
+            break;
+        case INIT_STATE_RESET_ASSERT:
+            hal->digitalWrite(_rst, LOW);
+            delay_ms = 30;
+            _initState = INIT_STATE_RESET_RELEASE;
+            break;
+        case INIT_STATE_RESET_RELEASE:
+            hal->digitalWrite(_rst, HIGH);
+            delay_ms = 160;
+            _initState = INIT_STATE_PROBE;
+            break;
+        case INIT_STATE_PROBE:
+            if (!probe()) {
+                _initState = INIT_STATE_FAILED;
+                return INIT_STEP_FAILED;
+            }
+            _initState = INIT_STATE_DONE;
+            return INIT_STEP_DONE;
+        case INIT_STATE_DONE:
+            return INIT_STEP_DONE;
+        default:
+            return INIT_STEP_FAILED;
+        }
+
+        return INIT_STEP_PENDING;
+    }
+
 private:
+    enum InitState {
+        INIT_STATE_IDLE,
+        INIT_STATE_RESET_ASSERT,
+        INIT_STATE_RESET_RELEASE,
+        INIT_STATE_PROBE,
+        INIT_STATE_DONE,
+        INIT_STATE_FAILED,
+    };
+
     bool initImpl()
     {
-        if (_irq != -1) {
-            hal->pinMode(_irq, INPUT);
+        uint32_t delay_ms = 0;
+        InitStepResult result;
+
+        _initState = INIT_STATE_IDLE;
+        while ((result = initStep(delay_ms)) == INIT_STEP_PENDING) {
+            hal->delay(delay_ms);
         }
 
-        reset();
+        return result == INIT_STEP_DONE;
+    }
 
+    bool probe()
+    {
         uint8_t vendId = comm->readRegister(FT6X36_REG_VENDOR1_ID);
 
 
@@ -382,6 +454,7 @@ private:
 protected:
     std::unique_ptr<SensorCommBase> comm;
     std::unique_ptr<SensorHal> hal;
+    InitState _initState;
 };
 
 
@@ -41,7 +41,8 @@ TouchDrvInterface::TouchDrvInterface() :
     _irq(-1),
     _chipID(0x00),
     _HButtonCallback(nullptr),
-    _userData(nullptr)
+    _userData(nullptr),
+    _transform(transformXY<false, false, false>)
 {
 
 }
@@ -66,35 +67,37 @@ void TouchDrvInterface::setPins(int rst, int irq)
 void TouchDrvInterface::setSwapXY(bool swap)
 {
     _swapXY = swap;
+    updateTransform();
 }
 
 void TouchDrvInterface::setMirrorXY(bool mirrorX, bool mirrorY)
 {
     _mirrorX = mirrorX;
     _mirrorY = mirrorY;
+    updateTransform();
 }
 
 void TouchDrvInterface::setMaxCoordinates(uint16_t x, uint16_t y)
 {
     _xMax = x;
     _yMax = y;
+    updateTransform();
 }
 
-void TouchDrvInterface::updateXY(uint8_t pointNum, int16_t *xBuffer, int16_t *yBuffer)
+void TouchDrvInterface::updateTransform()
 {
-    if (!pointNum)
-        return;
-    for (int i = 0; i < pointNum; ++i) {
-        if (_swapXY) {
-            uint16_t tmp = xBuffer[i];
-            xBuffer[i] = yBuffer[i];
-            yBuffer[i] = tmp;
-        }
-        if (_mirrorX && _xMax ) {
-            xBuffer[i] = _xMax - xBuffer[i];
-        }
-        if (_mirrorY && _yMax) {
-            yBuffer[i] = _yMax - yBuffer[i];
-        }
-    }
+    // Indexed by swap | mirrorX << 1 | mirrorY << 2, a mirror needs the max coordinate to be set
+    static const TransformCallback transforms[] = {
+        transformXY<false, false, false>,
+        transformXY<true, false, false>,
+        transformXY<false, true, false>,
+        transformXY<true, true, false>,
+        transformXY<false, false, true>,
+        transformXY<true, false, true>,
+        transformXY<false, true, true>,
+        transformXY<true, true, true>,
+    };
+    bool mirrorX = _mirrorX && _xMax;
+    bool mirrorY = _mirrorY && _yMax;
+    _transform = transforms[_swapXY | (mirrorX << 1) | (mirrorY << 2)];
 }
@@ -68,6 +68,16 @@ class TouchDrvInterface : public SensorHalCustom
 public:
     using HomeButtonCallback = void(*)(void *user_data);
 
+    // Applies the swap/mirror settings to the points, selected once when the settings change
+    using TransformCallback = void(*)(uint8_t pointNum, int16_t *xBuffer, int16_t *yBuffer,
+                                      uint16_t xMax, uint16_t yMax);
+
+    enum InitStepResult {
+        INIT_STEP_PENDING,      // Call initStep() again once the returned delay has elapsed
+        INIT_STEP_DONE,
+        INIT_STEP_FAILED,
+    };
+
     TouchDrvInterface();
 
     virtual ~TouchDrvInterface();
@@ -109,6 +119,18 @@ public:
                                  CustomWrite write_cb,
                                  CustomRead read_cb) = 0;
 
+    /**
+     * @brief  Run the next step of the chip initialization without blocking in hal->delay(),
+     *         so the caller can do other work while the chip is resetting
+     * @param  delay_ms: Time to wait before the next call, only valid when INIT_STEP_PENDING is returned
+     * @retval The drivers which initialize the chip in begin() are done as soon as begin() succeeded
+     */
+    virtual InitStepResult initStep(uint32_t &delay_ms)
+    {
+        delay_ms = 0;
+        return INIT_STEP_DONE;
+    }
+
     uint32_t getChipID();
 
     void setPins(int rst, int irq);
@@ -119,9 +141,25 @@ public:
 
     void setMaxCoordinates(uint16_t x, uint16_t y);
 
-    void updateXY(uint8_t pointNum, int16_t *xBuffer, int16_t *yBuffer);
+    void updateXY(uint8_t pointNum, int16_t *xBuffer, int16_t *yBuffer)
+    {
+        _transform(pointNum, xBuffer, yBuffer, _xMax, _yMax);
+    }
+
+    template <bool Swap, bool MirrorX, bool MirrorY>
+    static void transformXY(uint8_t pointNum, int16_t *xBuffer, int16_t *yBuffer, uint16_t xMax, uint16_t yMax)
+    {
+        for (int i = 0; i < pointNum; ++i) {
+            int16_t x = Swap ? yBuffer[i] : xBuffer[i];
+            int16_t y = Swap ? xBuffer[i] : yBuffer[i];
+            xBuffer[i] = MirrorX ? xMax - x : x;
+            yBuffer[i] = MirrorY ? yMax - y : y;
+        }
+    }
 
 protected:
+    void updateTransform();
+
     uint16_t _resX, _resY, _xMax, _yMax;
     bool _swapXY, _mirrorX, _mirrorY;
     int _rst;
@@ -129,5 +167,6 @@ protected:
     uint32_t _chipID;
     HomeButtonCallback _HButtonCallback;
     void *_userData;
+    TransformCallback _transform;
 
 };
@@ -0,0 +1,278 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+/**
+ * Host benchmark of the read paths of the CST816, CST92xx, FT6X36 and GT911 drivers.
+ *
+ * The drivers are attached to a bus callback which answers a canned touch frame, so no chip is needed and only the
+ * CPU side of `getPoint()` is timed. The coordinate transform selected once per configuration is compared with the
+ * per point branches it replaced, and both must give the same coordinates for every swap / mirror / max setting.
+ *
+ *     touch_read_bench            Check, then print the timings
+ *     touch_read_bench --check    Check only, exit 1 on a mismatch
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include "SensorLib.h"
+#include "TouchDrvCST816.h"
+#include "TouchDrvCST92xx.h"
+#include "TouchDrvFT6X36.hpp"
+#include "TouchDrvGT911.hpp"
+
+namespace {
+
+constexpr int BENCH_READS = 2000000;
+constexpr int BENCH_POINTS_MAX = 5;
+constexpr uint16_t BENCH_X_MAX = 410;
+constexpr uint16_t BENCH_Y_MAX = 502;
+// Protected in CST92xxConstants
+constexpr uint8_t CST92XX_ACK = 0xab;
+constexpr uint8_t CST92XX_MAX_FINGER_NUM = 2;
+
+// Register frame answered by the bus, `info` is the answer of the single byte reads (GT911 point status)
+struct BusFrame {
+    uint8_t info;
+    uint8_t data[64];
+};
+
+BusFrame bus_frame;
+
+bool bus_callback(uint8_t addr, uint8_t reg, uint8_t *buf, size_t len, bool writeReg, bool isWrite)
+{
+    if (isWrite) {
+        return true;
+    }
+    if ((len == 1) && !writeReg) {
+        buf[0] = bus_frame.info;
+        return true;
+    }
+    memcpy(buf, bus_frame.data, std::min(len, sizeof(bus_frame.data)));
+
+    return true;
+}
+
+template <class Driver>
+class BenchDriver: public Driver {
+public:
+    BenchDriver()
+    {
+        this->comm = std::make_unique<SensorCommCustom>(bus_callback, 0x00);
+    }
+};
+
+void frame_cst816(int16_t x, int16_t y)
+{
+    bus_frame = {};
+    bus_frame.data[2] = 1;
+    bus_frame.data[3] = (x >> 8) & 0x0f;
+    bus_frame.data[4] = x & 0xff;
+    bus_frame.data[5] = (y >> 8) & 0x0f;
+    bus_frame.data[6] = y & 0xff;
+}
+
+void frame_cst92xx(const int16_t *x, const int16_t *y, uint8_t num)
+{
+    bus_frame = {};
+    bus_frame.data[5] = num;
+    bus_frame.data[6] = CST92XX_ACK;
+    for (uint8_t i = 0; i < num; i++) {
+        uint8_t *finger = bus_frame.data + (i * 5) + (i == 0 ? 0 : 2);
+        finger[0] = (i << 4) | 0x06;
+        finger[1] = x[i] >> 4;
+        finger[2] = y[i] >> 4;
+        finger[3] = ((x[i] & 0x0f) << 4) | (y[i] & 0x0f);
+    }
+}
+
+void frame_ft6x36(const int16_t *x, const int16_t *y, uint8_t num)
+{
+    bus_frame = {};
+    bus_frame.data[2] = num;
+    for (uint8_t i = 0; i < num; i++) {
+        uint8_t *point = bus_frame.data + 3 + i * 6;
+        point[0] = (x[i] >> 8) & 0x0f;
+        point[1] = x[i] & 0xff;
+        point[2] = (y[i] >> 8) & 0x0f;
+        point[3] = y[i] & 0xff;
+    }
+}
+
+void frame_gt911(const int16_t *x, const int16_t *y, uint8_t num)
+{
+    bus_frame = {};
+    bus_frame.info = 0x80 | num;
+    for (uint8_t i = 0; i < num; i++) {
+        uint8_t *point = bus_frame.data + i * 8;
+        point[0] = i;
+        point[1] = x[i] & 0xff;
+        point[2] = x[i] >> 8;
+        point[3] = y[i] & 0xff;
+        point[4] = y[i] >> 8;
+    }
+}
+
+// TouchDrvInterface::updateXY() before the transform was selected once per configuration
+struct LegacyTransform {
+    bool swapXY;
+    bool mirrorX;
+    bool mirrorY;
+    uint16_t xMax;
+    uint16_t yMax;
+};
+
+__attribute__((noinline)) void legacy_update_xy(
+    const LegacyTransform &t, uint8_t pointNum, int16_t *xBuffer, int16_t *yBuffer
+)
+{
+    for (int i = 0; i < pointNum; ++i) {
+        if (t.swapXY) {
+            uint16_t tmp = xBuffer[i];
+            xBuffer[i] = yBuffer[i];
+            yBuffer[i] = tmp;
+        }
+        if (t.mirrorX && t.xMax) {
+            xBuffer[i] = t.xMax - xBuffer[i];
+        }
+        if (t.mirrorY && t.yMax) {
+            yBuffer[i] = t.yMax - yBuffer[i];
+        }
+    }
+}
+
+const int16_t sample_x[BENCH_POINTS_MAX] = {0, 12, 205, 333, 409};
+const int16_t sample_y[BENCH_POINTS_MAX] = {501, 7, 251, 480, 0};
+
+bool check_transforms()
+{
+    BenchDriver<TouchDrvFT6X36> driver;
+    int mismatches = 0;
+
+    for (int config = 0; config < 16; config++) {
+        LegacyTransform legacy = {
+            .swapXY = (config & 1) != 0,
+            .mirrorX = (config & 2) != 0,
+            .mirrorY = (config & 4) != 0,
+            .xMax = (config & 8) ? BENCH_X_MAX : uint16_t(0),
+            .yMax = (config & 8) ? BENCH_Y_MAX : uint16_t(0),
+        };
+        driver.setSwapXY(legacy.swapXY);
+        driver.setMirrorXY(legacy.mirrorX, legacy.mirrorY);
+        driver.setMaxCoordinates(legacy.xMax, legacy.yMax);
+
+        int16_t x[BENCH_POINTS_MAX], y[BENCH_POINTS_MAX], ref_x[BENCH_POINTS_MAX], ref_y[BENCH_POINTS_MAX];
+        memcpy(x, sample_x, sizeof(x));
+        memcpy(y, sample_y, sizeof(y));
+        memcpy(ref_x, sample_x, sizeof(ref_x));
+        memcpy(ref_y, sample_y, sizeof(ref_y));
+        driver.updateXY(BENCH_POINTS_MAX, x, y);
+        legacy_update_xy(legacy, BENCH_POINTS_MAX, ref_x, ref_y);
+        if (memcmp(x, ref_x, sizeof(x)) || memcmp(y, ref_y, sizeof(y))) {
+            printf("Mismatch: swap %d, mirror x %d, mirror y %d, max %dx%d\n", legacy.swapXY, legacy.mirrorX,
+                   legacy.mirrorY, legacy.xMax, legacy.yMax);
+            mismatches++;
+        }
+    }
+
+    return mismatches == 0;
+}
+
+template <class Func>
+double bench_ns(Func &&func)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCH_READS; i++) {
+        func();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / BENCH_READS;
+}
+
+// Swap and mirror, as for a panel mounted rotated by 90 degrees
+void set_rotated(TouchDrvInterface &driver, bool rotated)
+{
+    driver.setSwapXY(rotated);
+    driver.setMirrorXY(rotated, false);
+    driver.setMaxCoordinates(BENCH_X_MAX, BENCH_Y_MAX);
+}
+
+uint32_t checksum;
+
+template <class Driver>
+void bench_driver(const char *name, uint8_t points)
+{
+    BenchDriver<Driver> driver;
+    int16_t x[BENCH_POINTS_MAX] = {}, y[BENCH_POINTS_MAX] = {};
+    double ns[2];
+
+    for (int rotated = 0; rotated < 2; rotated++) {
+        set_rotated(driver, rotated);
+        ns[rotated] = bench_ns([&]() {
+            checksum += driver.getPoint(x, y, points) + x[0] + y[points - 1];
+        });
+    }
+    printf("%-10s %6d %14.1f %14.1f\n", name, points, ns[0], ns[1]);
+}
+
+void bench_transform(uint8_t points)
+{
+    // Read back through volatile so the flags of the legacy loop stay runtime values
+    volatile bool rotated = true;
+    LegacyTransform legacy = {rotated, rotated, false, BENCH_X_MAX, BENCH_Y_MAX};
+    BenchDriver<TouchDrvFT6X36> driver;
+    set_rotated(driver, rotated);
+
+    int16_t x[BENCH_POINTS_MAX], y[BENCH_POINTS_MAX];
+    memcpy(x, sample_x, sizeof(x));
+    memcpy(y, sample_y, sizeof(y));
+    double legacy_ns = bench_ns([&]() {
+        legacy_update_xy(legacy, points, x, y);
+        checksum += x[0];
+    });
+    double selected_ns = bench_ns([&]() {
+        driver.updateXY(points, x, y);
+        checksum += x[0];
+    });
+    printf("%6d %14.2f %14.2f %9.2fx\n", points, legacy_ns, selected_ns, legacy_ns / selected_ns);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    if (!check_transforms()) {
+        return 1;
+    }
+    printf("Transforms match the per point branches for all 16 configurations\n");
+    if ((argc > 1) && !strcmp(argv[1], "--check")) {
+        return 0;
+    }
+
+    const int16_t x[BENCH_POINTS_MAX] = {100, 200, 300, 50, 400};
+    const int16_t y[BENCH_POINTS_MAX] = {120, 240, 360, 480, 60};
+
+    printf("\ngetPoint() on a canned frame, ns per read\n");
+    printf("%-10s %6s %14s %14s\n", "driver", "points", "identity", "rotated");
+    frame_cst816(x[0], y[0]);
+    bench_driver<TouchDrvCST816>("CST816", 1);
+    frame_cst92xx(x, y, CST92XX_MAX_FINGER_NUM);
+    bench_driver<TouchDrvCST92xx>("CST92xx", CST92XX_MAX_FINGER_NUM);
+    frame_ft6x36(x, y, 2);
+    bench_driver<TouchDrvFT6X36>("FT6X36", 2);
+    frame_gt911(x, y, 5);
+    bench_driver<TouchDrvGT911>("GT911", 5);
+
+    printf("\nRotated transform alone, ns per read\n");
+    printf("%6s %14s %14s %10s\n", "points", "per point", "selected", "gain");
+    for (uint8_t points : {1, 2, 5}) {
+        bench_transform(points);
+    }
+    printf("\n(checksum %u)\n", (unsigned)checksum);
+
+    return 0;
+}
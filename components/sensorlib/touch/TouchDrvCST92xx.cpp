@@ -28,7 +28,9 @@
  */
 #include "TouchDrvCST92xx.h"
 
-TouchDrvCST92xx::TouchDrvCST92xx() : comm(nullptr), hal(nullptr),
+TouchDrvCST92xx::TouchDrvCST92xx() : chipType(0),
+    _initState(INIT_STATE_IDLE),
+    comm(nullptr), hal(nullptr),
     _slave_addr(-1),
     _center_btn_x(0),
     _center_btn_y(0)
@@ -60,6 +62,7 @@ bool TouchDrvCST92xx::begin(i2c_port_t port_num, uint8_t addr, int sda, int scl)
     if (!beginCommon<SensorCommI2C, HalEspIDF>(comm, hal, port_num, addr, sda, scl)) {
         return false;
     }
+    _initState = INIT_STATE_IDLE;
     return true;
 }
 #else
@@ -68,6 +71,7 @@ bool TouchDrvCST92xx::begin(i2c_master_bus_handle_t handle, uint8_t addr)
     if (!beginCommon<SensorCommI2C, HalEspIDF>(comm, hal, handle, addr)) {
         return false;
     }
+    _initState = INIT_STATE_IDLE;
     return true;
 }
 #endif  //USEING_I2C_LEGACY
@@ -458,17 +462,12 @@ ERROR:
 
 }
 
-bool TouchDrvCST92xx::getAttribute()
+/**
+ * @note   The chip must have been reset and switched to command mode, see initStep()
+ */
+bool TouchDrvCST92xx::readAttribute()
 {
-    reset();
-
-    // Wait exit boot mode
-    hal->delay(30);
-
     uint8_t buffer[8];
-    // Enter Command mode
-    comm->writeRegister(0xD1, 0x01);
-    hal->delay(10);
     uint8_t write_buffer[2] = {0xD1, 0xFC};
     comm->writeThenRead(write_buffer, 2, buffer, 4);
     uint32_t checkcode = 0;
@@ -692,26 +691,71 @@ void TouchDrvCST92xx::setGpioCallback(CustomMode mode_cb,
     SensorHalCustom::setCustomRead(read_cb);
 }
 
-bool TouchDrvCST92xx::initImpl()
+TouchDrvInterface::InitStepResult TouchDrvCST92xx::initStep(uint32_t &delay_ms)
 {
+    delay_ms = 0;
 
-    if (_rst != -1) {
-        hal->pinMode(_rst, OUTPUT);
+    if (!comm || !hal) {
+        return INIT_STEP_FAILED;
     }
 
-    if (_irq != -1) {
-        hal->pinMode(_irq, INPUT);
+    switch (_initState) {
+    case INIT_STATE_IDLE:
+        if (_irq != -1) {
+            hal->pinMode(_irq, INPUT);
+        }
+        if (_rst != -1) {
+            hal->pinMode(_rst, OUTPUT);
+            hal->digitalWrite(_rst, LOW);
+            delay_ms = 10;
+            _initState = INIT_STATE_RESET_RELEASE;
+            break;
+        }
+        // Wait exit boot mode
+        delay_ms = 30;
+        _initState = INIT_STATE_COMMAND_MODE;
+        break;
+    case INIT_STATE_RESET_RELEASE:
+        hal->digitalWrite(_rst, HIGH);
+        // Wait exit boot mode
+        delay_ms = 30;
+        _initState = INIT_STATE_COMMAND_MODE;
+        break;
+    case INIT_STATE_COMMAND_MODE:
+        // Enter Command mode
+        comm->writeRegister(0xD1, 0x01);
+        delay_ms = 10;
+        _initState = INIT_STATE_READ_ATTRIBUTE;
+        break;
+    case INIT_STATE_READ_ATTRIBUTE:
+        if (!readAttribute()) {
+            _initState = INIT_STATE_FAILED;
+            return INIT_STEP_FAILED;
+        }
+        _chipID = chipType;
+        log_d("Touch type:%s", getModelName());
+        _initState = INIT_STATE_DONE;
+        return INIT_STEP_DONE;
+    case INIT_STATE_DONE:
+        return INIT_STEP_DONE;
+    default:
+        return INIT_STEP_FAILED;
     }
 
-    if (!getAttribute()) {
-        return false;
-    }
+    return INIT_STEP_PENDING;
+}
 
-    _chipID = chipType;
+bool TouchDrvCST92xx::initImpl()
+{
+    uint32_t delay_ms = 0;
+    InitStepResult result;
 
-    log_d("Touch type:%s", getModelName());
+    _initState = INIT_STATE_IDLE;
+    while ((result = initStep(delay_ms)) == INIT_STEP_PENDING) {
+        hal->delay(delay_ms);
+    }
 
-    return true;
+    return result == INIT_STEP_DONE;
 }
 
 
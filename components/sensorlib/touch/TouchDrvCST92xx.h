@@ -95,13 +95,29 @@ public:
                          CustomWrite write_cb,
                          CustomRead read_cb);
 
+    /**
+     * @brief  Resumable version of the initialization done by the blocking begin() variants.
+     *         On ESP-IDF begin() only sets up the bus, so the chip is initialized by calling
+     *         initStep() until it stops returning INIT_STEP_PENDING
+     */
+    InitStepResult initStep(uint32_t &delay_ms) override;
+
 private:
 
+    enum InitState {
+        INIT_STATE_IDLE,
+        INIT_STATE_RESET_RELEASE,
+        INIT_STATE_COMMAND_MODE,
+        INIT_STATE_READ_ATTRIBUTE,
+        INIT_STATE_DONE,
+        INIT_STATE_FAILED,
+    };
+
 
 
     bool setMode(uint8_t mode);
     bool enterBootloader();
-    bool getAttribute();
+    bool readAttribute();
     uint32_t readWordFromMem(uint8_t type, uint16_t mem_addr);
     void parseFingerData(uint8_t *data,  cst9xx_point_t *point);
     uint32_t get_u32_from_ptr(const void *ptr);
@@ -149,6 +165,7 @@ private:
     bool initImpl();
 
     uint16_t chipType;
+    InitState _initState;
 
 protected:
     std::unique_ptr<SensorCommBase> comm;
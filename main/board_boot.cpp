@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include <array>
+#include <mutex>
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "boost/thread.hpp"
+#ifdef ESP_UTILS_LOG_TAG
+#   undef ESP_UTILS_LOG_TAG
+#endif
+#define ESP_UTILS_LOG_TAG "Main:Boot"
+#include "esp_lib_utils.h"
+#include "board_boot.hpp"
+
+constexpr size_t BOARD_BOOT_STAGE_NUM_MAX = 16;
+// Time to the first frame of the watchface
+constexpr int BOARD_BOOT_TARGET_MS = 500;
+// `app_main()` runs on the first core, the independent steps are left to the second one
+constexpr int BOARD_BOOT_JOB_CORE_ID = (portNUM_PROCESSORS > 1) ? 1 : 0;
+constexpr size_t BOARD_BOOT_JOB_STACK_SIZE = 4096;
+
+struct BootStage {
+    const char *name;
+    int64_t time_us;    /*!< Time since the system timer started */
+    int core_id;        /*!< Core which reached the stage */
+};
+
+static std::mutex boot_mutex;
+static std::array<BootStage, BOARD_BOOT_STAGE_NUM_MAX> boot_stages = {};
+static size_t boot_stage_num = 0;
+static bool is_boot_reported = false;
+
+static void board_boot_report(void)
+{
+    int64_t first_frame_us = esp_timer_get_time();
+
+    std::lock_guard<std::mutex> lock(boot_mutex);
+
+    // Marked under the same lock as the report, so it stays the last stage even if a boot job finishes meanwhile
+    if (boot_stage_num < boot_stages.size()) {
+        boot_stages[boot_stage_num++] = {"first_frame", first_frame_us, static_cast<int>(xPortGetCoreID())};
+    }
+
+    // The stages of the second core are interleaved with the ones of `app_main()`, so each delta is taken from the
+    // previous stage of the same core
+    std::array<int64_t, portNUM_PROCESSORS> last_us = {};
+    ESP_UTILS_LOGI("\t%-16s %9s %9s %4s", "Stage", "Time", "Delta", "Core");
+    for (size_t i = 0; i < boot_stage_num; i++) {
+        auto &stage = boot_stages[i];
+        ESP_UTILS_LOGI(
+            "\t%-16s %6d ms %+6d ms %4d", stage.name, static_cast<int>(stage.time_us / 1000),
+            static_cast<int>((stage.time_us - last_us[stage.core_id]) / 1000), stage.core_id
+        );
+        last_us[stage.core_id] = stage.time_us;
+    }
+    is_boot_reported = true;
+
+    int first_frame_ms = static_cast<int>(first_frame_us / 1000);
+    if (first_frame_ms > BOARD_BOOT_TARGET_MS) {
+        ESP_UTILS_LOGW("Boot to first frame: %d ms, over the target of %d ms", first_frame_ms, BOARD_BOOT_TARGET_MS);
+    } else {
+        ESP_UTILS_LOGI("Boot to first frame: %d ms", first_frame_ms);
+    }
+}
+
+void board_boot_mark(const char *stage)
+{
+    int64_t now_us = esp_timer_get_time();
+    int core_id = static_cast<int>(xPortGetCoreID());
+
+    std::lock_guard<std::mutex> lock(boot_mutex);
+
+    // The stages reached after the first frame (e.g. a slow peripheral) are reported on their own
+    if (is_boot_reported) {
+        ESP_UTILS_LOGI("Boot stage (%s) reached at %d ms", stage, static_cast<int>(now_us / 1000));
+        return;
+    }
+    ESP_UTILS_CHECK_FALSE_EXIT(boot_stage_num < boot_stages.size(), "Too many boot stages");
+
+    boot_stages[boot_stage_num++] = {stage, now_us, core_id};
+}
+
+bool board_boot_run_job(const char *name, board_boot_job_t job)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(name, false, "Invalid name");
+    ESP_UTILS_CHECK_FALSE_RETURN(job != nullptr, false, "Invalid job");
+
+    esp_utils::thread_config_guard thread_config({
+        .name = "BootJob",
+        .core_id = BOARD_BOOT_JOB_CORE_ID,
+        .stack_size = BOARD_BOOT_JOB_STACK_SIZE,
+    });
+    boost::thread([name, job = std::move(job)]() {
+        if (!job()) {
+            ESP_UTILS_LOGE("Boot job(%s) failed", name);
+        }
+        board_boot_mark(name);
+    }).detach();
+
+    return true;
+}
+
+bool board_boot_watch_first_frame(lv_display_t *display)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(display, false, "Invalid display");
+
+    // A flush only covers a band of the partial buffers, the frame is complete when the refresh which flushed it is
+    // ready. The refreshes with nothing to draw are ready too, so only the ones with a flush count
+    static bool is_flushed = false;
+    lv_display_add_event_cb(display, [](lv_event_t *e) {
+        is_flushed = true;
+    }, LV_EVENT_FLUSH_FINISH, nullptr);
+    lv_display_add_event_cb(display, [](lv_event_t *e) {
+        static bool is_first_frame = true;
+        if (!is_flushed || !is_first_frame) {
+            return;
+        }
+        is_first_frame = false;
+
+        board_boot_report();
+    }, LV_EVENT_REFR_READY, nullptr);
+
+    return true;
+}
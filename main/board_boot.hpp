@@ -0,0 +1,44 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <functional>
+#include "lvgl.h"
+
+/**
+ * @brief A step of the bring-up which doesn't need the display nor the phone, returns true if success
+ */
+using board_boot_job_t = std::function<bool(void)>;
+
+/**
+ * @brief Record the time at which a boot stage has been reached, it can be called from any task
+ *
+ * @param[in] stage Name of the stage, must stay valid until the boot is reported
+ */
+void board_boot_mark(const char *stage);
+
+/**
+ * @brief Run an independent step of the bring-up (e.g. a driver or a partition to map) on the second core, in
+ *        parallel with the display and the phone brought up by `app_main()`. The step is marked as a boot stage once
+ *        it's done, whether it succeeded or not
+ *
+ * @param[in] name Name of the step, used as its boot stage, must stay valid until the boot is reported
+ * @param[in] job The step to run
+ *
+ * @return true if the step has been started, otherwise false
+ */
+bool board_boot_run_job(const char *name, board_boot_job_t job);
+
+/**
+ * @brief Report the boot timeline as a table once the next frame has been flushed as a whole (all the bands of the
+ *        partial buffers), the time to that first frame is what the user waits for and is checked against the boot
+ *        target. Should be called with the LVGL lock held, right after the first screen has been created
+ *
+ * @param[in] display The display created by the BSP
+ *
+ * @return true if success, otherwise false
+ */
+bool board_boot_watch_first_frame(lv_display_t *display);
@@ -0,0 +1,251 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include "esp_console.h"
+#include "esp_brookesia.hpp"
+#include "esp_brookesia_app_squareline_demo.hpp"
+#ifdef ESP_UTILS_LOG_TAG
+#   undef ESP_UTILS_LOG_TAG
+#endif
+#define ESP_UTILS_LOG_TAG "Main:Console"
+#include "esp_lib_utils.h"
+#include "board_console.hpp"
+#include "board_display.hpp"
+
+using namespace esp_brookesia;
+using namespace esp_brookesia::gui;
+using namespace esp_brookesia::systems::phone;
+
+constexpr LvRenderProfiler::Config RENDER_PROFILER_CONFIG = {
+    .frame_num = 120,
+    .top_num = 8,
+};
+
+static Phone *s_phone = nullptr;
+
+static int board_console_latency(int argc, char **argv)
+{
+    // The monitor is updated by the LVGL task
+    LvLockGuard gui_guard;
+
+    auto &monitor = LvLatencyMonitor::getInstance();
+    ESP_UTILS_CHECK_FALSE_RETURN(monitor.isRunning(), 1, "Latency monitor is not running");
+
+    if ((argc > 1) && (strcmp(argv[1], "reset") == 0)) {
+        monitor.reset();
+        return 0;
+    }
+    monitor.dump();
+
+    return 0;
+}
+
+static int board_console_display(int argc, char **argv)
+{
+    LvLockGuard gui_guard;
+
+    board_display_dump_stats((argc > 1) && (strcmp(argv[1], "reset") == 0));
+
+    return 0;
+}
+
+static int board_console_sweep(int argc, char **argv)
+{
+    LvLockGuard gui_guard;
+
+    auto app = apps::SquarelineDemo::requestInstance();
+    if (argc > 1) {
+        bool enable = (strcmp(argv[1], "on") == 0);
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            enable || (strcmp(argv[1], "off") == 0), 1, "Invalid argument(%s), should be `on` or `off`", argv[1]
+        );
+        ESP_UTILS_CHECK_FALSE_RETURN(app->setSweepMode(enable), 1, "Set sweep mode failed");
+    }
+    ESP_UTILS_LOGI("Sweep mode: %s", app->isSweepMode() ? "on" : "off");
+
+    return 0;
+}
+
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+static int board_console_watchface(int argc, char **argv)
+{
+    LvLockGuard gui_guard;
+
+    auto app = apps::SquarelineDemo::requestInstance();
+    if ((argc > 1) && (strcmp(argv[1], "complication") == 0)) {
+        ESP_UTILS_CHECK_FALSE_RETURN(argc > 3, 1, "Missing complication ID or value");
+        int id = atoi(argv[2]);
+        int value = atoi(argv[3]);
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            (id >= 0) && (id <= UINT8_MAX) && (value >= 0) && (value <= 100), 1,
+            "Invalid complication ID(%d) or value(%d), should be 0-255 and 0-100", id, value
+        );
+        app->setWatchfaceComplication(id, value);
+        return 0;
+    }
+    if (argc > 1) {
+        const char *path = (strcmp(argv[1], "off") == 0) ? nullptr : argv[1];
+        ESP_UTILS_CHECK_FALSE_RETURN(app->setWatchface(path), 1, "Set watchface(%s) failed", argv[1]);
+    }
+    ESP_UTILS_LOGI(
+        "Watchface: %s", app->getWatchfacePath().empty() ? "SquareLine" : app->getWatchfacePath().c_str()
+    );
+
+    return 0;
+}
+#endif
+
+static int board_console_profiler(int argc, char **argv)
+{
+    LvLockGuard gui_guard;
+
+    auto &profiler = LvRenderProfiler::getInstance();
+    const char *action = (argc > 1) ? argv[1] : "dump";
+    if (strcmp(action, "on") == 0) {
+        if (!profiler.isRunning()) {
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                profiler.begin(RENDER_PROFILER_CONFIG, lv_display_get_default()), 1, "Begin render profiler failed"
+            );
+        }
+        return 0;
+    }
+    if (strcmp(action, "off") == 0) {
+        ESP_UTILS_CHECK_FALSE_RETURN(profiler.del(), 1, "Delete render profiler failed");
+        return 0;
+    }
+    ESP_UTILS_CHECK_FALSE_RETURN(profiler.isRunning(), 1, "Render profiler is not running, start it with `on`");
+
+    if (strcmp(action, "reset") == 0) {
+        profiler.reset();
+    } else if (strcmp(action, "dump") == 0) {
+        profiler.dump();
+    } else if (strcmp(action, "trace") == 0) {
+        // Without a path, the trace is printed to be copied from the serial output
+        FILE *file = (argc > 2) ? fopen(argv[2], "w") : stdout;
+        ESP_UTILS_CHECK_NULL_RETURN(file, 1, "Open file(%s) failed", argv[2]);
+        bool is_written = profiler.dumpTrace(file);
+        if (file != stdout) {
+            fclose(file);
+        }
+        ESP_UTILS_CHECK_FALSE_RETURN(is_written, 1, "Write trace failed");
+    } else if (strcmp(action, "overlay") == 0) {
+        auto recents_screen = s_phone->getDisplay().getRecentsScreen();
+        ESP_UTILS_CHECK_NULL_RETURN(recents_screen, 1, "Invalid recents screen");
+        // The overlay replaces the memory usage shown on the recents screen
+        LvRenderProfiler::OverlayCallback callback = nullptr;
+        if ((argc > 2) && (strcmp(argv[2], "on") == 0)) {
+            callback = [recents_screen](const char *text) {
+                recents_screen->setMemoryLabelText(text);
+            };
+        }
+        ESP_UTILS_CHECK_FALSE_RETURN(profiler.setOverlayCallback(callback), 1, "Set overlay failed");
+    } else {
+        ESP_UTILS_LOGE("Invalid argument(%s)", action);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int board_console_snapshots(int argc, char **argv)
+{
+    LvLockGuard gui_guard;
+
+    auto &manager = s_phone->getManager();
+    if ((argc > 2) && (strcmp(argv[1], "async") == 0)) {
+        bool enable = (strcmp(argv[2], "on") == 0);
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            enable || (strcmp(argv[2], "off") == 0), 1, "Invalid argument(%s), should be `on` or `off`", argv[2]
+        );
+        // Compare the `app_switch` latency before and after, after resetting it with `latency reset`
+        manager.setAppSnapshotAsync(enable);
+    }
+    manager.dumpAppSnapshots();
+
+    return 0;
+}
+
+static const esp_console_cmd_t board_console_cmds[] = {
+    {
+        .command = "latency",
+        .help = "Show the touch-to-photon latency percentiles per interaction, `reset` to clear them",
+        .hint = "[reset]",
+        .func = board_console_latency,
+    },
+    {
+        .command = "display",
+        .help = "Show the draw buffers and the refresh stats (e.g. overlap and fps after a recents drag), `reset` to "
+        "clear them after showing them",
+        .hint = "[reset]",
+        .func = board_console_display,
+    },
+    {
+        .command = "sweep",
+        .help = "Show or switch the smooth sweep of the watchface seconds hand, its stats are logged every minute",
+        .hint = "[on|off]",
+        .func = board_console_sweep,
+    },
+#if ESP_BROOKESIA_GUI_ENABLE_WATCHFACE
+    {
+        .command = "watchface",
+        .help = "Show or switch the watchface, by the name of a face in the assets partition (e.g. `analog`) or a face "
+        "file path, or set the value of a complication of the face",
+        .hint = "[<name>|<path>|off|complication <id> <value>]",
+        .func = board_console_watchface,
+    },
+#endif
+    {
+        .command = "profiler",
+        .help = "Start or stop the render profiler, show its stats (default), dump its frames as Chrome trace JSON or "
+        "show its overlay on the recents screen",
+        .hint = "[on|off|reset|dump|trace [<path>]|overlay <on|off>]",
+        .func = board_console_profiler,
+    },
+    {
+        .command = "snapshots",
+        .help = "Show the size of the app snapshots kept for the recents screen, the free PSRAM and the time spent "
+        "capturing the last one, or switch their capture after the app switch",
+        .hint = "[async <on|off>]",
+        .func = board_console_snapshots,
+    },
+};
+
+bool board_console_init(Phone *phone)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(phone, false, "Invalid phone");
+    s_phone = phone;
+
+    esp_console_repl_t *repl = nullptr;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    repl_config.prompt = "watch>";
+
+#if defined(CONFIG_ESP_CONSOLE_UART_DEFAULT) || defined(CONFIG_ESP_CONSOLE_UART_CUSTOM)
+    esp_console_dev_uart_config_t hw_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        esp_console_new_repl_uart(&hw_config, &repl_config, &repl), false, "Create UART console failed"
+    );
+#elif defined(CONFIG_ESP_CONSOLE_USB_SERIAL_JTAG)
+    esp_console_dev_usb_serial_jtag_config_t hw_config = ESP_CONSOLE_DEV_USB_SERIAL_JTAG_CONFIG_DEFAULT();
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        esp_console_new_repl_usb_serial_jtag(&hw_config, &repl_config, &repl), false,
+        "Create USB serial JTAG console failed"
+    );
+#else
+    ESP_UTILS_LOGW("No console device is enabled");
+    return true;
+#endif
+
+    for (auto &cmd : board_console_cmds) {
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            esp_console_cmd_register(&cmd), false, "Register command(%s) failed", cmd.command
+        );
+    }
+    ESP_UTILS_CHECK_ERROR_RETURN(esp_console_start_repl(repl), false, "Start console failed");
+
+    return true;
+}
@@ -0,0 +1,25 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include "esp_brookesia.hpp"
+
+/**
+ * @brief Start a console on the serial port with the commands to inspect the GUI performance:
+ *        - `latency [reset]`: touch-to-photon latency percentiles per interaction
+ *        - `display [reset]`: draw buffers and refresh stats, e.g. the flush overlap and the frame rate
+ *        - `sweep [on|off]`: smooth sweep of the watchface seconds hand
+ *        - `watchface [<name>|<path>|off|complication <id> <value>]`: watchface loaded from a binary face of the
+ *          assets partition, or from a file on a mounted filesystem, and the values of its complications, if
+ *          `CONFIG_ESP_BROOKESIA_GUI_ENABLE_WATCHFACE` is enabled
+ *        - `profiler [on|off|reset|dump|trace [<path>]|overlay <on|off>]`: per-frame render profiler
+ *        - `snapshots [async <on|off>]`: memory used by the app snapshots of the recents screen and their capture
+ *
+ * @param[in] phone Phone showing the profiler overlay on its recents screen
+ *
+ * @return true if success, otherwise false
+ */
+bool board_console_init(esp_brookesia::systems::phone::Phone *phone);
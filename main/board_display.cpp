@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include "bsp/esp-bsp.h"
+#include "esp_heap_caps.h"
+#include "esp_brookesia.hpp"
+#ifdef ESP_UTILS_LOG_TAG
+#   undef ESP_UTILS_LOG_TAG
+#endif
+#define ESP_UTILS_LOG_TAG "Main:Display"
+#include "esp_lib_utils.h"
+#include "board_display.hpp"
+#include "board_rgb565_swap.hpp"
+
+using namespace esp_brookesia::gui;
+
+/* 40 lines of 410 RGB565 pixels are 32.8KB per buffer, a tenth of the screen per transfer */
+constexpr uint32_t BOARD_DISPLAY_BUFFER_LINES = 40;
+constexpr bool BOARD_DISPLAY_DOUBLE_BUFFER = true;
+/* Left in internal DMA-capable RAM for the drivers (e.g. the SPI bounce buffers) once the draw buffers are taken */
+constexpr size_t BOARD_DISPLAY_INTERNAL_RESERVE_SIZE = 32 * 1024;
+#if CONFIG_BOARD_DISPLAY_RGB565_SWAP_SIMD
+constexpr bool BOARD_DISPLAY_RGB565_SWAP_SIMD = true;
+#else
+constexpr bool BOARD_DISPLAY_RGB565_SWAP_SIMD = false;
+#endif
+
+static bool is_buffer_internal = false;
+static LvRefreshMonitorUniquePtr refresh_monitor;
+
+#if CONFIG_BOARD_DISPLAY_RGB565_SWAP_SIMD
+/* Installed with `-Wl,--wrap` in CMakeLists.txt, the LVGL port calls it on every flushed area for the panel */
+extern "C" void __wrap_lv_draw_sw_rgb565_swap(void *buf, uint32_t buf_size_px)
+{
+    board_rgb565_swap(static_cast<uint16_t *>(buf), buf_size_px);
+}
+#endif
+
+lv_display_t *board_display_start(const lvgl_port_cfg_t &port_cfg)
+{
+    ESP_UTILS_LOG_TRACE_GUARD();
+
+    size_t buffer_size = BSP_LCD_H_RES * BOARD_DISPLAY_BUFFER_LINES;
+    size_t buffer_bytes = buffer_size * sizeof(uint16_t);
+    size_t buffer_num = BOARD_DISPLAY_DOUBLE_BUFFER ? 2 : 1;
+
+    // The BSP can't retry once the panel is initialized, so check the internal RAM before starting it
+    size_t internal_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+    size_t internal_largest = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+    is_buffer_internal = (internal_largest >= buffer_bytes) &&
+                         (internal_free >= buffer_bytes * buffer_num + BOARD_DISPLAY_INTERNAL_RESERVE_SIZE);
+    if (!is_buffer_internal) {
+        ESP_UTILS_LOGW(
+            "Not enough internal RAM for the draw buffers (free: %d, largest: %d), use PSRAM",
+            static_cast<int>(internal_free), static_cast<int>(internal_largest)
+        );
+    }
+
+    bsp_display_cfg_t cfg = {
+        .lvgl_port_cfg = port_cfg,
+        .buffer_size = buffer_size,
+        .double_buffer = BOARD_DISPLAY_DOUBLE_BUFFER,
+        .flags = {
+            .buff_dma = is_buffer_internal,
+            .buff_spiram = !is_buffer_internal,
+        },
+    };
+    lv_display_t *display = bsp_display_start_with_config(&cfg);
+    ESP_UTILS_CHECK_NULL_RETURN(display, nullptr, "Start display failed");
+
+    // The port task is already running, so the monitor is created with the lock held
+    ESP_UTILS_CHECK_FALSE_RETURN(bsp_display_lock(0), nullptr, "Lock failed");
+    refresh_monitor = std::make_unique<LvRefreshMonitor>(display);
+    bsp_display_unlock();
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (refresh_monitor != nullptr) && refresh_monitor->isValid(), display, "Create refresh monitor failed"
+    );
+
+    return display;
+}
+
+void board_display_dump_stats(bool reset)
+{
+    ESP_UTILS_CHECK_NULL_EXIT(refresh_monitor, "Display is not started");
+
+    ESP_UTILS_LOGI(
+        "Draw buffers: %d x %d lines in %s, RGB565 swap: %s", BOARD_DISPLAY_DOUBLE_BUFFER ? 2 : 1,
+        static_cast<int>(BOARD_DISPLAY_BUFFER_LINES), is_buffer_internal ? "internal RAM" : "PSRAM",
+        BOARD_DISPLAY_RGB565_SWAP_SIMD ? "SIMD" : "LVGL"
+    );
+    refresh_monitor->dump("Display");
+    if (reset) {
+        refresh_monitor->reset();
+    }
+}
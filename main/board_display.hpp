@@ -0,0 +1,29 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include "lvgl.h"
+#include "esp_lvgl_port.h"
+
+/**
+ * @brief Start the display of the BSP with two partial draw buffers in internal DMA-capable RAM, so LVGL renders the
+ *        next area while the previous one is sent to the panel. Falls back to PSRAM draw buffers if the internal RAM
+ *        can't hold them. The refreshes are monitored from here on, see `board_display_dump_stats()`. The bytes of
+ *        the flushed areas are swapped by `board_rgb565_swap()` if `CONFIG_BOARD_DISPLAY_RGB565_SWAP_SIMD` is enabled
+ *
+ * @param[in] port_cfg Configuration of the LVGL port
+ *
+ * @return The display, or nullptr if failed
+ */
+lv_display_t *board_display_start(const lvgl_port_cfg_t &port_cfg);
+
+/**
+ * @brief Log the draw buffers and the refresh stats since the start or the last reset: render time, time in the flush
+ *        callback and waiting for the transfers, overlap and frame rate. Should be called with the LVGL lock held
+ *
+ * @param[in] reset Reset the stats after logging them, e.g. to measure a single animation
+ */
+void board_display_dump_stats(bool reset);
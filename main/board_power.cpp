@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include "bsp/esp-bsp.h"
+#include "esp_brookesia.hpp"
+#ifdef ESP_UTILS_LOG_TAG
+#   undef ESP_UTILS_LOG_TAG
+#endif
+#define ESP_UTILS_LOG_TAG "Main:Power"
+#include "esp_lib_utils.h"
+#if ESP_BROOKESIA_GUI_ENABLE_ANIM_PLAYER
+#   include "gui/anim_player/esp_brookesia_anim_player.hpp"
+#endif
+#include "board_touch.hpp"
+#include "board_power.hpp"
+
+using namespace esp_brookesia::gui;
+using namespace esp_brookesia::services;
+using namespace esp_brookesia::systems::phone;
+
+/* Wakeup pins of the ESP32-S3-Touch-AMOLED-2.06, all of them are active low */
+constexpr gpio_num_t BOARD_BUTTON_GPIO = GPIO_NUM_0;
+constexpr gpio_num_t BOARD_TOUCH_INT_GPIO = GPIO_NUM_38;
+constexpr gpio_num_t BOARD_RTC_INT_GPIO = GPIO_NUM_39;
+
+constexpr uint32_t BOARD_POWER_DIM_MS = 15 * 1000;
+constexpr uint32_t BOARD_POWER_DISPLAY_OFF_MS = 20 * 1000;
+constexpr uint32_t BOARD_POWER_LIGHT_SLEEP_MS = 30 * 1000;
+constexpr int BOARD_BRIGHTNESS_ACTIVE = 100;
+constexpr int BOARD_BRIGHTNESS_DIM = 20;
+/* The CPU runs at the minimum frequency unless the governor boosts it for the UI */
+constexpr int BOARD_CPU_FREQ_MIN_MHZ = 80;
+constexpr uint32_t BOARD_CPU_BOOST_RELEASE_DELAY_MS = 100;
+
+bool board_power_init(lv_display_t *display)
+{
+    Power::Config config = {
+        .timeout = {
+            .dim_ms = BOARD_POWER_DIM_MS,
+            .display_off_ms = BOARD_POWER_DISPLAY_OFF_MS,
+            .light_sleep_ms = BOARD_POWER_LIGHT_SLEEP_MS,
+        },
+        .brightness = {
+            .active_percent = BOARD_BRIGHTNESS_ACTIVE,
+            .dim_percent = BOARD_BRIGHTNESS_DIM,
+        },
+        .cpu = {
+            .max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ,
+            .min_freq_mhz = BOARD_CPU_FREQ_MIN_MHZ,
+        },
+        .wakeup_gpios = {
+            {BOARD_BUTTON_GPIO, Power::WakeupSource::Button, true},
+            // The touch IRQ is owned by the interrupt driven touch input if any, see `board_touch_init()`
+            {
+                (board_touch_get_input() != nullptr) ? GPIO_NUM_NC : BOARD_TOUCH_INT_GPIO,
+                Power::WakeupSource::Touch, true
+            },
+            {BOARD_RTC_INT_GPIO, Power::WakeupSource::RtcAlarm, true},
+        },
+        .board = {
+            .set_brightness = [](int percent) {
+                ESP_UTILS_CHECK_ERROR_RETURN(bsp_display_brightness_set(percent), false, "Set brightness failed");
+                return true;
+            },
+            // The BSP doesn't expose the panel handle, so the AMOLED is put to sleep through its brightness command
+            .set_panel_sleep = [](bool sleep) {
+                ESP_UTILS_CHECK_ERROR_RETURN(
+                    sleep ? bsp_display_backlight_off() : bsp_display_backlight_on(), false, "Set panel sleep failed"
+                );
+                return true;
+            },
+            // Keep the touch IC powered so its IRQ can still wake up the system, only stop LVGL from reading it
+            .set_touch_sleep = [](bool sleep) {
+                auto touch_input = board_touch_get_input();
+                auto indev = (touch_input != nullptr) ? touch_input->getIndev() : bsp_display_get_input_dev();
+                ESP_UTILS_CHECK_NULL_RETURN(indev, false, "Invalid input device");
+
+                LvLockGuard gui_guard;
+                lv_indev_enable(indev, !sleep);
+                return true;
+            },
+            .set_gui_pause = [](bool pause) {
+                ESP_UTILS_CHECK_FALSE_RETURN(
+                    pause ? LvScheduler::getInstance().pause() : LvScheduler::getInstance().resume(), false,
+                    "Set GUI pause failed"
+                );
+                return true;
+            },
+            .on_wakeup = nullptr,
+        },
+    };
+    ESP_UTILS_CHECK_FALSE_RETURN(Power::requestInstance().begin(config, display), false, "Begin power failed");
+
+    /* The governor relies on the PM configuration done by the power service */
+    ESP_UTILS_CHECK_FALSE_RETURN(CpuGovernor::requestInstance().begin({
+        .release_delay_ms = BOARD_CPU_BOOST_RELEASE_DELAY_MS,
+    }, display), false, "Begin CPU governor failed");
+    Gesture::boost_request_signal.connect([](bool boost, Gesture *) {
+        CpuGovernor::requestInstance().requestBoost(CpuGovernor::BoostSource::Gesture, boost);
+    });
+#if ESP_BROOKESIA_GUI_ENABLE_ANIM_PLAYER
+    AnimPlayer::boost_request_signal.connect([](bool boost, AnimPlayer *) {
+        CpuGovernor::requestInstance().requestBoost(CpuGovernor::BoostSource::AnimPlayer, boost);
+    });
+#endif
+
+    return true;
+}
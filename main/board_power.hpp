@@ -0,0 +1,18 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include "lvgl.h"
+
+/**
+ * @brief Start the power service with the board specific wakeup sources and display/touch operations, then the CPU
+ *        governor boosted by the gestures and animations
+ *
+ * @param[in] display The display created by the BSP
+ *
+ * @return true if success, otherwise false
+ */
+bool board_power_init(lv_display_t *display);
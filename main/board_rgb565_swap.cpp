@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstring>
+#ifdef ESP_PLATFORM
+#   include "sdkconfig.h"
+#endif
+#include "board_rgb565_swap.hpp"
+
+/* Pixels of a block, two 128-bit vectors */
+constexpr size_t BOARD_RGB565_SWAP_BLOCK_PIXELS = 16;
+constexpr uintptr_t BOARD_RGB565_SWAP_ALIGN = 16;
+
+#if CONFIG_BOARD_DISPLAY_RGB565_SWAP_SIMD
+/* board_rgb565_swap_esp32s3.S, `buf` must be 16-byte aligned */
+extern "C" void board_rgb565_swap_blocks_esp32s3(uint16_t *buf, size_t block_num);
+#else
+static void board_rgb565_swap_blocks_words(uint16_t *buf, size_t block_num)
+{
+    for (size_t i = 0; i < block_num * BOARD_RGB565_SWAP_BLOCK_PIXELS; i += 2) {
+        uint32_t word;
+        memcpy(&word, buf + i, sizeof(word));
+        word = ((word & 0xff00ff00) >> 8) | ((word & 0x00ff00ff) << 8);
+        memcpy(buf + i, &word, sizeof(word));
+    }
+}
+#endif
+
+void board_rgb565_swap(uint16_t *buf, size_t pixel_num)
+{
+    // A buffer which isn't 2-byte aligned never reaches the boundary, it is swapped one pixel at a time
+    while ((pixel_num > 0) && (reinterpret_cast<uintptr_t>(buf) % BOARD_RGB565_SWAP_ALIGN)) {
+        *buf = (*buf >> 8) | (*buf << 8);
+        buf++;
+        pixel_num--;
+    }
+
+    size_t block_num = pixel_num / BOARD_RGB565_SWAP_BLOCK_PIXELS;
+    if (block_num > 0) {
+#if CONFIG_BOARD_DISPLAY_RGB565_SWAP_SIMD
+        board_rgb565_swap_blocks_esp32s3(buf, block_num);
+#else
+        board_rgb565_swap_blocks_words(buf, block_num);
+#endif
+        buf += block_num * BOARD_RGB565_SWAP_BLOCK_PIXELS;
+        pixel_num -= block_num * BOARD_RGB565_SWAP_BLOCK_PIXELS;
+    }
+
+    while (pixel_num > 0) {
+        *buf = (*buf >> 8) | (*buf << 8);
+        buf++;
+        pixel_num--;
+    }
+}
@@ -0,0 +1,19 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Swap the bytes of RGB565 pixels in place. Up to the first 16-byte boundary and after the last one the
+ *        pixels are swapped one by one, the blocks of 16 pixels in between with the PIE vector instructions on the
+ *        ESP32-S3 (`CONFIG_BOARD_DISPLAY_RGB565_SWAP_SIMD`), two pixels per word otherwise
+ *
+ * @param[in,out] buf Pixels to swap
+ * @param[in] pixel_num Number of pixels
+ */
+void board_rgb565_swap(uint16_t *buf, size_t pixel_num);
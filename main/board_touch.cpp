@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include <atomic>
+#include "bsp/esp-bsp.h"
+#include "esp_lvgl_port.h"
+#include "TouchDrvFT6X36.hpp"
+#include "esp_brookesia.hpp"
+#include "boost/thread.hpp"
+#ifdef ESP_UTILS_LOG_TAG
+#   undef ESP_UTILS_LOG_TAG
+#endif
+#define ESP_UTILS_LOG_TAG "Main:Touch"
+#include "esp_lib_utils.h"
+#include "board_boot.hpp"
+#include "board_touch.hpp"
+
+using namespace esp_brookesia::gui;
+using namespace esp_brookesia::services;
+
+/* The FT3168 of the ESP32-S3-Touch-AMOLED-2.06 is register compatible with the FT6x36 */
+constexpr gpio_num_t BOARD_TOUCH_INT_GPIO = GPIO_NUM_38;
+constexpr uint8_t BOARD_TOUCH_I2C_ADDRESS = FT6X36_SLAVE_ADDRESS;
+/* Matches the report rate of the touch IC while a finger is down */
+constexpr uint32_t BOARD_TOUCH_SAMPLE_PERIOD_MS = 10;
+
+static TouchDrvFT6X36 touch_drv;
+static std::atomic<bool> is_touch_drv_ready = false;
+static LvTouchInputUniquePtr touch_input;
+
+static bool board_touch_init_driver(void)
+{
+    ESP_UTILS_LOG_TRACE_GUARD();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        touch_drv.begin(bsp_i2c_get_handle(), BOARD_TOUCH_I2C_ADDRESS), false, "Begin touch driver failed"
+    );
+
+    // On ESP-IDF `begin()` only sets up the bus, sleep through the reset delays of the driver instead of blocking in
+    // them. The reset pin isn't wired to the driver here, so the chip is probed at once
+    uint32_t delay_ms = 0;
+    TouchDrvInterface::InitStepResult result = TouchDrvInterface::INIT_STEP_PENDING;
+    while ((result = touch_drv.initStep(delay_ms)) == TouchDrvInterface::INIT_STEP_PENDING) {
+        boost::this_thread::sleep_for(boost::chrono::milliseconds(delay_ms));
+    }
+    ESP_UTILS_CHECK_FALSE_RETURN(result == TouchDrvInterface::INIT_STEP_DONE, false, "Init touch driver failed");
+
+    // Assert the IRQ during the whole contact, not only when the touch state changes
+    touch_drv.interruptTrigger();
+
+    return true;
+}
+
+lv_indev_t *board_touch_init(lv_display_t *display, board_touch_ready_cb_t ready_cb)
+{
+    lv_indev_t *bsp_indev = bsp_display_get_input_dev();
+
+    ESP_UTILS_CHECK_NULL_RETURN(display, bsp_indev, "Invalid display");
+
+    auto input = std::make_unique<LvTouchInput>();
+    ESP_UTILS_CHECK_NULL_RETURN(input, bsp_indev, "Create touch input failed");
+
+    ESP_UTILS_CHECK_FALSE_RETURN(input->begin({
+        .task_name = "TouchInput",
+        .task_priority = 5,
+        .task_stack = 6 * 1024,
+        .task_affinity = -1,
+        .task_stack_in_ext = false,
+        .irq_gpio = BOARD_TOUCH_INT_GPIO,
+        .irq_active_low = true,
+        .irq_sleep_wakeup = true,
+        .sample_period_ms = BOARD_TOUCH_SAMPLE_PERIOD_MS,
+        .read_cb = [](int16_t &x, int16_t &y) {
+            // An IRQ raised while the driver is starting is seen as a release, which is ignored
+            if (!is_touch_drv_ready) {
+                return false;
+            }
+            return (touch_drv.getPoint(&x, &y, 1) > 0);
+        },
+    }, display), bsp_indev, "Begin touch input failed");
+
+    // The power service isn't notified by the IRQ directly, as the touch input owns it
+    input->connectSampleSignal([is_pressed = false](const LvTouchInput::Sample & sample) mutable {
+        if (sample.pressed && !is_pressed && (Power::requestInstance().getState() != Power::State::Active)) {
+            Power::requestInstance().notifyWakeup(Power::WakeupSource::Touch);
+        }
+        is_pressed = sample.pressed;
+    });
+
+    touch_input = std::move(input);
+
+    // Drop the BSP touch device, it would keep polling the touch IC
+    if (bsp_indev != nullptr) {
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            lvgl_port_remove_touch(bsp_indev), touch_input->getIndev(), "Remove BSP touch failed"
+        );
+    }
+
+    bool is_job_started = board_boot_run_job("touch", [ready_cb]() {
+        bool success = board_touch_init_driver();
+        if (success) {
+            is_touch_drv_ready = true;
+        } else {
+            ESP_UTILS_LOGE("Touch driver isn't available, the touch device will stay released");
+        }
+        if (ready_cb) {
+            ready_cb(success);
+        }
+
+        return success;
+    });
+    ESP_UTILS_CHECK_FALSE_RETURN(is_job_started, touch_input->getIndev(), "Run touch init job failed");
+
+    return touch_input->getIndev();
+}
+
+LvTouchInput *board_touch_get_input(void)
+{
+    return touch_input.get();
+}
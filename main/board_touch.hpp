@@ -0,0 +1,33 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <functional>
+#include "lvgl.h"
+#include "esp_brookesia.hpp"
+
+/**
+ * @brief Called from the touch boot job once the touch driver is ready or failed to start
+ */
+using board_touch_ready_cb_t = std::function<void(bool success)>;
+
+/**
+ * @brief Replace the touch device polled by the BSP with an interrupt driven one, the touch IRQ also wakes up the
+ *        power service. The touch device is created right away, while the touch driver is started by a boot job on the
+ *        second core in parallel with the rest of the bring-up, the touch device stays released until the driver is
+ *        ready
+ *
+ * @param[in] display The display created by the BSP
+ * @param[in] ready_cb Optional callback to know when the touch driver is ready
+ *
+ * @return The new touch device, or the BSP one if the touch input can't be started
+ */
+lv_indev_t *board_touch_init(lv_display_t *display, board_touch_ready_cb_t ready_cb = nullptr);
+
+/**
+ * @brief Get the interrupt driven touch input, nullptr if `board_touch_init()` fell back to the BSP touch device
+ */
+esp_brookesia::gui::LvTouchInput *board_touch_get_input(void);
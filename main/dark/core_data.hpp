@@ -59,8 +59,18 @@ constexpr base::Manager::Data STYLESHEET_410_502_DARK_CORE_MANAGER_DATA = {
     .app = {
         .max_running_num = 3,
     },
+    .snapshot = {
+        // 205x251 thumbnails, the recents screen shows them smaller than that
+        .downscale = 2,
+        // About 8 idle frames per snapshot
+        .async_rows = 64,
+    },
     .flags = {
         .enable_app_save_snapshot = 1,
+        // The 3 decoded thumbnails (~103 KB each) and the launcher icons don't fit the LVGL image cache, they
+        // would be decoded again on every frame of the recents screen. Uncompressed, they take no decoded copy
+        .enable_app_snapshot_compress = 0,
+        .enable_app_snapshot_async = 1,
     },
 };
 
@@ -5,7 +5,9 @@
  */
 
 #include "bsp/esp-bsp.h"
+#include "esp_lvgl_port.h"
 #include "esp_brookesia.hpp"
+#include "esp_brookesia_app_squareline_demo.hpp"
 #include "boost/thread.hpp"
 #ifdef ESP_UTILS_LOG_TAG
 #   undef ESP_UTILS_LOG_TAG
@@ -13,11 +15,17 @@
 #define ESP_UTILS_LOG_TAG "Main"
 #include "esp_lib_utils.h"
 #include "./dark/stylesheet.hpp"
+#include "board_boot.hpp"
+#include "board_console.hpp"
+#include "board_display.hpp"
+#include "board_power.hpp"
+#include "board_touch.hpp"
 
 using namespace esp_brookesia;
 using namespace esp_brookesia::gui;
 using namespace esp_brookesia::systems::phone;
 
+/* Only used until the tickless scheduler takes over the LVGL task, see `LVGL_SCHEDULER_CONFIG` */
 #define LVGL_PORT_INIT_CONFIG() \
     {                               \
         .task_priority = 4,       \
@@ -27,17 +35,40 @@ using namespace esp_brookesia::systems::phone;
         .timer_period_ms = 5,     \
     }
 
+constexpr LvScheduler::Config LVGL_SCHEDULER_CONFIG = {
+    .task_name = "LvScheduler",
+    .task_priority = 4,
+    .task_stack = 10 * 1024,
+    .task_affinity = -1,
+    .task_stack_in_ext = false,
+    .max_sleep_ms = 0,
+};
+
+constexpr LvLatencyMonitor::Config LATENCY_MONITOR_CONFIG = {
+    .history_size = 64,
+};
+
 constexpr bool EXAMPLE_SHOW_MEM_INFO = false;
+constexpr bool EXAMPLE_SHOW_CPU_RESIDENCY = false;
+constexpr bool EXAMPLE_SHOW_LVGL_WAKEUPS = false;
 
 extern "C" void app_main(void)
 {
     ESP_UTILS_LOGI("Display ESP-Brookesia phone demo");
-
-    bsp_display_cfg_t cfg = {
-        .lvgl_port_cfg = LVGL_PORT_INIT_CONFIG(),
-    };
-    ESP_UTILS_CHECK_NULL_EXIT(bsp_display_start_with_config(&cfg), "Start display failed");
+    board_boot_mark("app_main");
+
+    /* Map the assets of the watchface on the second core while the display is brought up, instead of when the app is
+     * created. The touch driver follows once the display is started. There is no RTC, IMU or NVS to start at boot,
+     * the RTC is started by the clock app itself */
+    ESP_UTILS_CHECK_FALSE_EXIT(board_boot_run_job("assets", []() {
+        return apps::SquarelineDemo::beginAssets();
+    }), "Run assets job failed");
+
+    lvgl_port_cfg_t port_cfg = LVGL_PORT_INIT_CONFIG();
+    lv_display_t *display = board_display_start(port_cfg);
+    ESP_UTILS_CHECK_NULL_EXIT(display, "Start display failed");
     ESP_UTILS_CHECK_ERROR_EXIT(bsp_display_backlight_on(), "Turn on display backlight failed");
+    board_boot_mark("display");
 
     /* Configure GUI lock */
     LvLock::registerCallbacks([](int timeout_ms) {
@@ -51,37 +82,71 @@ extern "C" void app_main(void)
         return true;
     }, []() {
         bsp_display_unlock();
+        // Whatever was changed by another task (e.g. an invalidated area) is handled without waiting for a timer
+        LvScheduler::getInstance().notify();
 
         return true;
     });
 
+    /* Replace the periodic LVGL task of the port with the tickless scheduler. The BSP always starts the port task,
+     * `lvgl_port_stop()` stops its tick timer and keeps the task waiting without running `lv_timer_handler()`. It
+     * isn't deinitialized, since its mutex is the LVGL lock used above */
+    ESP_UTILS_CHECK_ERROR_EXIT(lvgl_port_stop(), "Stop LVGL port failed");
+    ESP_UTILS_CHECK_FALSE_EXIT(
+        LvScheduler::getInstance().begin(LVGL_SCHEDULER_CONFIG, display), "Begin LVGL scheduler failed"
+    );
+
+    {
+        LvLockGuard gui_guard;
+        ESP_UTILS_CHECK_FALSE_EXIT(
+            LvLatencyMonitor::getInstance().begin(LATENCY_MONITOR_CONFIG, display), "Begin latency monitor failed"
+        );
+    }
+    board_boot_mark("lvgl");
+
+    /* Read the touch panel on its IRQ instead of polling it, its driver starts while the phone is created */
+    lv_indev_t *touch = board_touch_init(display);
+
     /* Create a phone object */
     Phone *phone = new (std::nothrow) Phone();
     ESP_UTILS_CHECK_NULL_EXIT(phone, "Create phone failed");
 
-    /* Try using a stylesheet that corresponds to the resolution */
-    if ((BSP_LCD_H_RES == 410) && (BSP_LCD_V_RES == 502)) {
-        Stylesheet *stylesheet = new (std::nothrow) Stylesheet(STYLESHEET_410_502_DARK);
-        ESP_UTILS_CHECK_NULL_EXIT(stylesheet, "Create stylesheet failed");
-
-        ESP_UTILS_LOGI("Using stylesheet (%s)", stylesheet->core.name);
-        ESP_UTILS_CHECK_FALSE_EXIT(phone->addStylesheet(stylesheet), "Add stylesheet failed");
-        ESP_UTILS_CHECK_FALSE_EXIT(phone->activateStylesheet(stylesheet), "Activate stylesheet failed");
-        delete stylesheet;
+    /* The stylesheet is chosen for the panel at compile time, its sizes relative to the screen are resolved to pixels
+     * there too, and the rest is calibrated from flash straight into the phone */
+    if constexpr ((STYLESHEET_410_502_DARK.core.screen_size.width == BSP_LCD_H_RES) &&
+                  (STYLESHEET_410_502_DARK.core.screen_size.height == BSP_LCD_V_RES)) {
+        static constexpr Stylesheet stylesheet =
+            Phone::resolveStylesheet(STYLESHEET_410_502_DARK, {BSP_LCD_H_RES, BSP_LCD_V_RES});
+        size_t heap_free = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+        ESP_UTILS_CHECK_FALSE_EXIT(phone->applyStylesheet(stylesheet), "Apply stylesheet failed");
+        ESP_UTILS_LOGI("Using stylesheet (%s), %d bytes", stylesheet.core.name,
+                       static_cast<int>(heap_free - heap_caps_get_free_size(MALLOC_CAP_DEFAULT)));
+    } else {
+        ESP_UTILS_LOGW(
+            "No stylesheet for the %dx%d panel, using the default one", static_cast<int>(BSP_LCD_H_RES),
+            static_cast<int>(BSP_LCD_V_RES)
+        );
     }
+    board_boot_mark("stylesheet");
 
     {
         // When operating on non-GUI tasks, should acquire a lock before operating on LVGL
         LvLockGuard gui_guard;
 
         /* Begin the phone */
+        if (touch != nullptr) {
+            ESP_UTILS_CHECK_FALSE_EXIT(phone->setTouchDevice(touch), "Set touch device failed");
+        }
         ESP_UTILS_CHECK_FALSE_EXIT(phone->begin(), "Begin failed");
         // assert(phone->getDisplay().showContainerBorder() && "Show container border failed");
+        board_boot_mark("phone_begin");
 
         /* Init and install apps from registry */
         std::vector<systems::base::Manager::RegistryAppInfo> inited_apps;
         ESP_UTILS_CHECK_FALSE_EXIT(phone->initAppFromRegistry(inited_apps), "Init app registry failed");
+        board_boot_mark("app_init");
         ESP_UTILS_CHECK_FALSE_EXIT(phone->installAppFromRegistry(inited_apps), "Install app registry failed");
+        board_boot_mark("app_install");
 
 	/* Auto-launch the clock app */
 
@@ -102,6 +167,42 @@ extern "C" void app_main(void)
                 "Refresh status bar failed"
             );
         }, 1000, phone);
+
+        /* Report the boot timeline once the first screen of the phone is on the display */
+        ESP_UTILS_CHECK_FALSE_EXIT(board_boot_watch_first_frame(display), "Watch first frame failed");
+    }
+
+    /* Start the power service after the GUI is ready, the first timeout counts from here */
+    ESP_UTILS_CHECK_FALSE_EXIT(board_power_init(display), "Init board power failed");
+
+    /* Inspect the GUI performance from the serial console, e.g. `latency` or `profiler on` */
+    ESP_UTILS_CHECK_FALSE_EXIT(board_console_init(phone), "Init board console failed");
+
+    if constexpr (EXAMPLE_SHOW_CPU_RESIDENCY) {
+        esp_utils::thread_config_guard thread_config({
+            .name = "cpu_residency",
+            .stack_size = 4096,
+        });
+        boost::thread([]() {
+            while (1) {
+                boost::this_thread::sleep_for(boost::chrono::seconds(10));
+                services::CpuGovernor::requestInstance().dumpResidency();
+            }
+        }).detach();
+    }
+
+    if constexpr (EXAMPLE_SHOW_LVGL_WAKEUPS) {
+        esp_utils::thread_config_guard thread_config({
+            .name = "lvgl_wakeups",
+            .stack_size = 4096,
+        });
+        boost::thread([]() {
+            while (1) {
+                boost::this_thread::sleep_for(boost::chrono::seconds(10));
+                LvScheduler::getInstance().dumpStats();
+                LvScheduler::getInstance().resetStats();
+            }
+        }).detach();
     }
 
     if constexpr (EXAMPLE_SHOW_MEM_INFO) {
@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+/**
+ * Check `board_rgb565_swap()` against a pixel by pixel swap, for every length around the blocks of 16 pixels and
+ * every 2-byte offset from the 16-byte boundary, so the head, the blocks and the tail are all covered. The pixels
+ * around the swapped ones must be left untouched.
+ */
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include "board_rgb565_swap.hpp"
+
+constexpr size_t TEST_PIXELS_MAX = 100;
+constexpr size_t TEST_OFFSET_MAX = 8;
+constexpr size_t TEST_GUARD_PIXELS = 8;
+constexpr size_t TEST_BUFFER_PIXELS = TEST_GUARD_PIXELS + TEST_OFFSET_MAX + TEST_PIXELS_MAX + TEST_GUARD_PIXELS;
+
+static void rgb565_swap_scalar(uint16_t *buf, size_t pixel_num)
+{
+    for (size_t i = 0; i < pixel_num; i++) {
+        buf[i] = static_cast<uint16_t>((buf[i] >> 8) | (buf[i] << 8));
+    }
+}
+
+int main()
+{
+    alignas(16) uint16_t source[TEST_BUFFER_PIXELS];
+    alignas(16) uint16_t expected[TEST_BUFFER_PIXELS];
+    alignas(16) uint16_t actual[TEST_BUFFER_PIXELS];
+    std::mt19937 random(565);
+    int failures = 0;
+
+    for (uint16_t &pixel : source) {
+        pixel = static_cast<uint16_t>(random());
+    }
+    // The guard pixels keep the buffer start on the 16-byte boundary
+    static_assert((TEST_GUARD_PIXELS * sizeof(uint16_t)) % 16 == 0, "Guard must keep the alignment");
+
+    for (size_t offset = 0; offset < TEST_OFFSET_MAX; offset++) {
+        for (size_t pixel_num = 0; pixel_num <= TEST_PIXELS_MAX; pixel_num++) {
+            size_t start = TEST_GUARD_PIXELS + offset;
+            memcpy(expected, source, sizeof(source));
+            memcpy(actual, source, sizeof(source));
+            rgb565_swap_scalar(expected + start, pixel_num);
+            board_rgb565_swap(actual + start, pixel_num);
+            if (memcmp(expected, actual, sizeof(actual))) {
+                printf("Mismatch: %d pixels from a %d byte offset\n", static_cast<int>(pixel_num),
+                       static_cast<int>(offset * sizeof(uint16_t)));
+                failures++;
+            }
+        }
+    }
+    if (failures) {
+        return 1;
+    }
+    printf("board_rgb565_swap() matches the scalar swap for %d lengths and %d offsets\n",
+           static_cast<int>(TEST_PIXELS_MAX + 1), static_cast<int>(TEST_OFFSET_MAX));
+
+    return 0;
+}
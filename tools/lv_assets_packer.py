@@ -0,0 +1,274 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+# SPDX-License-Identifier: Apache-2.0
+"""
+Convert the GUI assets into the files of an assets partition, which `spiffs_create_partition_assets()` of
+esp_mmap_assets packs and `esp_brookesia::gui::LvAssets` resolves by name (the file name without its extension).
+
+Inputs, as files or directories:
+    *.png           Image, converted to `--cf`
+    *.c             Image or font generated by the LVGL converters or SquareLine Studio. The images keep their color
+                    format unless `--cf` is given, the fonts are converted to the format of
+                    `esp_brookesia_lv_assets_format.h`, so their glyphs can be used in place
+    *.json          Watchface, packed by `lv_watchface_packer.py`
+    *.bin           Copied as is, e.g. binary watchfaces
+
+The output directory is kept in sync with the inputs: the files are only rewritten if they changed, and the stale
+ones are removed.
+
+Example:
+    lv_assets_packer.py -o build/assets ui/images ui/fonts/ui_font_Number.c
+"""
+import argparse
+import glob
+import os
+import re
+import struct
+import sys
+
+import lv_image_converter as image_converter
+import lv_watchface_packer as watchface_packer
+
+FONT_MAGIC = 0x31544642
+FONT_VERSION = 1
+FONT_HEADER_FORMAT = '<IHHhbbBBBBHHIIIIII'
+FONT_GLYPH_DSC_FORMAT = '<IIHHhh'
+FONT_CMAP_FORMAT = '<IHHHBBII'
+FONT_KERN_PAIRS_FORMAT = '<IB3xII'
+FONT_KERN_CLASSES_FORMAT = '<BB2xIII'
+FONT_KERN_NONE, FONT_KERN_PAIRS, FONT_KERN_CLASSES = range(3)
+FONT_ALIGN = 4
+CMAP_TYPES = {
+    'LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL': 0,
+    'LV_FONT_FMT_TXT_CMAP_SPARSE_FULL': 1,
+    'LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY': 2,
+    'LV_FONT_FMT_TXT_CMAP_SPARSE_TINY': 3,
+}
+ARRAY_TYPES = {
+    # C type: struct format
+    'uint8_t': 'B',
+    'int8_t': 'b',
+    'uint16_t': 'H',
+}
+
+
+class PackError(Exception):
+    pass
+
+
+# Fonts ###############################################################################################################
+
+def strip_comments(text):
+    return re.sub(r'/\*.*?\*/|//[^\n]*', '', text, flags=re.S)
+
+
+def parse_arrays(text):
+    """
+    Return the integer arrays of the file, as {name: (C type, values)}
+    """
+    arrays = {}
+    for match in re.finditer(r'(\w+)\s+(\w+)\[\]\s*=\s*\{(.*?)\};', text, re.S):
+        c_type, name, body = match.groups()
+        if c_type not in ARRAY_TYPES:
+            continue
+        arrays[name] = (c_type, [int(value, 0) for value in re.findall(r'-?(?:0x[0-9a-fA-F]+|\d+)', body)])
+    return arrays
+
+
+def parse_fields(body):
+    return dict(re.findall(r'\.(\w+)\s*=\s*&?\s*([-\w]+)', body))
+
+
+def struct_body(text, pattern):
+    match = re.search(pattern + r'\s*=\s*\{(.*?)\};', text, re.S)
+    if match is None:
+        raise PackError(f'No `{pattern}`')
+    return match.group(1)
+
+
+class _Blob:
+    """
+    Sections aligned to `FONT_ALIGN`, the offsets are relative to the start of the font
+    """
+
+    def __init__(self, header_size):
+        self.data = bytearray(header_size)
+
+    def add(self, data):
+        self.data += bytes((-len(self.data)) % FONT_ALIGN)
+        offset = len(self.data)
+        self.data += data
+        return offset
+
+
+def convert_font(path):
+    with open(path, 'r') as f:
+        text = strip_comments(f.read())
+    arrays = parse_arrays(text)
+
+    def array_bytes(name):
+        if name not in arrays:
+            raise PackError(f'{path}: no array `{name}`')
+        c_type, values = arrays[name]
+        return struct.pack(f'<{len(values)}{ARRAY_TYPES[c_type]}', *values)
+
+    glyphs = re.findall(
+        r'\{\s*\.bitmap_index\s*=\s*(\d+),\s*\.adv_w\s*=\s*(\d+),\s*\.box_w\s*=\s*(\d+),\s*\.box_h\s*=\s*(\d+),'
+        r'\s*\.ofs_x\s*=\s*(-?\d+),\s*\.ofs_y\s*=\s*(-?\d+)\s*\}', text
+    )
+    if not glyphs:
+        raise PackError(f'{path}: no glyph descriptions')
+    cmap_bodies = re.findall(r'\{([^{}]*\.range_start[^{}]*)\}', struct_body(text, r'cmaps\[\]'))
+    dsc = parse_fields(struct_body(text, r'lv_font_fmt_txt_dsc_t\s+font_dsc'))
+    font = parse_fields(struct_body(text, r'lv_font_t\s+\w+'))
+
+    blob = _Blob(struct.calcsize(FONT_HEADER_FORMAT))
+    glyph_dsc_offset = blob.add(b''.join(
+        struct.pack(FONT_GLYPH_DSC_FORMAT, *(int(value) for value in glyph)) for glyph in glyphs
+    ))
+    glyph_bitmap_offset = blob.add(array_bytes('glyph_bitmap'))
+
+    cmaps = []
+    for body in cmap_bodies:
+        fields = parse_fields(body)
+        unicode_list = fields.get('unicode_list', 'NULL')
+        ofs_list = fields.get('glyph_id_ofs_list', 'NULL')
+        cmaps.append(struct.pack(
+            FONT_CMAP_FORMAT, int(fields['range_start'], 0), int(fields['range_length'], 0),
+            int(fields['glyph_id_start'], 0), int(fields['list_length'], 0), CMAP_TYPES[fields['type']], 0,
+            0 if unicode_list == 'NULL' else blob.add(array_bytes(unicode_list)),
+            0 if ofs_list == 'NULL' else blob.add(array_bytes(ofs_list)),
+        ))
+    cmap_offset = blob.add(b''.join(cmaps))
+
+    kern_type = FONT_KERN_NONE
+    kern_offset = 0
+    if dsc.get('kern_dsc', 'NULL') != 'NULL':
+        kern = parse_fields(struct_body(text, r'\w+\s+' + dsc['kern_dsc']))
+        if int(dsc.get('kern_classes', '0')):
+            kern_type = FONT_KERN_CLASSES
+            kern_offset = blob.add(struct.pack(
+                FONT_KERN_CLASSES_FORMAT, int(kern['left_class_cnt']), int(kern['right_class_cnt']),
+                blob.add(array_bytes(kern['class_pair_values'])), blob.add(array_bytes(kern['left_class_mapping'])),
+                blob.add(array_bytes(kern['right_class_mapping'])),
+            ))
+        else:
+            kern_type = FONT_KERN_PAIRS
+            kern_offset = blob.add(struct.pack(
+                FONT_KERN_PAIRS_FORMAT, int(kern['pair_cnt']), int(kern['glyph_ids_size']),
+                blob.add(array_bytes(kern['glyph_ids'])), blob.add(array_bytes(kern['values'])),
+            ))
+
+    blob.data[:struct.calcsize(FONT_HEADER_FORMAT)] = struct.pack(
+        FONT_HEADER_FORMAT, FONT_MAGIC, FONT_VERSION, int(font['line_height']), int(font['base_line']),
+        int(font.get('underline_position', '0')), int(font.get('underline_thickness', '0')), int(dsc['bpp']),
+        int(dsc.get('bitmap_format', '0')), kern_type, 0, int(dsc.get('kern_scale', '0')), len(cmaps), len(glyphs),
+        glyph_dsc_offset, glyph_bitmap_offset, cmap_offset, kern_offset, len(blob.data),
+    )
+    return bytes(blob.data)
+
+
+# Images ##############################################################################################################
+
+def _image_cf(path, args):
+    if args.cf is not None:
+        return args.cf
+    if path.endswith('.png'):
+        return 'RGB565A8'
+    with open(path, 'r') as f:
+        match = re.search(r'\.header\.cf\s*=\s*LV_COLOR_FORMAT_(\w+)', f.read())
+    cf = match.group(1) if match else 'RGB565A8'
+    if cf == 'NATIVE_WITH_ALPHA':
+        return 'RGB565A8' if args.color_depth == 16 else 'ARGB8888'
+    if cf == 'NATIVE':
+        return 'RGB565' if args.color_depth == 16 else 'ARGB8888'
+    if cf not in image_converter.COLOR_FORMATS:
+        raise PackError(f'{path}: unsupported color format {cf}')
+    return cf
+
+
+def convert_image(path, args):
+    image = image_converter.load_image(path, args.color_depth)
+    cf = _image_cf(path, args)
+    data, stride = image_converter.encode(image, cf)
+    packed = image_converter.compress(data, cf, args.compress)
+    return image_converter.pack_bin_image(image, cf, args.compress, packed, stride), cf
+
+
+# Packing #############################################################################################################
+
+def collect_inputs(inputs):
+    paths = []
+    for item in inputs:
+        if os.path.isdir(item):
+            for pattern in ('*.png', '*.c', '*.json', '*.bin'):
+                paths += sorted(glob.glob(os.path.join(item, pattern)))
+        else:
+            paths.append(item)
+    return paths
+
+
+def convert(path, args):
+    """
+    Return the packed data, and its kind for the report
+    """
+    if path.endswith('.bin'):
+        with open(path, 'rb') as f:
+            return f.read(), 'raw'
+    if path.endswith('.json'):
+        return watchface_packer.pack_face(path), 'watchface'
+    if path.endswith('.c'):
+        with open(path, 'r') as f:
+            text = f.read()
+        if 'lv_font_fmt_txt_dsc_t' in text:
+            return convert_font(path), 'font'
+    data, cf = convert_image(path, args)
+    return data, f'image {cf}'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('inputs', nargs='+', help='Images, fonts, watchfaces or binary files, or directories of them')
+    parser.add_argument('-o', '--output', required=True, help='Directory given to `spiffs_create_partition_assets()`')
+    parser.add_argument('--cf', choices=image_converter.COLOR_FORMATS.keys(),
+                        help='Color format of the images, kept from the C images by default')
+    parser.add_argument('--compress', choices=image_converter.COMPRESS_METHODS.keys(), default='NONE',
+                        help='Compression of the images. Compressed images are decoded into RAM, not used in place')
+    parser.add_argument('--color-depth', type=int, choices=(16, 32), default=16,
+                        help='LV_COLOR_DEPTH, for the native color formats of the C images')
+    args = parser.parse_args()
+
+    os.makedirs(args.output, exist_ok=True)
+    outputs = set()
+    total_size = 0
+    try:
+        for path in collect_inputs(args.inputs):
+            name = os.path.splitext(os.path.basename(path))[0] + '.bin'
+            if name in outputs:
+                raise PackError(f'Duplicate asset {name}')
+            data, kind = convert(path, args)
+            outputs.add(name)
+            total_size += len(data)
+            print(f'{name:<40} {kind:<16} {len(data):>8}')
+
+            output = os.path.join(args.output, name)
+            if os.path.exists(output):
+                with open(output, 'rb') as f:
+                    if f.read() == data:
+                        continue
+            with open(output, 'wb') as f:
+                f.write(data)
+    except (PackError, image_converter.ConvertError, watchface_packer.PackError, KeyError, ValueError) as e:
+        print(f'Error: {e}', file=sys.stderr)
+        return 1
+
+    for name in os.listdir(args.output):
+        if name.endswith('.bin') and (name not in outputs):
+            os.remove(os.path.join(args.output, name))
+    print(f'{len(outputs)} assets, {total_size} bytes')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,267 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+# SPDX-License-Identifier: Apache-2.0
+"""
+Keep only the glyphs of a font generated by lv_font_conv (or SquareLine Studio) that the GUI can show, e.g. the digits
+of a clock font.
+
+The characters are given as symbols, ranges, or collected from the string literals of source files (the formats of
+`printf` are skipped, so the characters they print should be given as symbols or ranges). The font is rewritten in
+place (or to `-o`): its bitmaps, glyph descriptions, character maps and kerning only cover the kept characters, the
+rest of the file is left as is.
+
+Example:
+    lv_font_subset.py ui/fonts/ui_font_Number.c --symbols "0123456789:-" --scan ui/screens/ui_screen_clock.c
+"""
+import argparse
+import re
+import sys
+
+from lv_assets_packer import CMAP_TYPES, PackError, parse_arrays, parse_fields, strip_comments, struct_body
+
+# Above this number of character ranges, a single sparse character map is used
+CMAP_RANGE_NUM_MAX = 4
+VALUES_PER_LINE = 8
+
+
+class Font:
+    def __init__(self, path):
+        with open(path, 'r', encoding='utf-8') as f:
+            self.source = f.read()
+        text = strip_comments(self.source)
+        self.arrays = {name: values for name, (_, values) in parse_arrays(text).items()}
+        self.glyphs = [
+            [int(value) for value in glyph] for glyph in re.findall(
+                r'\{\s*\.bitmap_index\s*=\s*(\d+),\s*\.adv_w\s*=\s*(\d+),\s*\.box_w\s*=\s*(\d+),'
+                r'\s*\.box_h\s*=\s*(\d+),\s*\.ofs_x\s*=\s*(-?\d+),\s*\.ofs_y\s*=\s*(-?\d+)\s*\}', text
+            )
+        ]
+        if not self.glyphs:
+            raise PackError(f'{path}: no glyph descriptions')
+        self.cmaps = [
+            parse_fields(body)
+            for body in re.findall(r'\{([^{}]*\.range_start[^{}]*)\}', struct_body(text, r'cmaps\[\]'))
+        ]
+        self.dsc = parse_fields(struct_body(text, r'lv_font_fmt_txt_dsc_t\s+font_dsc'))
+        self.kern = None
+        if self.dsc.get('kern_dsc', 'NULL') != 'NULL':
+            self.kern = parse_fields(struct_body(text, r'\w+\s+' + self.dsc['kern_dsc']))
+        self.bitmap = self.arrays['glyph_bitmap']
+
+    def glyph_ids(self):
+        """
+        Return {unicode: glyph ID}
+        """
+        ids = {}
+        for cmap in self.cmaps:
+            start = int(cmap['range_start'], 0)
+            glyph_id_start = int(cmap['glyph_id_start'], 0)
+            cmap_type = CMAP_TYPES[cmap['type']]
+            unicode_list = self.arrays.get(cmap.get('unicode_list', 'NULL'))
+            ofs_list = self.arrays.get(cmap.get('glyph_id_ofs_list', 'NULL'))
+            if cmap_type == CMAP_TYPES['LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY']:
+                offsets = [(i, i) for i in range(int(cmap['range_length'], 0))]
+            elif cmap_type == CMAP_TYPES['LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL']:
+                offsets = [(i, ofs) for i, ofs in enumerate(ofs_list) if (i == 0) or ofs]
+            elif cmap_type == CMAP_TYPES['LV_FONT_FMT_TXT_CMAP_SPARSE_TINY']:
+                offsets = list(zip(unicode_list, range(len(unicode_list))))
+            else:
+                offsets = list(zip(unicode_list, ofs_list))
+            for unicode_ofs, glyph_ofs in offsets:
+                ids[start + unicode_ofs] = glyph_id_start + glyph_ofs
+        return ids
+
+    def glyph_bitmap(self, glyph_id):
+        start, _, box_w, box_h, _, _ = self.glyphs[glyph_id]
+        if int(self.dsc.get('bitmap_format', '0')) == 0:
+            return self.bitmap[start:start + (box_w * box_h * int(self.dsc['bpp']) + 7) // 8]
+        # Compressed bitmaps end where the next one starts
+        ends = [glyph[0] for glyph in self.glyphs[glyph_id + 1:] if glyph[0] > start]
+        return self.bitmap[start:(ends[0] if ends else len(self.bitmap))]
+
+
+def _format_values(values, indent='    ', fmt='{}'):
+    lines = []
+    for i in range(0, len(values), VALUES_PER_LINE):
+        lines.append(indent + ', '.join(fmt.format(value) for value in values[i:i + VALUES_PER_LINE]))
+    return ',\n'.join(lines)
+
+
+def _char_comment(unicode):
+    return f'/* U+{unicode:04X} "{chr(unicode)}" */'
+
+
+def _replace_body(source, pattern, body):
+    """
+    Replace the initializer of the declaration matching `pattern`
+    """
+    regex = re.compile(r'(' + pattern + r'\s*=\s*\{)(.*?)(\n\s*\};)', re.S)
+    if regex.search(source) is None:
+        raise PackError(f'No `{pattern}`')
+    return regex.sub(lambda match: match.group(1) + '\n' + body + match.group(3), source, count=1)
+
+
+def _cmap_runs(unicodes):
+    runs = []
+    for unicode in unicodes:
+        if runs and (unicode == runs[-1][-1] + 1):
+            runs[-1].append(unicode)
+        else:
+            runs.append([unicode])
+    return runs
+
+
+def subset(font, chars):
+    """
+    Return the source of the font with the glyphs of `chars` only, and the kept characters
+    """
+    ids = font.glyph_ids()
+    kept = sorted(unicode for unicode in set(chars) if unicode in ids)
+    # The glyph ID 0 is reserved
+    new_ids = {ids[unicode]: i + 1 for i, unicode in enumerate(kept)}
+    source = font.source
+
+    # Bitmaps and glyph descriptions
+    bitmap = ''
+    has_data = False
+    glyph_lines = [
+        '    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */'
+    ]
+    bitmap_index = 0
+    for unicode in kept:
+        glyph = font.glyphs[ids[unicode]]
+        data = font.glyph_bitmap(ids[unicode])
+        if bitmap:
+            # The values of the glyphs are separated by commas, the comments of the empty ones aren't
+            bitmap += ',\n\n' if has_data else '\n\n'
+        bitmap += f'    {_char_comment(unicode)}'
+        if data:
+            bitmap += '\n' + _format_values(data, fmt='{:#x}')
+            has_data = True
+        glyph_lines.append(
+            f'    {{.bitmap_index = {bitmap_index}, .adv_w = {glyph[1]}, .box_w = {glyph[2]}, .box_h = {glyph[3]}, '
+            f'.ofs_x = {glyph[4]}, .ofs_y = {glyph[5]}}}'
+        )
+        bitmap_index += len(data)
+    source = _replace_body(source, r'glyph_bitmap\[\]', bitmap)
+    source = _replace_body(source, r'glyph_dsc\[\]', ',\n'.join(glyph_lines))
+
+    # Character maps, as ranges, or a sparse list if there are too many of them
+    for cmap in font.cmaps:
+        for field in ('unicode_list', 'glyph_id_ofs_list'):
+            name = cmap.get(field, 'NULL')
+            if name != 'NULL':
+                source = re.sub(r'static\s+const\s+\w+\s+' + name + r'\[\]\s*=\s*\{.*?\};\n*', '', source, flags=re.S)
+    runs = _cmap_runs(kept)
+    cmap_fmt = (
+        '    {{\n        .range_start = {}, .range_length = {}, .glyph_id_start = {},\n'
+        '        .unicode_list = {}, .glyph_id_ofs_list = NULL, .list_length = {}, .type = {}\n    }}'
+    )
+    unicode_list = ''
+    if len(runs) <= CMAP_RANGE_NUM_MAX:
+        cmaps = []
+        glyph_id = 1
+        for run in runs:
+            cmaps.append(cmap_fmt.format(run[0], len(run), glyph_id, 'NULL', 0, 'LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY'))
+            glyph_id += len(run)
+    else:
+        unicode_list = 'static const uint16_t unicode_list_0[] = {\n' + _format_values(
+            [unicode - kept[0] for unicode in kept], fmt='{:#x}'
+        ) + '\n};\n\n'
+        cmaps = [cmap_fmt.format(
+            kept[0], kept[-1] - kept[0] + 1, 1, 'unicode_list_0', len(kept), 'LV_FONT_FMT_TXT_CMAP_SPARSE_TINY'
+        )]
+    source = _replace_body(source, r'cmaps\[\]', ',\n'.join(cmaps))
+    source = re.sub(r'(/\*Collect the unicode lists and glyph_id offsets\*/\n)', r'\g<0>' + unicode_list, source)
+    source = re.sub(r'(\.cmap_num\s*=\s*)\d+', r'\g<1>' + str(len(cmaps)), source)
+
+    # Kerning
+    if font.kern is not None:
+        if int(font.dsc.get('kern_classes', '0')):
+            for field in ('left_class_mapping', 'right_class_mapping'):
+                mapping = font.arrays[font.kern[field]]
+                values = [0] + [mapping[ids[unicode]] for unicode in kept]
+                source = _replace_body(source, font.kern[field] + r'\[\]', _format_values(values))
+        else:
+            glyph_ids = font.arrays[font.kern['glyph_ids']]
+            values = font.arrays[font.kern['values']]
+            pairs = [
+                (new_ids[glyph_ids[2 * i]], new_ids[glyph_ids[2 * i + 1]], values[i])
+                for i in range(int(font.kern['pair_cnt']))
+                if (glyph_ids[2 * i] in new_ids) and (glyph_ids[2 * i + 1] in new_ids)
+            ]
+            # Searched by LVGL as sorted pairs. C doesn't allow empty arrays, so a neutral pair is kept if none is left
+            pairs = sorted(pairs) or [(1, 1, 0)]
+            source = _replace_body(
+                source, font.kern['glyph_ids'] + r'\[\]', ',\n'.join(f'    {left}, {right}' for left, right, _ in pairs)
+            )
+            source = _replace_body(source, font.kern['values'] + r'\[\]', _format_values([pair[2] for pair in pairs]))
+            source = re.sub(r'(\.pair_cnt\s*=\s*)\d+', r'\g<1>' + str(len(pairs)), source)
+
+    # Record the subset in the header comment
+    chars_text = ''.join(chr(unicode) for unicode in kept).replace('*/', '* /')
+    source = re.sub(
+        r'( \* Opts: [^\n]*\n)( \* Subset by lv_font_subset\.py: [^\n]*\n)?',
+        lambda match: match.group(1) + f' * Subset by lv_font_subset.py: {chars_text}\n', source, count=1
+    )
+
+    return source, kept
+
+
+def scan_chars(path):
+    with open(path, 'r', encoding='utf-8') as f:
+        text = strip_comments(f.read())
+    chars = set()
+    for literal in re.findall(r'"((?:[^"\\\n]|\\.)*)"', text):
+        if literal.endswith(('.h', '.hpp')):
+            continue
+        literal = re.sub(r'%[-+ #0]*\d*(?:\.\d+)?[hlzjt]*[diouxXeEfgGcsp%]|\\.', '', literal)
+        chars.update(ord(char) for char in literal if char.isprintable())
+    return chars
+
+
+def parse_ranges(text):
+    chars = set()
+    for item in text.split(','):
+        start, _, end = item.partition('-')
+        chars.update(range(int(start, 0), int(end or start, 0) + 1))
+    return chars
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('font', help='C font generated by lv_font_conv')
+    parser.add_argument('-o', '--output', help='Output C font, the input one by default')
+    parser.add_argument('--symbols', default='', help='Characters to keep')
+    parser.add_argument('--range', action='append', default=[], help='Character ranges to keep, e.g. 0x30-0x39,0x3a')
+    parser.add_argument('--scan', nargs='+', default=[], help='Sources whose string literals are kept')
+    args = parser.parse_args()
+
+    # The space is always kept, for the texts with several words
+    chars = {ord(' ')} | {ord(char) for char in args.symbols}
+    try:
+        for item in args.range:
+            chars |= parse_ranges(item)
+        for path in args.scan:
+            chars |= scan_chars(path)
+        font = Font(args.font)
+        source, kept = subset(font, chars)
+    except (PackError, KeyError, ValueError) as e:
+        print(f'Error: {e}', file=sys.stderr)
+        return 1
+
+    missing = sorted(chars - set(font.glyph_ids()))
+    if missing:
+        print('Not in the font: ' + ''.join(chr(unicode) for unicode in missing))
+    with open(args.output or args.font, 'w', encoding='utf-8') as f:
+        f.write(source)
+    print(
+        f'Glyphs: {len(font.glyphs) - 1} -> {len(kept)}, '
+        f'bitmap: {len(font.bitmap)} -> {sum(len(font.glyph_bitmap(font.glyph_ids()[u])) for u in kept)} bytes'
+    )
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,577 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+# SPDX-License-Identifier: Apache-2.0
+"""
+Convert a PNG, or an existing LVGL 9 C image, into an LVGL 9 C image with another color format and optional
+compression. Only the standard library is needed, so it can run as part of the build.
+
+Color formats:
+    ARGB8888, RGB565, RGB565A8  Direct colors, RGB565A8 is drawn as is on a RGB565 display
+    A8                          Alpha only, drawn with the image recolor
+    I1, I2, I4, I8              Indexed colors with an exact palette, for flat icons with a few colors
+Compression (decoded once by LVGL, then kept in its image cache):
+    NONE, RLE, LZ4              RLE and LZ4 need `LV_USE_RLE` and `LV_USE_LZ4_INTERNAL`
+
+Examples:
+    # Convert an icon
+    lv_image_converter.py icon.png -o icon.c --cf RGB565A8 --compress RLE
+    # Convert an icon for an assets partition, see `lv_assets_packer.py`
+    lv_image_converter.py icon.png -o icon.bin --cf RGB565A8
+    # Compare the flash size of every format
+    lv_image_converter.py icon.png --report
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+COLOR_FORMATS = {
+    # name: (bpp, LVGL color format)
+    'ARGB8888': (32, 'LV_COLOR_FORMAT_ARGB8888'),
+    'RGB565': (16, 'LV_COLOR_FORMAT_RGB565'),
+    'RGB565A8': (16, 'LV_COLOR_FORMAT_RGB565A8'),
+    'A8': (8, 'LV_COLOR_FORMAT_A8'),
+    'I1': (1, 'LV_COLOR_FORMAT_I1'),
+    'I2': (2, 'LV_COLOR_FORMAT_I2'),
+    'I4': (4, 'LV_COLOR_FORMAT_I4'),
+    'I8': (8, 'LV_COLOR_FORMAT_I8'),
+}
+# Values of `lv_color_format_t`, for the binary images
+COLOR_FORMAT_VALUES = {
+    'ARGB8888': 0x10,
+    'RGB565': 0x12,
+    'RGB565A8': 0x14,
+    'A8': 0x0e,
+    'I1': 0x07,
+    'I2': 0x08,
+    'I4': 0x09,
+    'I8': 0x0a,
+}
+COMPRESS_METHODS = {
+    # name: (value of `lv_image_compress_t`, LVGL option)
+    'NONE': (0, None),
+    'RLE': (1, 'LV_USE_RLE'),
+    'LZ4': (2, 'LV_USE_LZ4_INTERNAL'),
+}
+RLE_RUN_MAX = 0x7f
+LV_IMAGE_HEADER_MAGIC = 0x19
+LV_IMAGE_FLAGS_COMPRESSED = 0x0008
+LZ4_MIN_MATCH = 4
+LZ4_LAST_LITERALS = 5
+LZ4_MATCH_LIMIT = 12
+LZ4_OFFSET_MAX = 0xffff
+
+
+class ConvertError(Exception):
+    pass
+
+
+class Image:
+    """
+    Straight alpha RGBA pixels, row by row
+    """
+
+    def __init__(self, width, height, pixels):
+        self.width = width
+        self.height = height
+        self.pixels = pixels
+
+
+# Input ###############################################################################################################
+
+def _paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if (pa <= pb) and (pa <= pc):
+        return a
+    return b if pb <= pc else c
+
+
+def _unpack_samples(row, bit_depth, count):
+    if bit_depth == 8:
+        return list(row[:count])
+    per_byte = 8 // bit_depth
+    mask = (1 << bit_depth) - 1
+    samples = []
+    for i in range(count):
+        shift = 8 - bit_depth * (i % per_byte + 1)
+        samples.append((row[i // per_byte] >> shift) & mask)
+    return samples
+
+
+def load_png(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ConvertError(f'{path} is not a PNG')
+
+    pos = 8
+    idat = b''
+    palette = []
+    trns = b''
+    width = height = bit_depth = color_type = interlace = None
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, bit_depth, color_type, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b'tRNS':
+            trns = chunk
+        elif kind == b'IDAT':
+            idat += chunk
+        elif kind == b'IEND':
+            break
+
+    if interlace:
+        raise ConvertError(f'{path}: interlaced PNGs are not supported')
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color_type)
+    if (channels is None) or ((bit_depth != 8) and (color_type != 3)):
+        raise ConvertError(f'{path}: unsupported PNG (color type {color_type}, bit depth {bit_depth})')
+
+    raw = zlib.decompress(idat)
+    bpp = max(1, channels * bit_depth // 8)
+    stride = (width * channels * bit_depth + 7) // 8
+    prev = bytearray(stride)
+    pixels = []
+    pos = 0
+    for _ in range(height):
+        filter_type = raw[pos]
+        row = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            left = row[i - bpp] if i >= bpp else 0
+            up = prev[i]
+            up_left = prev[i - bpp] if i >= bpp else 0
+            if filter_type == 1:
+                row[i] = (row[i] + left) & 0xff
+            elif filter_type == 2:
+                row[i] = (row[i] + up) & 0xff
+            elif filter_type == 3:
+                row[i] = (row[i] + ((left + up) >> 1)) & 0xff
+            elif filter_type == 4:
+                row[i] = (row[i] + _paeth(left, up, up_left)) & 0xff
+        prev = row
+
+        samples = _unpack_samples(row, bit_depth, width * channels)
+        for x in range(width):
+            s = samples[x * channels:(x + 1) * channels]
+            if color_type == 0:
+                pixels.append((s[0], s[0], s[0], 0xff))
+            elif color_type == 2:
+                pixels.append((s[0], s[1], s[2], 0xff))
+            elif color_type == 3:
+                r, g, b = palette[s[0]]
+                pixels.append((r, g, b, trns[s[0]] if s[0] < len(trns) else 0xff))
+            elif color_type == 4:
+                pixels.append((s[0], s[0], s[0], s[1]))
+            else:
+                pixels.append(tuple(s))
+
+    return Image(width, height, pixels)
+
+
+def load_c_image(path, color_depth):
+    """
+    Load an image generated by the LVGL converter, SquareLine Studio or this script
+    """
+    with open(path, 'r') as f:
+        text = f.read()
+
+    def header_field(name):
+        match = re.search(r'\.header\.' + name + r'\s*=\s*(\w+)', text)
+        if match is None:
+            raise ConvertError(f'{path}: no `header.{name}`')
+        return match.group(1)
+
+    width = int(header_field('w'), 0)
+    height = int(header_field('h'), 0)
+    cf = header_field('cf')
+    if cf == 'LV_COLOR_FORMAT_NATIVE_WITH_ALPHA':
+        cf = 'LV_COLOR_FORMAT_RGB565A8' if color_depth == 16 else 'LV_COLOR_FORMAT_ARGB8888'
+    elif cf == 'LV_COLOR_FORMAT_NATIVE':
+        cf = 'LV_COLOR_FORMAT_RGB565' if color_depth == 16 else 'LV_COLOR_FORMAT_XRGB8888'
+    array = re.search(r'\[\]\s*=\s*\{(.*?)\};', text, re.S)
+    if array is None:
+        raise ConvertError(f'{path}: no image data')
+    data = bytes(int(value, 16) for value in re.findall(r'0x([0-9a-fA-F]{2})', array.group(1)))
+    if 'LV_IMAGE_FLAGS_COMPRESSED' in text:
+        data = decompress(data, cf[len('LV_COLOR_FORMAT_'):])
+
+    num = width * height
+    pixels = []
+    if cf in ('LV_COLOR_FORMAT_ARGB8888', 'LV_COLOR_FORMAT_XRGB8888'):
+        for i in range(num):
+            b, g, r, a = data[i * 4:i * 4 + 4]
+            pixels.append((r, g, b, a if cf == 'LV_COLOR_FORMAT_ARGB8888' else 0xff))
+    elif cf in ('LV_COLOR_FORMAT_RGB565', 'LV_COLOR_FORMAT_RGB565A8'):
+        for i in range(num):
+            value = data[i * 2] | (data[i * 2 + 1] << 8)
+            r = (value >> 11) & 0x1f
+            g = (value >> 5) & 0x3f
+            b = value & 0x1f
+            a = data[num * 2 + i] if cf == 'LV_COLOR_FORMAT_RGB565A8' else 0xff
+            pixels.append(((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), a))
+    else:
+        raise ConvertError(f'{path}: unsupported color format {cf}')
+
+    return Image(width, height, pixels)
+
+
+def load_image(path, color_depth=16):
+    if path.endswith('.png'):
+        return load_png(path)
+    return load_c_image(path, color_depth)
+
+
+# Color formats #######################################################################################################
+
+def _rgb565(r, g, b):
+    return ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3)
+
+
+def encode(image, name):
+    """
+    Return the pixel data of LVGL and its stride
+    """
+    bpp, _ = COLOR_FORMATS[name]
+    w = image.width
+    data = bytearray()
+    if name == 'ARGB8888':
+        for r, g, b, a in image.pixels:
+            data += bytes((b, g, r, a))
+        return data, w * 4
+    if name in ('RGB565', 'RGB565A8'):
+        for r, g, b, _ in image.pixels:
+            data += struct.pack('<H', _rgb565(r, g, b))
+        if name == 'RGB565A8':
+            data += bytes(a for _, _, _, a in image.pixels)
+        return data, w * 2
+    if name == 'A8':
+        data += bytes(a for _, _, _, a in image.pixels)
+        return data, w
+
+    # Indexed: palette of `lv_color32_t`, then the indices packed from the MSB
+    colors = sorted(set(image.pixels), key=lambda p: (p[3], p[0], p[1], p[2]))
+    if len(colors) > (1 << bpp):
+        raise ConvertError(f'{len(colors)} colors don\'t fit in {name}, use a direct color format')
+    colors += [(0, 0, 0, 0)] * ((1 << bpp) - len(colors))
+    index_of = {color: i for i, color in enumerate(colors)}
+    for r, g, b, a in colors:
+        data += bytes((b, g, r, a))
+    stride = (w * bpp + 7) // 8
+    per_byte = 8 // bpp
+    for y in range(image.height):
+        row = bytearray(stride)
+        for x in range(w):
+            shift = 8 - bpp * (x % per_byte + 1)
+            row[x // per_byte] |= index_of[image.pixels[y * w + x]] << shift
+        data += row
+    return data, stride
+
+
+# Compression #########################################################################################################
+
+def rle_compress(data, blk_size):
+    """
+    Same format as `lv_rle_decompress()`: a control byte with the MSB set is followed by that many literal blocks,
+    otherwise by one block repeated that many times
+    """
+    blocks = [bytes(data[i:i + blk_size]) for i in range(0, len(data), blk_size)]
+    out = bytearray()
+    i = 0
+    while i < len(blocks):
+        run = 1
+        while (i + run < len(blocks)) and (run < RLE_RUN_MAX) and (blocks[i + run] == blocks[i]):
+            run += 1
+        if run > 1:
+            out.append(run)
+            out += blocks[i]
+            i += run
+            continue
+        # Literals until the next run of at least two blocks
+        start = i
+        while (i < len(blocks)) and (i - start < RLE_RUN_MAX):
+            if (i + 1 < len(blocks)) and (blocks[i + 1] == blocks[i]):
+                break
+            i += 1
+        if i == start:
+            continue
+        out.append(0x80 | (i - start))
+        for block in blocks[start:i]:
+            out += block
+    return out
+
+
+def rle_decompress(data, blk_size, size):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        ctrl = data[i]
+        i += 1
+        if ctrl & 0x80:
+            count = (ctrl & 0x7f) * blk_size
+            out += data[i:i + count]
+            i += count
+        else:
+            out += data[i:i + blk_size] * ctrl
+            i += blk_size
+    return bytes(out[:size])
+
+
+def _lz4_length(out, length):
+    while length >= 0xff:
+        out.append(0xff)
+        length -= 0xff
+    out.append(length)
+
+
+def lz4_compress(data):
+    """
+    Greedy LZ4 block compression, without the size prefix, as expected by `LZ4_decompress_safe()`
+    """
+    data = bytes(data)
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    limit = len(data) - LZ4_MATCH_LIMIT
+    while i < limit:
+        key = data[i:i + LZ4_MIN_MATCH]
+        candidate = table.get(key)
+        table[key] = i
+        if (candidate is None) or (i - candidate > LZ4_OFFSET_MAX):
+            i += 1
+            continue
+
+        match_len = LZ4_MIN_MATCH
+        match_end = len(data) - LZ4_LAST_LITERALS
+        while (i + match_len < match_end) and (data[candidate + match_len] == data[i + match_len]):
+            match_len += 1
+
+        literal_len = i - anchor
+        token = (min(literal_len, 15) << 4) | min(match_len - LZ4_MIN_MATCH, 15)
+        out.append(token)
+        if literal_len >= 15:
+            _lz4_length(out, literal_len - 15)
+        out += data[anchor:i]
+        out += struct.pack('<H', i - candidate)
+        if match_len - LZ4_MIN_MATCH >= 15:
+            _lz4_length(out, match_len - LZ4_MIN_MATCH - 15)
+        i += match_len
+        anchor = i
+
+    literal_len = len(data) - anchor
+    out.append(min(literal_len, 15) << 4)
+    if literal_len >= 15:
+        _lz4_length(out, literal_len - 15)
+    out += data[anchor:]
+    return out
+
+
+def lz4_decompress(data, size):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        token = data[i]
+        i += 1
+        literal_len = token >> 4
+        if literal_len == 15:
+            while True:
+                literal_len += data[i]
+                i += 1
+                if data[i - 1] != 0xff:
+                    break
+        out += data[i:i + literal_len]
+        i += literal_len
+        if i >= len(data):
+            break
+        offset = data[i] | (data[i + 1] << 8)
+        i += 2
+        match_len = token & 0x0f
+        if match_len == 15:
+            while True:
+                match_len += data[i]
+                i += 1
+                if data[i - 1] != 0xff:
+                    break
+        match_len += LZ4_MIN_MATCH
+        for _ in range(match_len):
+            out.append(out[-offset])
+    return bytes(out[:size])
+
+
+def _rle_blk_size(cf):
+    # Same block size as the binary decoder of LVGL, the alpha plane of RGB565A8 is compressed with the colors
+    if cf == 'RGB565A8':
+        return 2
+    bpp, _ = COLOR_FORMATS.get(cf, (32, None))
+    return (bpp + 7) // 8
+
+
+def compress(data, cf, method):
+    """
+    Return the image data with the header of `lv_image_compressed_t`, checked by decompressing it
+    """
+    value, _ = COMPRESS_METHODS[method]
+    if method == 'NONE':
+        return bytes(data)
+
+    blk_size = _rle_blk_size(cf)
+    if method == 'RLE':
+        padded = bytes(data) + bytes((blk_size - len(data) % blk_size) % blk_size)
+        compressed = rle_compress(padded, blk_size)
+        check = rle_decompress(compressed, blk_size, len(data))
+    else:
+        compressed = lz4_compress(data)
+        check = lz4_decompress(compressed, len(data))
+    if check != bytes(data):
+        raise ConvertError(f'{method} round trip failed')
+
+    return struct.pack('<III', value, len(compressed), len(data)) + compressed
+
+
+def decompress(data, cf):
+    method, compressed_size, size = struct.unpack('<III', data[:12])
+    compressed = data[12:12 + compressed_size]
+    if method == COMPRESS_METHODS['RLE'][0]:
+        return rle_decompress(compressed, _rle_blk_size(cf), size)
+    if method == COMPRESS_METHODS['LZ4'][0]:
+        return lz4_decompress(compressed, size)
+    raise ConvertError(f'Unknown compression method {method}')
+
+
+# Output ##############################################################################################################
+
+def write_c_image(path, name, image, cf, method, data, stride):
+    bpp, lv_cf = COLOR_FORMATS[cf]
+    _, option = COMPRESS_METHODS[method]
+    attribute = 'LV_ATTRIBUTE_IMAGE_' + name.upper()
+    lines = [
+        '/*',
+        ' * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD',
+        ' *',
+        ' * SPDX-License-Identifier: Apache-2.0',
+        ' */',
+        f'/* Generated by tools/lv_image_converter.py: {cf}, compression {method} */',
+        '#ifdef __has_include',
+        '#if __has_include("lvgl.h")',
+        '#ifndef LV_LVGL_H_INCLUDE_SIMPLE',
+        '#define LV_LVGL_H_INCLUDE_SIMPLE',
+        '#endif',
+        '#endif',
+        '#endif',
+        '',
+        '#if defined(LV_LVGL_H_INCLUDE_SIMPLE)',
+        '#include "lvgl.h"',
+        '#else',
+        '#include "lvgl/lvgl.h"',
+        '#endif',
+        '',
+    ]
+    if option is not None:
+        lines += [
+            f'#if !{option}',
+            f'#error "This image is {method} compressed, enable `{option}`"',
+            '#endif',
+            '',
+        ]
+    lines += [
+        '#ifndef LV_ATTRIBUTE_MEM_ALIGN',
+        '#define LV_ATTRIBUTE_MEM_ALIGN',
+        '#endif',
+        '',
+        f'#ifndef {attribute}',
+        f'#define {attribute}',
+        '#endif',
+        '',
+        f'const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST {attribute} uint8_t {name}_map[] = {{',
+    ]
+    # A row of pixels per line, as the LVGL converter does
+    line_size = stride if method == 'NONE' else 32
+    for i in range(0, len(data), line_size):
+        lines.append('    ' + ' '.join(f'0x{value:02x},' for value in data[i:i + line_size]))
+    lines += [
+        '};',
+        '',
+        f'const lv_image_dsc_t {name} = {{',
+        f'    .header.cf = {lv_cf},',
+        '    .header.magic = LV_IMAGE_HEADER_MAGIC,',
+        f'    .header.flags = {"LV_IMAGE_FLAGS_COMPRESSED" if method != "NONE" else "0"},',
+        f'    .header.w = {image.width},',
+        f'    .header.h = {image.height},',
+        f'    .header.stride = {stride},',
+        f'    .data_size = sizeof({name}_map),',
+        f'    .data = {name}_map,',
+        '};',
+        '',
+    ]
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+def pack_bin_image(image, cf, method, data, stride):
+    """
+    Binary image of LVGL: `lv_image_header_t` followed by the data, as loaded from a file or an assets partition
+    """
+    flags = LV_IMAGE_FLAGS_COMPRESSED if method != 'NONE' else 0
+    header = struct.pack('<BBHHHHH', LV_IMAGE_HEADER_MAGIC, COLOR_FORMAT_VALUES[cf], flags, image.width, image.height,
+                         stride, 0)
+    return header + bytes(data)
+
+
+def report(image):
+    print(f'{"Format":<10} {"NONE":>8} {"RLE":>8} {"LZ4":>8}')
+    for cf in COLOR_FORMATS:
+        try:
+            data, _ = encode(image, cf)
+        except ConvertError:
+            print(f'{cf:<10} {"-":>8} {"-":>8} {"-":>8}')
+            continue
+        sizes = [len(compress(data, cf, method)) for method in COMPRESS_METHODS]
+        print(f'{cf:<10} ' + ' '.join(f'{size:>8}' for size in sizes))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', help='PNG, or C image generated by the LVGL converter or SquareLine Studio')
+    parser.add_argument('-o', '--output', help='C image to write, or binary image if it ends with `.bin`')
+    parser.add_argument('-n', '--name', help='Name of the image, the output file name by default')
+    parser.add_argument('--cf', choices=COLOR_FORMATS.keys(), default='RGB565A8', help='Color format')
+    parser.add_argument('--compress', choices=COMPRESS_METHODS.keys(), default='NONE', help='Compression')
+    parser.add_argument('--color-depth', type=int, choices=(16, 32), default=16,
+                        help='LV_COLOR_DEPTH of the input C image, for its native color formats')
+    parser.add_argument('--report', action='store_true', help='Print the data size of every format and exit')
+    args = parser.parse_args()
+
+    try:
+        image = load_image(args.input, args.color_depth)
+
+        if args.report:
+            report(image)
+            return 0
+        if args.output is None:
+            raise ConvertError('No output, use `-o` or `--report`')
+
+        name = args.name or os.path.splitext(os.path.basename(args.output))[0]
+        data, stride = encode(image, args.cf)
+        packed = compress(data, args.cf, args.compress)
+        if args.output.endswith('.bin'):
+            with open(args.output, 'wb') as f:
+                f.write(pack_bin_image(image, args.cf, args.compress, packed, stride))
+        else:
+            write_c_image(args.output, name, image, args.cf, args.compress, packed, stride)
+        print(f'{args.output}: {args.cf} {args.compress}, {image.width}x{image.height}, {len(packed)} bytes')
+    except ConvertError as e:
+        print(f'Error: {e}', file=sys.stderr)
+        return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
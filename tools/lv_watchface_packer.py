@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+# SPDX-License-Identifier: Apache-2.0
+"""
+Pack a watchface described in JSON into the binary face of `esp_brookesia_watchface_format.h`, loaded by
+`esp_brookesia::gui::Watchface`. Only the standard library is needed, so it can run as part of the build.
+
+The layers are drawn in order. Every layer has `x`, `y`, `color` ("#RRGGBB"), `opa` (0-255, 255 by default) and
+`cadence` (`static` by default, `minute` or `second`), then depending on its `type`:
+    fill            `w`, `h` and `radius`
+    image           `image`, a PNG relative to the JSON file, and `cf` (`RGB565`, `RGB565A8` or `A8`)
+    hand            `hand` (`hour`, `minute` or `second`) around (`x`, `y`), `length`, `width` and `tail`
+    text            `text` (`time`, `second`, `date` or `weekday`) centered in `w` x `h`, and `font_size`, which must
+                    be built in LVGL (`CONFIG_LV_FONT_MONTSERRAT_<size>`)
+    complication    Arc gauge in `w` x `h`, showing the value of the complication `id`, and `arc_width`
+
+Example:
+    {
+        "width": 410, "height": 410, "bg_color": "#000000",
+        "layers": [
+            {"type": "fill", "x": 0, "y": 0, "w": 410, "h": 410, "radius": 205, "color": "#202020"},
+            {"type": "hand", "hand": "second", "cadence": "second", "x": 205, "y": 205, "length": 180, "width": 2,
+             "tail": 20, "color": "#ff0000"}
+        ]
+    }
+
+    lv_watchface_packer.py analog.json -o analog.bin
+"""
+import argparse
+import json
+import os
+import struct
+import sys
+
+import lv_image_converter as image_converter
+
+WATCHFACE_MAGIC = 0x31465742
+WATCHFACE_VERSION = 1
+WATCHFACE_SIZE_MAX = 1024
+HEADER_FORMAT = '<IHHHHII'
+LAYER_FORMAT = '<BBBBhhHHIHHII'
+DATA_ALIGN = 4
+
+LAYER_TYPES = {'fill': 0, 'image': 1, 'hand': 2, 'text': 3, 'complication': 4}
+CADENCES = {'static': 0, 'minute': 1, 'second': 2}
+IMAGE_FORMATS = {'RGB565': 0, 'RGB565A8': 1, 'A8': 2}
+HANDS = {'hour': 0, 'minute': 1, 'second': 2}
+TEXTS = {'time': 0, 'second': 1, 'date': 2, 'weekday': 3}
+# Montserrat sizes of LVGL
+FONT_SIZES = range(8, 49, 2)
+
+
+class PackError(Exception):
+    pass
+
+
+def _choice(layer, key, choices, default=None):
+    value = layer.get(key, default)
+    if value not in choices:
+        raise PackError(f'Invalid {key} `{value}`, should be one of {", ".join(choices)}')
+    return choices[value]
+
+
+def _color(value):
+    if not (isinstance(value, str) and value.startswith('#') and (len(value) == 7)):
+        raise PackError(f'Invalid color `{value}`, should be "#RRGGBB"')
+    return int(value[1:], 16)
+
+
+def pack_layer(layer, base_dir):
+    """
+    Return the fields of `esp_brookesia_watchface_layer_t` except the data offset, and the data of the layer
+    """
+    kind = _choice(layer, 'type', LAYER_TYPES)
+    fields = {
+        'type': kind,
+        'cadence': _choice(layer, 'cadence', CADENCES, 'static'),
+        'source': 0,
+        'opa': layer.get('opa', 255),
+        'x': layer['x'],
+        'y': layer['y'],
+        'w': layer.get('w', 0),
+        'h': layer.get('h', 0),
+        'color': _color(layer.get('color', '#ffffff')),
+        'param': 0,
+    }
+    data = b''
+    if kind == LAYER_TYPES['fill']:
+        fields['param'] = layer.get('radius', 0)
+    elif kind == LAYER_TYPES['image']:
+        cf = layer.get('cf', 'RGB565A8')
+        fields['source'] = _choice(layer, 'cf', IMAGE_FORMATS, 'RGB565A8')
+        image = image_converter.load_png(os.path.join(base_dir, layer['image']))
+        fields['w'] = image.width
+        fields['h'] = image.height
+        data, _ = image_converter.encode(image, cf)
+    elif kind == LAYER_TYPES['hand']:
+        fields['source'] = _choice(layer, 'hand', HANDS)
+        fields['w'] = layer['width']
+        fields['h'] = layer['length']
+        fields['param'] = layer.get('tail', 0)
+    elif kind == LAYER_TYPES['text']:
+        fields['source'] = _choice(layer, 'text', TEXTS)
+        fields['param'] = layer['font_size']
+        if fields['param'] not in FONT_SIZES:
+            raise PackError(f'Invalid font size {fields["param"]}, should be even from 8 to 48')
+    else:
+        fields['source'] = layer['id']
+        fields['param'] = layer['arc_width']
+    if not (0 <= fields['opa'] <= 255) or not (0 <= fields['source'] <= 255):
+        raise PackError(f'Invalid layer {layer}')
+    return fields, bytes(data)
+
+
+def pack_face(path):
+    """
+    Return the binary face described by the JSON file
+    """
+    with open(path, 'r') as f:
+        face = json.load(f)
+    width, height = face['width'], face['height']
+    if not ((0 < width <= WATCHFACE_SIZE_MAX) and (0 < height <= WATCHFACE_SIZE_MAX)):
+        raise PackError(f'Invalid resolution {width}x{height}')
+    layers = face['layers']
+    if not layers:
+        raise PackError('No layer')
+
+    layer_size = struct.calcsize(LAYER_FORMAT)
+    offset = struct.calcsize(HEADER_FORMAT) + len(layers) * layer_size
+    table = bytearray()
+    blob = bytearray()
+    base_dir = os.path.dirname(path)
+    for i, layer in enumerate(layers):
+        try:
+            fields, data = pack_layer(layer, base_dir)
+        except KeyError as e:
+            raise PackError(f'Layer {i}: missing {e}')
+        except PackError as e:
+            raise PackError(f'Layer {i}: {e}')
+        data_offset = 0
+        if data:
+            # Aligned, the images are used in place
+            blob += bytes((-(offset + len(blob))) % DATA_ALIGN)
+            data_offset = offset + len(blob)
+            blob += data
+        table += struct.pack(
+            LAYER_FORMAT, fields['type'], fields['cadence'], fields['source'], fields['opa'], fields['x'],
+            fields['y'], fields['w'], fields['h'], fields['color'], fields['param'], 0, data_offset, len(data)
+        )
+
+    size = offset + len(blob)
+    header = struct.pack(
+        HEADER_FORMAT, WATCHFACE_MAGIC, WATCHFACE_VERSION, len(layers), width, height,
+        _color(face.get('bg_color', '#000000')), size
+    )
+    return header + table + blob
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', help='JSON description of the face')
+    parser.add_argument('-o', '--output', required=True, help='Binary face')
+    args = parser.parse_args()
+
+    try:
+        data = pack_face(args.input)
+    except (PackError, image_converter.ConvertError, KeyError, ValueError, struct.error) as e:
+        print(f'Error: {args.input}: {e}', file=sys.stderr)
+        return 1
+    with open(args.output, 'wb') as f:
+        f.write(data)
+    print(f'{os.path.basename(args.output)}: {len(data)} bytes')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())